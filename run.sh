@@ -23,12 +23,13 @@ readonly CONST_QEMU_MACHINE_PC_KVM="pc,accel=kvm,kernel-irqchip=split"
 readonly CONST_QEMU_CPU_I386="base,+fpu,+tsc,+cmov,+fxsr,+mmx,+sse,+apic"
 readonly CONST_QEMU_CPU_X86_64="qemu64"
 readonly CONST_QEMU_DEFAULT_RAM="256M"
+readonly CONST_QEMU_DEFAULT_SMP="2"
 readonly CONST_QEMU_BIOS_PC=""
 readonly CONST_QEMU_BIOS_IA32_EFI="bios/ovmf/ia32/OVMF.fd"
 readonly CONST_QEMU_BIOS_X64_EFI="bios/ovmf/x64/OVMF.fd"
 readonly CONST_QEMU_STORAGE_ARGS="-drive driver=raw,index=0,if=floppy,file=floppy0.img -drive driver=raw,node-name=hdd0,file.driver=file,file.filename=hdd0.img"
 readonly CONST_QEMU_NETWORK_ARGS="-nic model=rtl8139,id=eth0,hostfwd=udp::1797-:1797 -object filter-dump,id=filter0,netdev=eth0,file=eth0.dump"
-readonly CONST_QEMU_ARGS="-boot d -vga std -rtc base=localtime -device isa-debug-exit -smp 2"
+readonly CONST_QEMU_ARGS="-boot d -vga std -rtc base=localtime -device isa-debug-exit"
 readonly CONST_QEMU_OLD_AUDIO_ARGS="-soundhw pcspk -device sb16,irq=10,dma=1"
 readonly CONST_QEMU_NEW_AUDIO_ARGS="-audiodev id=pa,driver=pa -machine pcspk-audiodev=pa -device sb16,irq=10,dma=1,audiodev=pa"
 
@@ -36,6 +37,7 @@ QEMU_BIN="${CONST_QEMU_BIN_I386}"
 QEMU_MACHINE="${CONST_QEMU_MACHINE_PC}"
 QEMU_BIOS="${CONST_QEMU_BIOS_IA32_EFI}"
 QEMU_RAM="${CONST_QEMU_DEFAULT_RAM}"
+QEMU_SMP="${CONST_QEMU_DEFAULT_SMP}"
 QEMU_CPU="${CONST_QEMU_CPU_I386}"
 QEMU_CPU_OVERWRITE="false"
 QEMU_STORAGE_ARGS="${CONST_QEMU_STORAGE_ARGS}"
@@ -154,6 +156,12 @@ parse_ram() {
   QEMU_RAM="${memory}"
 }
 
+parse_smp() {
+  local cpus=$1
+
+  QEMU_SMP="${cpus}"
+}
+
 parse_cpu() {
   local cpu=$1
 
@@ -189,6 +197,8 @@ print_usage() {
         Set to true, to use the classic BIOS instead of UEFI
     -r, --ram
         Set the amount of ram, which qemu should use (e.g. 256, 1G, ...) (Default: 128M)
+    -s, --smp
+        Set the amount of CPU cores, which qemu should emulate (Default: 2)
     -c, --cpu
         Set the CPU model, which qemu should emulate (e.g. 486, pentium, pentium2, ...) (Default: base)
     -d, --debug
@@ -218,6 +228,9 @@ parse_args() {
     -r | --ram)
       parse_ram "$val"
       ;;
+    -s | --smp)
+      parse_smp "$val"
+      ;;
     -c | --cpu)
       parse_cpu "$val"
       ;;
@@ -252,7 +265,7 @@ run_qemu() {
     command="${command} -bios ${QEMU_BIOS}"
   fi
 
-  command="${command} -m ${QEMU_RAM} -cpu ${QEMU_CPU} ${QEMU_ARGS} ${QEMU_BOOT_DEVICE} ${QEMU_STORAGE_ARGS} ${QEMU_NETWORK_ARGS} ${QEMU_AUDIO_ARGS}"
+  command="${command} -m ${QEMU_RAM} -smp ${QEMU_SMP} -cpu ${QEMU_CPU} ${QEMU_ARGS} ${QEMU_BOOT_DEVICE} ${QEMU_STORAGE_ARGS} ${QEMU_NETWORK_ARGS} ${QEMU_AUDIO_ARGS}"
   
   printf "Running: %s\\n" "${command}"
 
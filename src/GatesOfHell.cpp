@@ -40,6 +40,7 @@
 #include "lib/util/async/Process.h"
 #include "kernel/service/MemoryService.h"
 #include "kernel/service/SchedulerService.h"
+#include "kernel/service/ProcessService.h"
 #include "kernel/memory/MemoryStatusNode.h"
 #include "device/power/apm/ApmMachine.h"
 #include "kernel/service/PowerManagementService.h"
@@ -89,6 +90,15 @@
 #include "lib/util/hardware/SmBios.h"
 #include "device/sound/soundblaster/SoundBlaster.h"
 #include "lib/util/graphic/Ansi.h"
+#include "kernel/system/LockStatisticsNode.h"
+#include "kernel/process/ProfileNode.h"
+#include "kernel/process/CpuTimeNode.h"
+#include "kernel/log/TraceNode.h"
+#include "kernel/system/BootPhasesNode.h"
+#include "kernel/interrupt/InterruptStatisticsNode.h"
+#include "kernel/system/InitializationGroup.h"
+#include "kernel/process/Thread.h"
+#include "lib/util/async/FunctionPointerRunnable.h"
 
 namespace Device {
 class Machine;
@@ -114,18 +124,35 @@ void GatesOfHell::enter() {
 
     if (Device::Bios::isAvailable()) {
         log.info("BIOS detected");
-        Device::Bios::init();
+        runBootPhase("bios", &Device::Bios::init);
     }
 
-    Device::Pci::scan();
+    runBootPhase("pci", &Device::Pci::scan);
 
-    initializeStorage();
+    // The remaining initialization runs in a kernel thread, so that device probes can wait in parallel instead of busy waiting
+    auto &processService = Kernel::System::getService<Kernel::ProcessService>();
+    auto &schedulerService = Kernel::System::getService<Kernel::SchedulerService>();
+    auto &bootThread = Kernel::Thread::createKernelThread("Boot", processService.getKernelProcess(), new Util::Async::FunctionPointerRunnable(&boot));
+    schedulerService.ready(bootThread);
 
-    initializeFilesystem();
+    log.info("Starting scheduler!");
+    schedulerService.startScheduler();
+
+    Util::Exception::throwException(Util::Exception::ILLEGAL_STATE, "Once you entered the gates of hell, you are not allowed to leave!");
+}
 
-    initializePorts();
+void GatesOfHell::boot() {
+    // Storage devices are probed in parallel and must be registered, before the root filesystem is mounted
+    auto storageProbes = Kernel::InitializationGroup();
+    storageProbes.start("ide", &Device::Storage::IdeController::initializeAvailableControllers);
+    storageProbes.start("floppy", &initializeFloppy);
+    storageProbes.join();
 
-    initializeTerminal();
+    runBootPhase("filesystem", &initializeFilesystem);
+
+    runBootPhase("ports", &initializePorts);
+
+    runBootPhase("terminal", &initializeTerminal);
 
     enablePortLogging();
 
@@ -138,17 +165,16 @@ void GatesOfHell::enter() {
         Kernel::Logger::addOutputStream(*terminalLogStream);
     }
 
-    initializePs2Devices();
-
-    initializeNetwork();
-
-    initializeSound();
+    // These devices publish nodes in /device, so they can only be probed after the filesystem has been initialized
+    auto deviceProbes = Kernel::InitializationGroup();
+    deviceProbes.start("ps2", &initializePs2Devices);
+    deviceProbes.start("network", &initializeNetwork);
+    deviceProbes.start("sound", &initializeSound);
+    deviceProbes.join();
 
-    initializePowerManagement();
+    runBootPhase("power", &initializePowerManagement);
 
-    mountDevices();
-
-    Util::Async::Process::execute(Util::Io::File("/initrd/bin/shell"), Util::Io::File("/device/terminal"), Util::Io::File("/device/terminal"), Util::Io::File("/device/terminal"), "shell", Util::Array<Util::String>(0));
+    runBootPhase("mount", &mountDevices);
 
     Kernel::System::getService<Kernel::InterruptService>().allowParallelComputing();
 
@@ -159,10 +185,13 @@ void GatesOfHell::enter() {
 
     printBanner();
 
-    log.info("Starting scheduler!");
-    Kernel::System::getService<Kernel::SchedulerService>().startScheduler();
+    Util::Async::Process::execute(Util::Io::File("/initrd/bin/shell"), Util::Io::File("/device/terminal"), Util::Io::File("/device/terminal"), Util::Io::File("/device/terminal"), "shell", Util::Array<Util::String>(0));
+}
 
-    Util::Exception::throwException(Util::Exception::ILLEGAL_STATE, "Once you entered the gates of hell, you are not allowed to leave!");
+void GatesOfHell::runBootPhase(const char *name, void (*function)()) {
+    auto phase = Kernel::System::startBootPhase(name);
+    function();
+    Kernel::System::finishBootPhase(phase);
 }
 
 void GatesOfHell::printMultibootInformation() {
@@ -365,6 +394,14 @@ void GatesOfHell::initializeFilesystem() {
     deviceDriver->addNode("/", new Filesystem::Memory::RandomNode());
     deviceDriver->addNode("/", new Filesystem::Memory::MountsNode());
     deviceDriver->addNode("/", new Kernel::MemoryStatusNode("memory"));
+    deviceDriver->addNode("/", new Kernel::ProfileNode("profile"));
+    deviceDriver->addNode("/", new Kernel::CpuTimeNode("cpu_time"));
+    deviceDriver->addNode("/", new Kernel::TraceNode("trace"));
+    deviceDriver->addNode("/", new Kernel::BootPhasesNode("boot"));
+    deviceDriver->addNode("/", new Kernel::InterruptStatisticsNode("interrupts"));
+#ifdef HHUOS_LOCK_PROFILING
+    deviceDriver->addNode("/", new Kernel::LockStatisticsNode("locks"));
+#endif
 
     if (Kernel::Multiboot::isModuleLoaded("initrd")) {
         log.info("Initial ramdisk detected -> Mounting [%s]", "/initrd");
@@ -460,9 +497,7 @@ void GatesOfHell::initializePowerManagement() {
     Kernel::System::registerService(Kernel::PowerManagementService::SERVICE_ID, powerManagementService);
 }
 
-void GatesOfHell::initializeStorage() {
-    Device::Storage::IdeController::initializeAvailableControllers();
-
+void GatesOfHell::initializeFloppy() {
     if (Device::Storage::FloppyController::isAvailable()) {
         auto *floppyController = new Device::Storage::FloppyController();
         floppyController->initializeAvailableDrives();
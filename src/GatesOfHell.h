@@ -58,6 +58,16 @@ public:
 
 private:
 
+    /**
+     * Initialize devices and filesystems and start the shell. Runs in its own kernel thread.
+     */
+    static void boot();
+
+    /**
+     * Run a serial initialization step and record it as boot phase.
+     */
+    static void runBootPhase(const char *name, void (*function)());
+
     static void printMultibootInformation();
 
     static void printCpuInformation();
@@ -78,7 +88,7 @@ private:
 
     static void initializePowerManagement();
 
-    static void initializeStorage();
+    static void initializeFloppy();
 
     static void initializeNetwork();
 
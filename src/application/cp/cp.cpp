@@ -25,6 +25,82 @@
 #include "lib/util/io/stream/FileInputStream.h"
 #include "lib/util/io/stream/FileOutputStream.h"
 #include "lib/util/io/stream/PrintStream.h"
+#include "lib/util/io/ring/IoRing.h"
+
+static const constexpr uint32_t BUFFER_SIZE = 4096;
+static const constexpr uint32_t BUFFER_COUNT = 8;
+static const constexpr uint32_t WRITE_FLAG = 0x10000;
+
+bool copyWithStreams(const Util::Io::File &sourceFile, const Util::Io::File &targetFile) {
+    auto source = Util::Io::FileInputStream(sourceFile);
+    auto target = Util::Io::FileOutputStream(targetFile);
+
+    auto *buffer = new uint8_t[BUFFER_SIZE];
+    int32_t read;
+    do {
+        read = source.read(buffer, 0, BUFFER_SIZE);
+        if (read > 0) {
+            target.write(buffer, 0, read);
+        }
+    } while (read != -1);
+
+    delete[] buffer;
+    return true;
+}
+
+/**
+ * Keep several reads and writes in flight, so that reading the next blocks overlaps with writing the previous ones.
+ * Each buffer is either being read or being written, the buffer index is passed as user data.
+ */
+bool copyWithRing(Util::Io::IoRing &ring, int32_t sourceDescriptor, int32_t targetDescriptor, uint32_t length) {
+    auto *buffers = new uint8_t[BUFFER_COUNT * BUFFER_SIZE];
+    uint32_t offsets[BUFFER_COUNT];
+    uint32_t nextOffset = 0;
+    uint32_t pendingOperations = 0;
+    bool success = true;
+
+    for (uint32_t i = 0; i < BUFFER_COUNT && nextOffset < length; i++) {
+        auto chunkSize = length - nextOffset < BUFFER_SIZE ? length - nextOffset : BUFFER_SIZE;
+        offsets[i] = nextOffset;
+        ring.submitRead(sourceDescriptor, buffers + i * BUFFER_SIZE, nextOffset, chunkSize, i);
+        nextOffset += chunkSize;
+        pendingOperations++;
+    }
+
+    while (pendingOperations > 0) {
+        ring.enter(1);
+
+        Util::Io::IoRing::Completion completion{};
+        while (ring.getCompletion(completion)) {
+            pendingOperations--;
+            auto index = completion.userData & ~WRITE_FLAG;
+
+            if (completion.result < 0) {
+                success = false;
+            }
+
+            if (!success) {
+                continue;
+            }
+
+            if ((completion.userData & WRITE_FLAG) == 0) {
+                if (completion.result > 0) {
+                    ring.submitWrite(targetDescriptor, buffers + index * BUFFER_SIZE, offsets[index], completion.result, index | WRITE_FLAG);
+                    pendingOperations++;
+                }
+            } else if (nextOffset < length) {
+                auto chunkSize = length - nextOffset < BUFFER_SIZE ? length - nextOffset : BUFFER_SIZE;
+                offsets[index] = nextOffset;
+                ring.submitRead(sourceDescriptor, buffers + index * BUFFER_SIZE, nextOffset, chunkSize, index);
+                nextOffset += chunkSize;
+                pendingOperations++;
+            }
+        }
+    }
+
+    delete[] buffers;
+    return success;
+}
 
 int32_t main(int32_t argc, char *argv[]) {
     auto argumentParser = Util::ArgumentParser();
@@ -71,18 +147,23 @@ int32_t main(int32_t argc, char *argv[]) {
         return -1;
     }
 
-    auto source = Util::Io::FileInputStream(sourceFile);
-    auto target = Util::Io::FileOutputStream(targetFile);
+    auto ring = Util::Io::IoRing(BUFFER_COUNT);
+    if (!ring.isValid()) {
+        copyWithStreams(sourceFile, targetFile);
+        return 0;
+    }
 
-    auto *buffer = new uint8_t[4096];
-    int32_t read;
-    do {
-        read = source.read(buffer, 0, 4096);
-        if (read > 0) {
-            target.write(buffer, 0, read);
-        }
-    } while (read != -1);
+    auto sourceDescriptor = Util::Io::File::open(sourceFile.getCanonicalPath());
+    auto targetDescriptor = Util::Io::File::open(targetFile.getCanonicalPath());
+    auto success = copyWithRing(ring, sourceDescriptor, targetDescriptor, sourceFile.getLength());
+
+    Util::Io::File::close(sourceDescriptor);
+    Util::Io::File::close(targetDescriptor);
+
+    if (!success) {
+        Util::System::error << "cp: Failed to copy '" << arguments[0] << "'!" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return -1;
+    }
 
-    delete[] buffer;
     return 0;
 }
\ No newline at end of file
@@ -33,17 +33,17 @@
 static const constexpr uint32_t BUFFER_SIZE = 1024 * 1024;
 
 void benchmark(uint32_t iterations, const Util::Address<uint32_t> &source, const Util::Address<uint32_t> &target, uint32_t &memsetResult, uint32_t &memcpyResult) {
-    auto start = Util::Time::getSystemTime().toMilliseconds();
+    auto start = Util::Time::getSystemTime().toMicroseconds();
     for (uint32_t i = 0; i < iterations; i++) {
         target.setRange(i, BUFFER_SIZE);
     }
-    memsetResult = Util::Time::getSystemTime().toMilliseconds() - start;
+    memsetResult = Util::Time::getSystemTime().toMicroseconds() - start;
 
-    start = Util::Time::getSystemTime().toMilliseconds();
+    start = Util::Time::getSystemTime().toMicroseconds();
     for (uint32_t i = 0; i < iterations; i++) {
         target.copyRange(source, BUFFER_SIZE);
     }
-    memcpyResult = Util::Time::getSystemTime().toMilliseconds() - start;
+    memcpyResult = Util::Time::getSystemTime().toMicroseconds() - start;
 }
 
 int32_t main(int32_t argc, char *argv[]) {
@@ -74,8 +74,8 @@ int32_t main(int32_t argc, char *argv[]) {
     Util::System::out << "Running memory benchmarks without extensions..." << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
     benchmark(iterations, Util::Address<uint32_t>(buffer1), Util::Address<uint32_t>(buffer2), memsetResult, memcpyResult);
     resultWriter << "Without extensions:" << Util::Io::PrintStream::endl
-                 << "memset: " << memsetResult << "ms" << Util::Io::PrintStream::endl
-                 << "memcpy: " << memcpyResult << "ms" << Util::Io::PrintStream::endl;
+                 << "memset: " << memsetResult << "us" << Util::Io::PrintStream::endl
+                 << "memcpy: " << memcpyResult << "us" << Util::Io::PrintStream::endl;
 
     if (Util::Hardware::CpuId::getCpuFeatures().contains(Util::Hardware::CpuId::MMX)) {
         uint32_t memsetMmxResult, memcpyMmxResult;
@@ -90,8 +90,8 @@ int32_t main(int32_t argc, char *argv[]) {
         auto memcpyString = Util::String::format("%u.%02ux", static_cast<uint32_t>(memcpySpeedup), static_cast<uint32_t>((memcpySpeedup - static_cast<uint32_t>(memcpySpeedup)) * 100));
         
         resultWriter << Util::Io::PrintStream::endl << "MMX enabled:" << Util::Io::PrintStream::endl
-                     << "memset: " << memsetMmxResult << "ms (" << memsetString << ")" << Util::Io::PrintStream::endl
-                     << "memcpy: " << memcpyMmxResult << "ms (" << memcpyString << ")" << Util::Io::PrintStream::endl;
+                     << "memset: " << memsetMmxResult << "us (" << memsetString << ")" << Util::Io::PrintStream::endl
+                     << "memcpy: " << memcpyMmxResult << "us (" << memcpyString << ")" << Util::Io::PrintStream::endl;
     }
 
     if (Util::Hardware::CpuId::getCpuFeatures().contains(Util::Hardware::CpuId::SSE)) {
@@ -105,8 +105,8 @@ int32_t main(int32_t argc, char *argv[]) {
         auto memcpyString = Util::String::format("%u.%02ux", static_cast<uint32_t>(memcpySpeedup), static_cast<uint32_t>((memcpySpeedup - static_cast<uint32_t>(memcpySpeedup)) * 100));
 
         resultWriter << Util::Io::PrintStream::endl << "SSE enabled:" << Util::Io::PrintStream::endl
-                     << "memset: " << memsetSseResult << "ms (" << memsetString << ")" << Util::Io::PrintStream::endl
-                     << "memcpy: " << memcpySseResult << "ms (" << memcpyString << ")" << Util::Io::PrintStream::endl;
+                     << "memset: " << memsetSseResult << "us (" << memsetString << ")" << Util::Io::PrintStream::endl
+                     << "memcpy: " << memcpySseResult << "us (" << memcpyString << ")" << Util::Io::PrintStream::endl;
     }
     
     delete[] buffer1;
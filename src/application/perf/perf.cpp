@@ -0,0 +1,266 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include <cstdint>
+
+#include "lib/util/base/System.h"
+#include "lib/util/base/ArgumentParser.h"
+#include "lib/util/base/String.h"
+#include "lib/util/async/Process.h"
+#include "lib/util/collection/Array.h"
+#include "lib/util/collection/ArrayList.h"
+#include "lib/util/collection/HashMap.h"
+#include "lib/util/io/file/File.h"
+#include "lib/util/io/file/elf/File.h"
+#include "lib/util/io/stream/FileInputStream.h"
+#include "lib/util/io/stream/FileOutputStream.h"
+#include "lib/util/io/stream/PrintStream.h"
+
+static const constexpr uint32_t DEFAULT_FREQUENCY = 1000;
+static const constexpr uint32_t DEFAULT_TOP_COUNT = 20;
+static const constexpr char *PROFILE_PATH = "/device/profile";
+static const constexpr char *KERNEL_PATH = "/initrd/system/kernel";
+
+/**
+ * Layout of the samples, read from /device/profile (see Kernel::SamplingProfiler::Sample).
+ */
+struct Sample {
+    uint32_t address;
+    uint32_t processId;
+    uint32_t threadId;
+    uint8_t cpuId;
+    uint8_t privilegeLevel;
+    uint16_t reserved;
+} __attribute__((packed));
+
+struct FunctionEntry {
+    Util::String name;
+    uint32_t samples;
+
+    bool operator!=(const FunctionEntry &other) const {
+        return name != other.name;
+    }
+};
+
+Util::String findBinary(const Util::String &command) {
+    if (Util::Io::File(command).exists()) {
+        return command;
+    }
+
+    for (const auto &directory : Util::String("/initrd/bin:/bin").split(":")) {
+        auto file = Util::Io::File(directory + "/" + command);
+        if (file.exists() && file.isFile()) {
+            return file.getCanonicalPath();
+        }
+    }
+
+    return "";
+}
+
+Util::Io::Elf::File* loadElfFile(const Util::String &path) {
+    auto file = Util::Io::File(path);
+    if (!file.exists() || !file.isFile()) {
+        return nullptr;
+    }
+
+    auto length = static_cast<uint32_t>(file.getLength());
+    auto *buffer = new uint8_t[length];
+    auto stream = Util::Io::FileInputStream(file);
+
+    uint32_t offset = 0;
+    while (offset < length) {
+        auto read = stream.read(buffer, offset, length - offset);
+        if (read <= 0) {
+            delete[] buffer;
+            return nullptr;
+        }
+
+        offset += read;
+    }
+
+    return new Util::Io::Elf::File(buffer);
+}
+
+void setFrequency(uint32_t frequency) {
+    auto stream = Util::Io::FileOutputStream(PROFILE_PATH);
+    auto string = Util::String::format("%u", frequency);
+    stream.write(static_cast<const uint8_t*>(string), 0, string.length());
+}
+
+/**
+ * Drain the recorded samples and count them per address.
+ * User space samples are only taken into account, if they belong to the profiled process.
+ *
+ * @return The total number of samples
+ */
+uint32_t readSamples(uint32_t processId, Util::HashMap<uint32_t, uint32_t> &kernelAddresses, Util::HashMap<uint32_t, uint32_t> &userAddresses, uint32_t &otherProcessSamples) {
+    auto stream = Util::Io::FileInputStream(PROFILE_PATH);
+    auto *buffer = new Sample[256];
+    uint32_t total = 0;
+
+    int32_t read;
+    while ((read = stream.read(reinterpret_cast<uint8_t*>(buffer), 0, 256 * sizeof(Sample))) > 0) {
+        for (uint32_t i = 0; i < read / sizeof(Sample); i++) {
+            const auto &sample = buffer[i];
+            total++;
+
+            if (sample.privilegeLevel != 0 && sample.processId != processId) {
+                otherProcessSamples++;
+                continue;
+            }
+
+            auto &addresses = sample.privilegeLevel == 0 ? kernelAddresses : userAddresses;
+            addresses.put(sample.address, addresses.containsKey(sample.address) ? addresses.get(sample.address) + 1 : 1);
+        }
+    }
+
+    delete[] buffer;
+    return total;
+}
+
+Util::String resolveSymbol(Util::Io::Elf::File *elfFile, uint32_t address) {
+    uint32_t symbolAddress = 0;
+    const char *name = elfFile == nullptr ? nullptr : elfFile->getSymbolName(address, symbolAddress);
+
+    return name == nullptr ? Util::String::format("0x%08x", address) : Util::String(name);
+}
+
+/**
+ * Resolve each distinct address once and sum up the samples per function.
+ */
+Util::Array<FunctionEntry> buildProfile(const Util::HashMap<uint32_t, uint32_t> &kernelAddresses, const Util::HashMap<uint32_t, uint32_t> &userAddresses,
+                                        uint32_t otherProcessSamples, Util::Io::Elf::File *kernelFile, Util::Io::Elf::File *binaryFile) {
+    auto functions = Util::HashMap<Util::String, uint32_t>();
+    for (auto address : kernelAddresses.keys()) {
+        auto name = "[kernel] " + resolveSymbol(kernelFile, address);
+        functions.put(name, (functions.containsKey(name) ? functions.get(name) : 0) + kernelAddresses.get(address));
+    }
+
+    for (auto address : userAddresses.keys()) {
+        auto name = resolveSymbol(binaryFile, address);
+        functions.put(name, (functions.containsKey(name) ? functions.get(name) : 0) + userAddresses.get(address));
+    }
+
+    if (otherProcessSamples > 0) {
+        functions.put("[other processes]", otherProcessSamples);
+    }
+
+    auto profile = Util::Array<FunctionEntry>(functions.size());
+    auto names = functions.keys();
+    for (uint32_t i = 0; i < names.length(); i++) {
+        profile[i] = FunctionEntry{names[i], functions.get(names[i])};
+    }
+
+    // Sort by sample count (insertion sort)
+    for (uint32_t i = 1; i < profile.length(); i++) {
+        auto entry = profile[i];
+        auto j = i;
+        while (j > 0 && profile[j - 1].samples < entry.samples) {
+            profile[j] = profile[j - 1];
+            j--;
+        }
+
+        profile[j] = entry;
+    }
+
+    return profile;
+}
+
+int32_t main(int32_t argc, char *argv[]) {
+    auto argumentParser = Util::ArgumentParser();
+    argumentParser.setHelpText("Run a program and show a flat profile of the functions, in which the CPU spent its time.\n"
+                               "Samples are taken on timer interrupts, so the frequency is limited by the timer frequency.\n"
+                               "Kernel functions are resolved using '/initrd/system/kernel'. Function names are not demangled.\n"
+                               "Usage: perf [OPTION]... COMMAND [ARGUMENT]...\n"
+                               "Options:\n"
+                               "  -f, --frequency: Set the sampling frequency in Hz (Default: 1000)\n"
+                               "  -n, --top: Amount of functions to show (Default: 20)\n"
+                               "  -h, --help: Show this help message");
+
+    argumentParser.addArgument("frequency", false, "f");
+    argumentParser.addArgument("top", false, "n");
+
+    // Options after the command belong to the profiled program
+    int32_t commandIndex = 1;
+    while (commandIndex < argc && argv[commandIndex][0] == '-') {
+        auto option = Util::String(argv[commandIndex]);
+        commandIndex += (option == "-f" || option == "--frequency" || option == "-n" || option == "--top") ? 2 : 1;
+    }
+
+    if (!argumentParser.parse(commandIndex > argc ? argc : commandIndex, argv)) {
+        Util::System::error << argumentParser.getErrorString() << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return -1;
+    }
+
+    if (commandIndex >= argc) {
+        Util::System::error << "perf: No command given!" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return -1;
+    }
+
+    auto frequency = static_cast<uint32_t>(argumentParser.hasArgument("frequency") ? Util::String::parseInt(argumentParser.getArgument("frequency")) : DEFAULT_FREQUENCY);
+    auto topCount = static_cast<uint32_t>(argumentParser.hasArgument("top") ? Util::String::parseInt(argumentParser.getArgument("top")) : DEFAULT_TOP_COUNT);
+    if (frequency == 0 || topCount == 0) {
+        Util::System::error << "perf: Frequency and function count must be greater than zero!" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return -1;
+    }
+
+    auto command = Util::String(argv[commandIndex]);
+    auto binaryPath = findBinary(command);
+    if (binaryPath.isEmpty()) {
+        Util::System::error << "perf: '" << command << "' not found!" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return -1;
+    }
+
+    auto arguments = Util::Array<Util::String>(argc - commandIndex - 1);
+    for (int32_t i = commandIndex + 1; i < argc; i++) {
+        arguments[i - commandIndex - 1] = argv[i];
+    }
+
+    auto terminal = Util::Io::File("/device/terminal");
+    setFrequency(frequency);
+    auto process = Util::Async::Process::execute(Util::Io::File(binaryPath), terminal, terminal, terminal, command, arguments);
+    process.join();
+    setFrequency(0);
+
+    auto kernelAddresses = Util::HashMap<uint32_t, uint32_t>();
+    auto userAddresses = Util::HashMap<uint32_t, uint32_t>();
+    uint32_t otherProcessSamples = 0;
+    auto sampleCount = readSamples(process.getId(), kernelAddresses, userAddresses, otherProcessSamples);
+    if (sampleCount == 0) {
+        Util::System::out << "perf: No samples recorded!" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return 0;
+    }
+
+    auto *kernelFile = loadElfFile(KERNEL_PATH);
+    auto *binaryFile = loadElfFile(binaryPath);
+    auto profile = buildProfile(kernelAddresses, userAddresses, otherProcessSamples, kernelFile, binaryFile);
+
+    Util::System::out << Util::Io::PrintStream::endl << "Samples: " << sampleCount << " (" << frequency << " Hz)" << Util::Io::PrintStream::endl
+                      << "Share\tSamples\tFunction" << Util::Io::PrintStream::endl;
+
+    for (uint32_t i = 0; i < profile.length() && i < topCount; i++) {
+        const auto &entry = profile[i];
+        auto share = entry.samples * 1000 / sampleCount;
+        Util::System::out << Util::String::format("%u.%u", share / 10, share % 10) << "%\t" << entry.samples << "\t" << entry.name << Util::Io::PrintStream::endl;
+    }
+
+    Util::System::out << Util::Io::PrintStream::flush;
+
+    delete kernelFile;
+    delete binaryFile;
+    return 0;
+}
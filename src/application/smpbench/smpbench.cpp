@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include <cstdint>
+
+#include "lib/util/base/System.h"
+#include "lib/util/time/Timestamp.h"
+#include "lib/util/async/Runnable.h"
+#include "lib/util/async/Thread.h"
+#include "lib/util/base/ArgumentParser.h"
+#include "lib/util/collection/Array.h"
+#include "lib/util/base/String.h"
+#include "lib/util/io/stream/PrintStream.h"
+
+static const constexpr uint32_t DEFAULT_THREAD_COUNT = 4;
+static const constexpr uint32_t DEFAULT_WORK_SIZE = 200000;
+
+/**
+ * CPU-bound workload: Count the prime numbers in a given range by trial division.
+ * The result is written to memory owned by the main thread, because the runnable is deleted together with its thread.
+ */
+class PrimeCounter : public Util::Async::Runnable {
+
+public:
+
+    PrimeCounter(uint32_t start, uint32_t end, volatile uint32_t &result) : start(start), end(end), result(result) {}
+
+    void run() override {
+        uint32_t count = 0;
+        for (uint32_t i = start; i < end; i++) {
+            if (isPrime(i)) {
+                count++;
+            }
+        }
+
+        result = count;
+    }
+
+private:
+
+    static bool isPrime(uint32_t number) {
+        if (number < 2) {
+            return false;
+        }
+
+        for (uint32_t divisor = 2; divisor * divisor <= number; divisor++) {
+            if (number % divisor == 0) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    uint32_t start;
+    uint32_t end;
+    volatile uint32_t &result;
+};
+
+uint32_t benchmark(uint32_t threadCount, uint32_t workSize, uint32_t &primeCount) {
+    auto *results = new volatile uint32_t[threadCount];
+    auto threadIds = Util::Array<uint32_t>(threadCount);
+    auto chunkSize = workSize / threadCount;
+
+    auto start = Util::Time::getSystemTime().toMilliseconds();
+    for (uint32_t i = 0; i < threadCount; i++) {
+        auto end = i == threadCount - 1 ? workSize : (i + 1) * chunkSize;
+        auto thread = Util::Async::Thread::createThread(Util::String::format("Worker-%u", i), new PrimeCounter(i * chunkSize, end, results[i]));
+        threadIds[i] = thread.getId();
+    }
+
+    for (uint32_t i = 0; i < threadCount; i++) {
+        Util::Async::Thread(threadIds[i]).join();
+    }
+    auto time = Util::Time::getSystemTime().toMilliseconds() - start;
+
+    primeCount = 0;
+    for (uint32_t i = 0; i < threadCount; i++) {
+        primeCount += results[i];
+    }
+
+    delete[] results;
+    return time;
+}
+
+int32_t main(int32_t argc, char *argv[]) {
+    auto argumentParser = Util::ArgumentParser();
+    argumentParser.setHelpText("CPU-bound benchmark, showing the speedup gained by running threads on multiple CPU cores.\n"
+                               "The same workload (counting primes) is run by a single thread and split across multiple threads.\n"
+                               "Usage: smpbench [WORKSIZE]\n"
+                               "Options:\n"
+                               "  -t, --threads: Amount of threads to use for the parallel run (Default: 4)\n"
+                               "  -h, --help: Show this help message");
+
+    argumentParser.addArgument("threads", false, "t");
+
+    if (!argumentParser.parse(argc, argv)) {
+        Util::System::error << argumentParser.getErrorString() << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return -1;
+    }
+
+    auto arguments = argumentParser.getUnnamedArguments();
+    auto workSize = static_cast<uint32_t>(arguments.length() == 0 ? DEFAULT_WORK_SIZE : Util::String::parseInt(arguments[0]));
+    auto threadCount = static_cast<uint32_t>(argumentParser.hasArgument("threads") ? Util::String::parseInt(argumentParser.getArgument("threads")) : DEFAULT_THREAD_COUNT);
+    if (threadCount == 0) {
+        Util::System::error << "smpbench: Thread count must be greater than zero!" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return -1;
+    }
+
+    uint32_t singlePrimeCount, parallelPrimeCount;
+    Util::System::out << "Running benchmark with 1 thread..." << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+    auto singleResult = benchmark(1, workSize, singlePrimeCount);
+
+    Util::System::out << "Running benchmark with " << threadCount << " threads..." << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+    auto parallelResult = benchmark(threadCount, workSize, parallelPrimeCount);
+
+    if (singlePrimeCount != parallelPrimeCount) {
+        Util::System::error << "smpbench: Results do not match (" << singlePrimeCount << " != " << parallelPrimeCount << ")!" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return -1;
+    }
+
+    double speedup = parallelResult == 0 ? 0 : (double) singleResult / parallelResult;
+    auto speedupString = Util::String::format("%u.%02ux", static_cast<uint32_t>(speedup), static_cast<uint32_t>((speedup - static_cast<uint32_t>(speedup)) * 100));
+
+    Util::System::out << Util::Io::PrintStream::endl
+                      << "Primes found: " << singlePrimeCount << Util::Io::PrintStream::endl
+                      << "1 thread: " << singleResult << "ms" << Util::Io::PrintStream::endl
+                      << threadCount << " threads: " << parallelResult << "ms (" << speedupString << ")" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+
+    return 0;
+}
@@ -0,0 +1,259 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include <cstdint>
+
+#include "lib/util/base/System.h"
+#include "lib/util/base/ArgumentParser.h"
+#include "lib/util/base/String.h"
+#include "lib/util/async/Process.h"
+#include "lib/util/async/Thread.h"
+#include "lib/util/collection/Array.h"
+#include "lib/util/io/file/File.h"
+#include "lib/util/io/stream/PrintStream.h"
+#include "lib/util/time/Timestamp.h"
+
+static const constexpr uint32_t CALIBRATION_TIME = 100;
+static const constexpr uint32_t POLL_INTERVAL = 10;
+static const constexpr uint32_t BUFFER_SIZE = 256;
+static const constexpr uint32_t CODE_COUNT = Util::System::SET_THREAD_PRIORITY + 1;
+
+/**
+ * Names of the system calls, in the order of Util::System::Code.
+ */
+static const char *CODE_NAMES[CODE_COUNT] = {
+        "YIELD", "EXIT_PROCESS", "EXECUTE_BINARY", "GET_CURRENT_PROCESS", "GET_CURRENT_THREAD", "JOIN_THREAD", "CREATE_THREAD",
+        "EXIT_THREAD", "JOIN_PROCESS", "KILL_PROCESS", "SLEEP", "UNMAP", "MAP_IO", "MOUNT", "UNMOUNT",
+        "CREATE_FILE", "DELETE_FILE", "OPEN_FILE", "CLOSE_FILE", "FILE_TYPE", "FILE_LENGTH", "FILE_CHILDREN", "WRITE_FILE",
+        "READ_FILE", "CONTROL_FILE", "CREATE_SOCKET", "SEND_DATAGRAM", "RECEIVE_DATAGRAM", "CHANGE_DIRECTORY",
+        "GET_CURRENT_WORKING_DIRECTORY", "GET_SYSTEM_TIME", "SET_DATE", "GET_CURRENT_DATE", "SHUTDOWN", "CREATE_IO_RING",
+        "ENTER_IO_RING", "DESTROY_IO_RING", "READ_SYSTEM_CALL_TRACE", "SET_THREAD_PRIORITY"
+};
+
+struct CodeSummary {
+    uint32_t calls;
+    uint32_t failed;
+    uint64_t totalCycles;
+    Util::Async::SystemCallRecord slowest;
+};
+
+Util::String findBinary(const Util::String &command) {
+    if (Util::Io::File(command).exists()) {
+        return command;
+    }
+
+    for (const auto &directory : Util::String("/initrd/bin:/bin").split(":")) {
+        auto file = Util::Io::File(directory + "/" + command);
+        if (file.exists() && file.isFile()) {
+            return file.getCanonicalPath();
+        }
+    }
+
+    return "";
+}
+
+uint64_t readTimestampCounter() {
+    uint32_t low;
+    uint32_t high;
+    asm volatile ("rdtsc" : "=a"(low), "=d"(high));
+
+    return (static_cast<uint64_t>(high) << 32) | low;
+}
+
+/**
+ * Records carry elapsed time stamp counter cycles, which are converted using a short calibration.
+ */
+double calibrateCyclesPerMicrosecond() {
+    auto startTime = Util::Time::getSystemTime().toMicroseconds();
+    auto startCycles = readTimestampCounter();
+    Util::Async::Thread::sleep(Util::Time::Timestamp::ofMilliseconds(CALIBRATION_TIME));
+    auto endCycles = readTimestampCounter();
+    auto endTime = Util::Time::getSystemTime().toMicroseconds();
+
+    return static_cast<double>(endCycles - startCycles) / (endTime - startTime);
+}
+
+Util::String formatMicroseconds(double microseconds) {
+    auto integral = static_cast<uint32_t>(microseconds);
+    auto fraction = static_cast<uint32_t>((microseconds - integral) * 1000);
+    return Util::String::format("%u.%03u", integral, fraction);
+}
+
+Util::String getCodeName(uint8_t code) {
+    return code < CODE_COUNT ? Util::String(CODE_NAMES[code]) : Util::String::format("UNKNOWN_%u", code);
+}
+
+/**
+ * Format a record like "[thread] NAME(arguments) = result". Arguments are raw argument slots,
+ * since most system calls pass pointers. Only the first slots are recorded by the kernel.
+ */
+Util::String formatRecord(const Util::Async::SystemCallRecord &record) {
+    auto result = Util::String::format("[%u] ", record.threadId) + getCodeName(record.code) + "(";
+    for (uint32_t i = 0; i < record.paramCount && i < Util::Async::SystemCallRecord::MAX_ARGUMENTS; i++) {
+        result += Util::String::format(i == 0 ? "0x%x" : ", 0x%x", record.arguments[i]);
+    }
+
+    if (record.paramCount > Util::Async::SystemCallRecord::MAX_ARGUMENTS) {
+        result += ", ...";
+    }
+
+    return result + ") = " + (record.result ? "true" : "false");
+}
+
+void printSummary(const CodeSummary *summaries, double cyclesPerMicrosecond) {
+    // Sort codes by total time (insertion sort)
+    auto codes = Util::Array<uint8_t>(CODE_COUNT);
+    for (uint32_t i = 0; i < CODE_COUNT; i++) {
+        auto code = static_cast<uint8_t>(i);
+        auto j = i;
+        while (j > 0 && summaries[codes[j - 1]].totalCycles < summaries[code].totalCycles) {
+            codes[j] = codes[j - 1];
+            j--;
+        }
+
+        codes[j] = code;
+    }
+
+    uint64_t totalCycles = 0;
+    uint32_t totalCalls = 0;
+    for (uint32_t i = 0; i < CODE_COUNT; i++) {
+        totalCycles += summaries[i].totalCycles;
+        totalCalls += summaries[i].calls;
+    }
+
+    Util::System::out << Util::Io::PrintStream::endl << "Time\tTotal (us)\tCalls\tFailed\tAverage (us)\tMax (us)\tSystem call" << Util::Io::PrintStream::endl;
+    for (uint32_t i = 0; i < CODE_COUNT; i++) {
+        const auto &summary = summaries[codes[i]];
+        if (summary.calls == 0) {
+            continue;
+        }
+
+        auto share = totalCycles == 0 ? 0 : static_cast<uint32_t>(static_cast<double>(summary.totalCycles) * 1000 / static_cast<double>(totalCycles));
+        auto total = static_cast<double>(summary.totalCycles) / cyclesPerMicrosecond;
+        Util::System::out << Util::String::format("%u.%u", share / 10, share % 10) << "%\t"
+                          << formatMicroseconds(total) << "\t"
+                          << summary.calls << "\t"
+                          << summary.failed << "\t"
+                          << formatMicroseconds(total / summary.calls) << "\t"
+                          << formatMicroseconds(static_cast<double>(summary.slowest.cycles) / cyclesPerMicrosecond) << "\t"
+                          << getCodeName(codes[i]) << Util::Io::PrintStream::endl;
+    }
+
+    Util::System::out << "Total: " << totalCalls << " calls, " << formatMicroseconds(static_cast<double>(totalCycles) / cyclesPerMicrosecond) << " us"
+                      << Util::Io::PrintStream::endl << Util::Io::PrintStream::endl << "Slowest calls:" << Util::Io::PrintStream::endl;
+
+    for (uint32_t i = 0; i < CODE_COUNT; i++) {
+        const auto &summary = summaries[codes[i]];
+        if (summary.calls > 0) {
+            Util::System::out << formatRecord(summary.slowest) << " <" << formatMicroseconds(static_cast<double>(summary.slowest.cycles) / cyclesPerMicrosecond) << " us>" << Util::Io::PrintStream::endl;
+        }
+    }
+
+    Util::System::out << Util::Io::PrintStream::flush;
+}
+
+int32_t main(int32_t argc, char *argv[]) {
+    auto argumentParser = Util::ArgumentParser();
+    argumentParser.setHelpText("Run a program and show the system calls it issues, including the time spent in each call.\n"
+                               "Arguments are shown as raw values, since most system calls pass pointers.\n"
+                               "A summary with the call count, total time and slowest call per system call is shown at the end.\n"
+                               "Usage: strace [OPTION]... COMMAND [ARGUMENT]...\n"
+                               "Options:\n"
+                               "  -c, --summary: Only show the summary\n"
+                               "  -h, --help: Show this help message");
+
+    argumentParser.addSwitch("summary", "c");
+
+    // Options after the command belong to the traced program
+    int32_t commandIndex = 1;
+    while (commandIndex < argc && argv[commandIndex][0] == '-') {
+        commandIndex++;
+    }
+
+    if (!argumentParser.parse(commandIndex, argv)) {
+        Util::System::error << argumentParser.getErrorString() << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return -1;
+    }
+
+    if (commandIndex >= argc) {
+        Util::System::error << "strace: No command given!" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return -1;
+    }
+
+    auto command = Util::String(argv[commandIndex]);
+    auto binaryPath = findBinary(command);
+    if (binaryPath.isEmpty()) {
+        Util::System::error << "strace: '" << command << "' not found!" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return -1;
+    }
+
+    auto arguments = Util::Array<Util::String>(argc - commandIndex - 1);
+    for (int32_t i = commandIndex + 1; i < argc; i++) {
+        arguments[i - commandIndex - 1] = argv[i];
+    }
+
+    auto summaryOnly = argumentParser.hasArgument("summary");
+    auto cyclesPerMicrosecond = calibrateCyclesPerMicrosecond();
+    auto *summaries = new CodeSummary[CODE_COUNT]{};
+    auto *buffer = new Util::Async::SystemCallRecord[BUFFER_SIZE];
+    uint32_t droppedRecords = 0;
+
+    auto terminal = Util::Io::File("/device/terminal");
+    auto process = Util::Async::Process::execute(Util::Io::File(binaryPath), terminal, terminal, terminal, command, arguments, true);
+
+    bool finished = false;
+    while (!finished) {
+        uint32_t dropped = 0;
+        auto read = process.readSystemCallTrace(buffer, BUFFER_SIZE, dropped, finished);
+        droppedRecords += dropped;
+
+        for (uint32_t i = 0; i < read; i++) {
+            const auto &record = buffer[i];
+            if (record.code < CODE_COUNT) {
+                auto &summary = summaries[record.code];
+                summary.calls++;
+                summary.failed += record.result ? 0 : 1;
+                summary.totalCycles += record.cycles;
+                if (summary.calls == 1 || record.cycles > summary.slowest.cycles) {
+                    summary.slowest = record;
+                }
+            }
+
+            if (!summaryOnly) {
+                Util::System::error << formatRecord(record) << " <" << formatMicroseconds(static_cast<double>(record.cycles) / cyclesPerMicrosecond) << " us>" << Util::Io::PrintStream::endl;
+            }
+        }
+
+        if (!summaryOnly && read > 0) {
+            Util::System::error << Util::Io::PrintStream::flush;
+        }
+
+        // Only wait, if the trace has been drained -> Busy programs are traced without dropping records
+        if (read < BUFFER_SIZE && !finished) {
+            Util::Async::Thread::sleep(Util::Time::Timestamp::ofMilliseconds(POLL_INTERVAL));
+        }
+    }
+
+    printSummary(summaries, cyclesPerMicrosecond);
+    if (droppedRecords > 0) {
+        Util::System::out << "strace: " << droppedRecords << " system calls have not been recorded, because the trace buffer was full!" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+    }
+
+    delete[] summaries;
+    delete[] buffer;
+    return 0;
+}
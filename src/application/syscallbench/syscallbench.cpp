@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include <cstdint>
+#include <cstdarg>
+
+#include "lib/util/base/System.h"
+#include "lib/util/base/ArgumentParser.h"
+#include "lib/util/base/String.h"
+#include "lib/util/hardware/CpuId.h"
+#include "lib/util/io/stream/PrintStream.h"
+
+static const constexpr uint32_t DEFAULT_ITERATIONS = 100000;
+
+uint64_t readTimestampCounter() {
+    uint32_t low;
+    uint32_t high;
+    asm volatile ("rdtsc" : "=a"(low), "=d"(high));
+
+    return (static_cast<uint64_t>(high) << 32) | low;
+}
+
+/**
+ * Issue a system call via 'int 0x86', regardless of the path chosen by Util::System::call().
+ */
+bool interruptCall(Util::System::Code code, uint32_t paramCount...) {
+    va_list args;
+    va_start(args, paramCount);
+    bool result;
+
+    auto eaxValue = static_cast<uint32_t>(code | (paramCount << 8));
+    auto ebxValue = reinterpret_cast<uint32_t>(args);
+    auto ecxValue = reinterpret_cast<uint32_t>(&result);
+
+    asm volatile (
+            "int $0x86;"
+            : :
+            "a"(eaxValue),
+            "b"(ebxValue),
+            "c"(ecxValue)
+            : "memory");
+
+    va_end(args);
+    return result;
+}
+
+uint64_t measureInterruptCalls(uint32_t iterations) {
+    uint32_t threadId;
+    auto start = readTimestampCounter();
+    for (uint32_t i = 0; i < iterations; i++) {
+        interruptCall(Util::System::GET_CURRENT_THREAD, 1, &threadId);
+    }
+
+    return readTimestampCounter() - start;
+}
+
+uint64_t measureSystemCalls(uint32_t iterations) {
+    uint32_t threadId;
+    auto start = readTimestampCounter();
+    for (uint32_t i = 0; i < iterations; i++) {
+        Util::System::call(Util::System::GET_CURRENT_THREAD, 1, &threadId);
+    }
+
+    return readTimestampCounter() - start;
+}
+
+int32_t main(int32_t argc, char *argv[]) {
+    auto argumentParser = Util::ArgumentParser();
+    argumentParser.addArgument("iterations", false, "n");
+    argumentParser.setHelpText("Measure the latency of a null system call via 'int 0x86' and via the default system call path.\n"
+                               "Usage: syscallbench [OPTION]...\n"
+                               "Options:\n"
+                               "  -n, --iterations: Number of system calls per measurement (Default: 100000)\n"
+                               "  -h, --help: Show this help message");
+
+    if (!argumentParser.parse(argc, argv)) {
+        Util::System::error << argumentParser.getErrorString() << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return -1;
+    }
+
+    auto iterations = argumentParser.hasArgument("iterations") ? static_cast<uint32_t>(Util::String::parseInt(argumentParser.getArgument("iterations"))) : DEFAULT_ITERATIONS;
+    if (iterations == 0) {
+        Util::System::error << "syscallbench: Invalid number of iterations!" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return -1;
+    }
+
+    auto fastSystemCalls = Util::Hardware::CpuId::isFastSystemCallSupported();
+    Util::System::out << "Default path: " << (fastSystemCalls ? "sysenter" : "int 0x86") << Util::Io::PrintStream::endl;
+
+    // Warm up caches and TLB, before measuring
+    measureInterruptCalls(iterations / 10 + 1);
+    measureSystemCalls(iterations / 10 + 1);
+
+    auto interruptCycles = measureInterruptCalls(iterations);
+    auto systemCallCycles = measureSystemCalls(iterations);
+
+    Util::System::out << "int 0x86: " << static_cast<uint32_t>(static_cast<double>(interruptCycles) / iterations) << " cycles/call" << Util::Io::PrintStream::endl
+            << (fastSystemCalls ? "sysenter: " : "int 0x86: ") << static_cast<uint32_t>(static_cast<double>(systemCallCycles) / iterations) << " cycles/call" << Util::Io::PrintStream::endl
+            << Util::Io::PrintStream::flush;
+
+    return 0;
+}
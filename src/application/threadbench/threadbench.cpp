@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include <cstdint>
+
+#include "lib/util/base/System.h"
+#include "lib/util/time/Timestamp.h"
+#include "lib/util/async/Runnable.h"
+#include "lib/util/async/Thread.h"
+#include "lib/util/base/ArgumentParser.h"
+#include "lib/util/collection/Array.h"
+#include "lib/util/base/String.h"
+#include "lib/util/io/stream/PrintStream.h"
+
+static const constexpr uint32_t DEFAULT_ITERATIONS = 100;
+static const constexpr uint32_t DEFAULT_BATCH_SIZE = 16;
+
+/**
+ * Empty workload, so that only the cost of creating, scheduling, terminating and joining a thread is measured.
+ */
+class EmptyRunnable : public Util::Async::Runnable {
+
+public:
+
+    void run() override {}
+};
+
+uint32_t getMicroseconds() {
+    return Util::Time::getSystemTime().toMicroseconds();
+}
+
+/**
+ * Create a thread and wait for it to finish, one after another.
+ *
+ * @return The total time in microseconds
+ */
+uint32_t benchmarkSequential(uint32_t iterations) {
+    auto start = getMicroseconds();
+    for (uint32_t i = 0; i < iterations; i++) {
+        Util::Async::Thread::createThread("Bench", new EmptyRunnable()).join();
+    }
+
+    return getMicroseconds() - start;
+}
+
+/**
+ * Create a batch of threads and join them afterwards, so that multiple threads exist at the same time.
+ *
+ * @return The total time in microseconds
+ */
+uint32_t benchmarkBatched(uint32_t iterations, uint32_t batchSize) {
+    auto threadIds = Util::Array<uint32_t>(batchSize);
+
+    auto start = getMicroseconds();
+    for (uint32_t created = 0; created < iterations; created += batchSize) {
+        auto count = iterations - created < batchSize ? iterations - created : batchSize;
+        for (uint32_t i = 0; i < count; i++) {
+            threadIds[i] = Util::Async::Thread::createThread("Bench", new EmptyRunnable()).getId();
+        }
+
+        for (uint32_t i = 0; i < count; i++) {
+            Util::Async::Thread(threadIds[i]).join();
+        }
+    }
+
+    return getMicroseconds() - start;
+}
+
+void printResult(const char *name, uint32_t iterations, uint32_t time) {
+    Util::System::out << name << ": " << time / 1000 << "ms total, " << time / iterations << "us per thread" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+}
+
+int32_t main(int32_t argc, char *argv[]) {
+    auto argumentParser = Util::ArgumentParser();
+    argumentParser.setHelpText("Measure the latency of creating and joining threads.\n"
+                               "Threads are created and joined one after another, as well as in batches.\n"
+                               "Usage: threadbench [ITERATIONS]\n"
+                               "Options:\n"
+                               "  -b, --batch: Amount of threads to create, before joining them (Default: 16)\n"
+                               "  -h, --help: Show this help message");
+
+    argumentParser.addArgument("batch", false, "b");
+
+    if (!argumentParser.parse(argc, argv)) {
+        Util::System::error << argumentParser.getErrorString() << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return -1;
+    }
+
+    auto arguments = argumentParser.getUnnamedArguments();
+    auto iterations = static_cast<uint32_t>(arguments.length() == 0 ? DEFAULT_ITERATIONS : Util::String::parseInt(arguments[0]));
+    auto batchSize = static_cast<uint32_t>(argumentParser.hasArgument("batch") ? Util::String::parseInt(argumentParser.getArgument("batch")) : DEFAULT_BATCH_SIZE);
+    if (iterations == 0 || batchSize == 0) {
+        Util::System::error << "threadbench: Iterations and batch size must be greater than zero!" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return -1;
+    }
+
+    Util::System::out << "Creating and joining " << iterations << " threads sequentially..." << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+    auto sequentialTime = benchmarkSequential(iterations);
+
+    Util::System::out << "Creating and joining " << iterations << " threads in batches of " << batchSize << "..." << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+    auto batchedTime = benchmarkBatched(iterations, batchSize);
+
+    Util::System::out << Util::Io::PrintStream::endl;
+    printResult("Sequential", iterations, sequentialTime);
+    printResult("Batched", iterations, batchedTime);
+
+    return 0;
+}
@@ -0,0 +1,212 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include <cstdint>
+
+#include "lib/util/base/System.h"
+#include "lib/util/io/stream/FileInputStream.h"
+#include "lib/util/base/ArgumentParser.h"
+#include "lib/util/collection/Array.h"
+#include "lib/util/collection/ArrayList.h"
+#include "lib/util/io/file/File.h"
+#include "lib/util/graphic/Ansi.h"
+#include "lib/util/base/String.h"
+#include "lib/util/io/stream/PrintStream.h"
+#include "lib/util/async/Thread.h"
+#include "lib/util/async/FunctionPointerRunnable.h"
+#include "lib/util/time/Timestamp.h"
+
+static const constexpr uint32_t DEFAULT_INTERVAL = 1000;
+
+struct ProcessSample {
+    uint32_t id;
+    Util::String name;
+    uint32_t threadCount;
+    uint64_t cpuCycles;
+    uint32_t voluntarySwitches;
+    uint32_t involuntarySwitches;
+    uint32_t pageFaults;
+    uint32_t systemCalls;
+    double cpuUsage;
+
+    bool operator==(const ProcessSample &other) const {
+        return id == other.id;
+    }
+
+    bool operator!=(const ProcessSample &other) const {
+        return id != other.id;
+    }
+};
+
+bool isRunning = true;
+
+uint64_t readTimestampCounter() {
+    uint32_t low;
+    uint32_t high;
+    asm volatile ("rdtsc" : "=a"(low), "=d"(high));
+
+    return (static_cast<uint64_t>(high) << 32) | low;
+}
+
+Util::String readProcessFile(const Util::String &processPath, const Util::String &name) {
+    auto file = Util::Io::File(processPath + name);
+    if (!file.exists()) {
+        return "";
+    }
+
+    auto stream = Util::Io::FileInputStream(file);
+    return stream.readString(file.getLength() - 1);
+}
+
+uint64_t parseUnsigned(const Util::String &string) {
+    uint64_t value = 0;
+    for (uint32_t i = 0; i < string.length(); i++) {
+        if (string[i] < '0' || string[i] > '9') {
+            break;
+        }
+
+        value = value * 10 + (string[i] - '0');
+    }
+
+    return value;
+}
+
+Util::Array<ProcessSample> takeSamples() {
+    auto processDirectory = Util::Io::File("/process");
+    auto processRootPath = processDirectory.getCanonicalPath();
+    auto samples = Util::ArrayList<ProcessSample>();
+
+    for (const auto &child : processDirectory.getChildren()) {
+        auto processPath = processRootPath + "/" + child + "/";
+        auto name = readProcessFile(processPath, "name");
+        if (name.isEmpty()) {
+            // The process has exited in the meantime
+            continue;
+        }
+
+        samples.add(ProcessSample{
+            static_cast<uint32_t>(Util::String::parseInt(child)),
+            name,
+            static_cast<uint32_t>(parseUnsigned(readProcessFile(processPath, "thread_count"))),
+            parseUnsigned(readProcessFile(processPath, "cpu_cycles")),
+            static_cast<uint32_t>(parseUnsigned(readProcessFile(processPath, "voluntary_switches"))),
+            static_cast<uint32_t>(parseUnsigned(readProcessFile(processPath, "involuntary_switches"))),
+            static_cast<uint32_t>(parseUnsigned(readProcessFile(processPath, "page_faults"))),
+            static_cast<uint32_t>(parseUnsigned(readProcessFile(processPath, "system_calls"))),
+            0
+        });
+    }
+
+    return samples.toArray();
+}
+
+void calculateUsage(Util::Array<ProcessSample> &samples, const Util::Array<ProcessSample> &lastSamples, uint64_t elapsedCycles) {
+    for (auto &sample : samples) {
+        uint64_t lastCycles = 0;
+        for (const auto &lastSample : lastSamples) {
+            if (lastSample.id == sample.id) {
+                lastCycles = lastSample.cpuCycles;
+                break;
+            }
+        }
+
+        auto usedCycles = sample.cpuCycles > lastCycles ? sample.cpuCycles - lastCycles : 0;
+        sample.cpuUsage = elapsedCycles == 0 ? 0 : static_cast<double>(static_cast<int64_t>(usedCycles)) * 100 / static_cast<double>(static_cast<int64_t>(elapsedCycles));
+    }
+
+    // Sort by CPU usage (insertion sort, there are only a few processes)
+    for (uint32_t i = 1; i < samples.length(); i++) {
+        auto sample = samples[i];
+        auto j = i;
+        while (j > 0 && samples[j - 1].cpuUsage < sample.cpuUsage) {
+            samples[j] = samples[j - 1];
+            j--;
+        }
+
+        samples[j] = sample;
+    }
+}
+
+void printSamples(const Util::Array<ProcessSample> &samples) {
+    Util::Graphic::Ansi::clearScreen();
+    Util::Graphic::Ansi::setPosition({0, 0});
+
+    Util::System::out << Util::Graphic::Ansi::FOREGROUND_BRIGHT_YELLOW << "PID\tCPU%\tThreads\tVCSW\tIVCSW\tFaults\tSyscalls\tName"
+                      << Util::Graphic::Ansi::FOREGROUND_DEFAULT << Util::Io::PrintStream::endl;
+
+    for (const auto &sample : samples) {
+        auto usage = static_cast<uint32_t>(sample.cpuUsage * 10);
+        Util::System::out << Util::String::format("%u\t%u.%u\t%u\t%u\t%u\t%u\t%u\t\t",
+                                                  sample.id, usage / 10, usage % 10, sample.threadCount, sample.voluntarySwitches,
+                                                  sample.involuntarySwitches, sample.pageFaults, sample.systemCalls)
+                          << sample.name << Util::Io::PrintStream::endl;
+    }
+
+    Util::System::out << Util::Io::PrintStream::endl << "Press any key to exit" << Util::Io::PrintStream::flush;
+}
+
+int32_t main(int32_t argc, char *argv[]) {
+    auto argumentParser = Util::ArgumentParser();
+    argumentParser.addArgument("interval", false, "i");
+    argumentParser.setHelpText("Periodically show the resource usage of all processes.\n"
+                               "CPU usage is relative to a single CPU, so it may exceed 100% on multiprocessor systems.\n"
+                               "Usage: top\n"
+                               "Options:\n"
+                               "  -i, --interval: Set the refresh interval in milliseconds (Default: 1000)\n"
+                               "  -h, --help: Show this help message");
+
+    if (!argumentParser.parse(argc, argv)) {
+        Util::System::error << argumentParser.getErrorString() << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return -1;
+    }
+
+    uint32_t interval = argumentParser.hasArgument("interval") ? Util::String::parseInt(argumentParser.getArgument("interval")) : DEFAULT_INTERVAL;
+    if (interval == 0) {
+        Util::System::error << "top: Invalid interval!" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return -1;
+    }
+
+    Util::Graphic::Ansi::enableRawMode();
+    Util::Graphic::Ansi::disableCursor();
+
+    Util::Async::Thread::createThread("Key-Listener", new Util::Async::FunctionPointerRunnable([]{
+        Util::System::in.read();
+        isRunning = false;
+    }));
+
+    auto lastSamples = takeSamples();
+    auto lastTimestamp = readTimestampCounter();
+
+    while (isRunning) {
+        Util::Async::Thread::sleep(Util::Time::Timestamp::ofMilliseconds(interval));
+
+        auto samples = takeSamples();
+        auto timestamp = readTimestampCounter();
+        calculateUsage(samples, lastSamples, timestamp - lastTimestamp);
+        printSamples(samples);
+
+        lastSamples = samples;
+        lastTimestamp = timestamp;
+    }
+
+    Util::Graphic::Ansi::enableCursor();
+    Util::Graphic::Ansi::enableCanonicalMode();
+    Util::Graphic::Ansi::clearScreen();
+    Util::Graphic::Ansi::setPosition({0, 0});
+
+    return 0;
+}
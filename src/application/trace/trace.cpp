@@ -0,0 +1,321 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include <cstdint>
+
+#include "lib/util/base/System.h"
+#include "lib/util/base/ArgumentParser.h"
+#include "lib/util/base/String.h"
+#include "lib/util/async/Thread.h"
+#include "lib/util/collection/HashMap.h"
+#include "lib/util/io/stream/FileInputStream.h"
+#include "lib/util/io/stream/FileOutputStream.h"
+#include "lib/util/io/stream/PrintStream.h"
+#include "lib/util/time/Timestamp.h"
+
+static const constexpr char *TRACE_PATH = "/device/trace";
+static const constexpr uint32_t CALIBRATION_TIME = 100;
+static const constexpr uint32_t MAX_INTERRUPT_DEPTH = 16;
+static const constexpr uint32_t MAX_CPUS = 256;
+
+/**
+ * Layout of the records, read from /device/trace (see Kernel::Trace::Record).
+ */
+struct Record {
+    uint32_t sequence;
+    uint16_t event;
+    uint8_t cpuId;
+    uint8_t reserved;
+    uint64_t timestamp;
+    uint32_t threadId;
+    uint32_t arguments[2];
+    uint32_t padding;
+};
+
+/**
+ * Events in the order of Kernel::Trace::Event.
+ */
+enum Event : uint16_t {
+    THREAD_SWITCH, SYSTEM_CALL_ENTER, SYSTEM_CALL_EXIT, PAGE_FAULT, INTERRUPT_ENTER, INTERRUPT_EXIT, PACKET_RECEIVE, PACKET_TRANSMIT, EVENT_COUNT
+};
+
+static const char *eventNames[EVENT_COUNT] = {
+        "thread_switch", "syscall_enter", "syscall_exit", "page_fault", "interrupt_enter", "interrupt_exit", "packet_receive", "packet_transmit"
+};
+
+struct Slice {
+    uint32_t id;
+    double start;
+
+    bool operator!=(const Slice &other) const {
+        return id != other.id || start != other.start;
+    }
+};
+
+/**
+ * State of a CPU, while converting a trace into the Chrome format.
+ * Interrupts that are still open, when the CPU switches to another thread, are closed at the switch.
+ */
+struct CpuTimeline {
+    bool threadRunning;
+    Slice thread;
+    uint32_t interruptDepth;
+    Slice interrupts[MAX_INTERRUPT_DEPTH];
+};
+
+uint64_t readTimestampCounter() {
+    uint32_t low;
+    uint32_t high;
+    asm volatile ("rdtsc" : "=a"(low), "=d"(high));
+
+    return (static_cast<uint64_t>(high) << 32) | low;
+}
+
+/**
+ * Trace records carry raw time stamp counter values, which are converted using a short calibration.
+ */
+double calibrateCyclesPerMicrosecond() {
+    auto startTime = Util::Time::getSystemTime().toMicroseconds();
+    auto startCycles = readTimestampCounter();
+    Util::Async::Thread::sleep(Util::Time::Timestamp::ofMilliseconds(CALIBRATION_TIME));
+    auto endCycles = readTimestampCounter();
+    auto endTime = Util::Time::getSystemTime().toMicroseconds();
+
+    return static_cast<double>(endCycles - startCycles) / (endTime - startTime);
+}
+
+Util::String formatMicroseconds(double microseconds) {
+    auto integral = static_cast<uint32_t>(microseconds);
+    auto fraction = static_cast<uint32_t>((microseconds - integral) * 1000);
+    return Util::String::format("%u.%03u", integral, fraction);
+}
+
+const char* getEventName(uint16_t event) {
+    return event < EVENT_COUNT ? eventNames[event] : "unknown";
+}
+
+Util::String formatArguments(const Record &record) {
+    switch (record.event) {
+        case THREAD_SWITCH:
+            return Util::String::format("%u -> %u", record.arguments[0], record.arguments[1]);
+        case SYSTEM_CALL_ENTER:
+            return Util::String::format("code=%u", record.arguments[0]);
+        case SYSTEM_CALL_EXIT:
+            return Util::String::format("code=%u, result=%u", record.arguments[0], record.arguments[1]);
+        case PAGE_FAULT:
+            return Util::String::format("address=0x%08x, error=0x%x", record.arguments[0], record.arguments[1]);
+        case INTERRUPT_ENTER:
+        case INTERRUPT_EXIT:
+            return Util::String::format("vector=%u", record.arguments[0]);
+        case PACKET_RECEIVE:
+        case PACKET_TRANSMIT:
+            return Util::String::format("length=%u", record.arguments[0]);
+        default:
+            return Util::String::format("0x%08x, 0x%08x", record.arguments[0], record.arguments[1]);
+    }
+}
+
+void setEvents(const Util::String &events) {
+    auto stream = Util::Io::FileOutputStream(TRACE_PATH);
+    stream.write(static_cast<const uint8_t*>(events), 0, events.length());
+}
+
+class TextWriter {
+
+public:
+
+    void write(const Record &record, double time) {
+        Util::System::out << formatMicroseconds(time) << "\tcpu" << static_cast<uint32_t>(record.cpuId) << "\t" << record.threadId << "\t"
+                          << getEventName(record.event) << "\t" << formatArguments(record) << Util::Io::PrintStream::endl;
+    }
+
+    void finish(double time) {
+        Util::System::out << Util::Io::PrintStream::flush;
+    }
+};
+
+/**
+ * Write the trace in the Chrome trace event format, which can be viewed with chrome://tracing or Perfetto.
+ * Threads and interrupts are shown per CPU (process 0), system calls per thread (process 1).
+ */
+class ChromeWriter {
+
+public:
+
+    ChromeWriter() : cpus(new CpuTimeline[MAX_CPUS]{}) {
+        Util::System::out << "{\"traceEvents\":[";
+    }
+
+    ~ChromeWriter() {
+        delete[] cpus;
+    }
+
+    void write(const Record &record, double time) {
+        auto &cpu = cpus[record.cpuId];
+
+        switch (record.event) {
+            case THREAD_SWITCH:
+                while (cpu.interruptDepth > 0) {
+                    auto &interrupt = cpu.interrupts[--cpu.interruptDepth];
+                    writeSlice(Util::String::format("interrupt %u", interrupt.id), 0, record.cpuId, interrupt.start, time);
+                }
+
+                if (cpu.threadRunning) {
+                    writeSlice(Util::String::format("thread %u", cpu.thread.id), 0, record.cpuId, cpu.thread.start, time);
+                }
+
+                cpu.threadRunning = true;
+                cpu.thread = Slice{record.arguments[1], time};
+                break;
+            case INTERRUPT_ENTER:
+                if (cpu.interruptDepth < MAX_INTERRUPT_DEPTH) {
+                    cpu.interrupts[cpu.interruptDepth++] = Slice{record.arguments[0], time};
+                }
+                break;
+            case INTERRUPT_EXIT:
+                // Interrupts, that have been entered before the trace started, are ignored
+                if (cpu.interruptDepth > 0 && cpu.interrupts[cpu.interruptDepth - 1].id == record.arguments[0]) {
+                    auto &interrupt = cpu.interrupts[--cpu.interruptDepth];
+                    writeSlice(Util::String::format("interrupt %u", interrupt.id), 0, record.cpuId, interrupt.start, time);
+                }
+                break;
+            case SYSTEM_CALL_ENTER:
+                systemCalls.put(record.threadId, Slice{record.arguments[0], time});
+                break;
+            case SYSTEM_CALL_EXIT:
+                if (systemCalls.containsKey(record.threadId)) {
+                    auto systemCall = systemCalls.remove(record.threadId);
+                    writeSlice(Util::String::format("syscall %u", systemCall.id), 1, record.threadId, systemCall.start, time);
+                }
+                break;
+            default:
+                writeSeparator();
+                Util::System::out << "{\"name\":\"" << getEventName(record.event) << "\",\"ph\":\"i\",\"s\":\"t\",\"pid\":0,\"tid\":" << static_cast<uint32_t>(record.cpuId)
+                                  << ",\"ts\":" << formatMicroseconds(time) << ",\"args\":{\"thread\":" << record.threadId
+                                  << ",\"detail\":\"" << formatArguments(record) << "\"}}";
+        }
+    }
+
+    void finish(double time) {
+        for (uint32_t i = 0; i < MAX_CPUS; i++) {
+            auto &cpu = cpus[i];
+            while (cpu.interruptDepth > 0) {
+                auto &interrupt = cpu.interrupts[--cpu.interruptDepth];
+                writeSlice(Util::String::format("interrupt %u", interrupt.id), 0, i, interrupt.start, time);
+            }
+
+            if (cpu.threadRunning) {
+                writeSlice(Util::String::format("thread %u", cpu.thread.id), 0, i, cpu.thread.start, time);
+            }
+        }
+
+        Util::System::out << "]}" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+    }
+
+private:
+
+    void writeSeparator() {
+        if (!first) {
+            Util::System::out << ",";
+        }
+
+        first = false;
+    }
+
+    void writeSlice(const Util::String &name, uint32_t processId, uint32_t threadId, double start, double end) {
+        writeSeparator();
+        Util::System::out << "{\"name\":\"" << name << "\",\"ph\":\"X\",\"pid\":" << processId << ",\"tid\":" << threadId
+                          << ",\"ts\":" << formatMicroseconds(start) << ",\"dur\":" << formatMicroseconds(end - start) << "}";
+    }
+
+    bool first = true;
+    CpuTimeline *cpus;
+    Util::HashMap<uint32_t, Slice> systemCalls;
+};
+
+/**
+ * Drain the trace ring and pass each record with its time (in microseconds, relative to the first record) to the writer.
+ *
+ * @return The number of records
+ */
+template<typename Writer>
+uint32_t convert(Writer &writer, double cyclesPerMicrosecond) {
+    auto stream = Util::Io::FileInputStream(TRACE_PATH);
+    auto *buffer = new Record[256];
+    uint64_t firstTimestamp = 0;
+    double time = 0;
+    uint32_t total = 0;
+
+    int32_t read;
+    while ((read = stream.read(reinterpret_cast<uint8_t*>(buffer), 0, 256 * sizeof(Record))) > 0) {
+        for (uint32_t i = 0; i < read / sizeof(Record); i++) {
+            const auto &record = buffer[i];
+            if (total++ == 0) {
+                firstTimestamp = record.timestamp;
+            }
+
+            // Records from different CPUs may be slightly out of order
+            time = record.timestamp > firstTimestamp ? static_cast<double>(record.timestamp - firstTimestamp) / cyclesPerMicrosecond : 0;
+            writer.write(record, time);
+        }
+    }
+
+    writer.finish(time);
+    delete[] buffer;
+    return total;
+}
+
+int32_t main(int32_t argc, char *argv[]) {
+    auto argumentParser = Util::ArgumentParser();
+    argumentParser.setHelpText("Control the kernel tracepoints and convert recorded events into a readable timeline.\n"
+                               "Without options, the recorded events are removed from '/device/trace' and printed as text.\n"
+                               "Events: thread_switch, syscall_enter, syscall_exit, page_fault, interrupt_enter, interrupt_exit, packet_receive, packet_transmit\n"
+                               "Usage: trace [OPTION]...\n"
+                               "Options:\n"
+                               "  -e, --enable: Set the recorded events (comma separated list, 'all' or 'none')\n"
+                               "  -c, --chrome: Output the events in the Chrome trace event format (JSON)\n"
+                               "  -h, --help: Show this help message");
+
+    argumentParser.addArgument("enable", false, "e");
+    argumentParser.addSwitch("chrome", "c");
+
+    if (!argumentParser.parse(argc, argv)) {
+        Util::System::error << argumentParser.getErrorString() << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return -1;
+    }
+
+    if (argumentParser.hasArgument("enable")) {
+        setEvents(argumentParser.getArgument("enable"));
+        return 0;
+    }
+
+    auto cyclesPerMicrosecond = calibrateCyclesPerMicrosecond();
+    uint32_t count;
+    if (argumentParser.checkSwitch("chrome")) {
+        auto writer = ChromeWriter();
+        count = convert(writer, cyclesPerMicrosecond);
+    } else {
+        auto writer = TextWriter();
+        count = convert(writer, cyclesPerMicrosecond);
+    }
+
+    if (count == 0) {
+        Util::System::error << "trace: No events recorded!" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+    }
+
+    return 0;
+}
@@ -28,6 +28,7 @@
 #include "kernel/process/ThreadState.h"
 #include "kernel/service/SchedulerService.h"
 #include "kernel/system/TaskStateSegment.h"
+#include "kernel/system/SystemCall.h"
 #include "device/bios/SmBios.h"
 
 // Import functions
@@ -49,6 +50,7 @@ void bootstrap_paging(uint32_t*, uint32_t*);
 void enable_interrupts();
 void disable_interrupts();
 void dispatch_interrupt(Kernel::InterruptFrame*);
+void dispatch_fast_system_call(Kernel::InterruptFrame*);
 void set_tss_stack_entry(uint32_t);
 void flush_tss();
 void release_scheduler_lock();
@@ -108,9 +110,20 @@ void dispatch_interrupt(Kernel::InterruptFrame *frame) {
     }
 }
 
+void dispatch_fast_system_call(Kernel::InterruptFrame *frame) {
+    Kernel::SystemCall::handleFastSystemCall(*frame);
+}
+
 void set_tss_stack_entry(uint32_t esp0) {
-    Kernel::System::getTaskStateSegment().esp0 = esp0 + sizeof(Kernel::InterruptFrame);
-    Kernel::System::getTaskStateSegment().ss0 = 0x10;
+    auto &taskStateSegment = Kernel::System::getTaskStateSegment();
+    auto stack = esp0 + sizeof(Kernel::InterruptFrame);
+    if (taskStateSegment.esp0 == stack) {
+        return;
+    }
+
+    taskStateSegment.esp0 = stack;
+    taskStateSegment.ss0 = 0x10;
+    Kernel::SystemCall::setKernelStack(stack);
 }
 
 void release_scheduler_lock() {
@@ -46,7 +46,9 @@ void load_page_directory(uint32_t*);
 void enable_system_paging();
 void bios_call();
 void interrupt_return();
+void system_call_entry();
 void start_first_thread(Kernel::Context *thread);
+[[noreturn]] void start_application_processor_thread(Kernel::Context *thread);
 void switch_context(Kernel::Context **current, Kernel::Context **next);
 [[noreturn]] void on_exception(uint32_t);
 [[nodiscard]] int32_t is_cpuid_available();
@@ -212,6 +212,10 @@ on_paging_enabled:
     ; Load GDT from virtual address
     lgdt [gdt_descriptor]
 
+    ; Load the per-cpu data segment (its base address is only valid with paging enabled)
+    mov ax, 0x30
+    mov gs, ax
+
     ; Set esp to initial kernel stack
     mov esp, (initial_kernel_stack + STACK_SIZE)
 
@@ -265,7 +269,7 @@ section .data
 
 ; Global descriptor table
 gdt:
-    times (6 * 8) db 0
+    times (7 * 8) db 0
 
 ; Global descriptor table for bios calls
 gdt_bios:
@@ -22,7 +22,7 @@
 #include "device/cpu/Cpu.h"
 #include "kernel/system/System.h"
 #include "lib/util/base/Exception.h"
-#include "lib/util/async/Spinlock.h"
+#include "lib/util/async/Mutex.h"
 #include "lib/util/base/String.h"
 #include "device/time/Cmos.h"
 #include "kernel/service/InterruptService.h"
@@ -31,7 +31,7 @@
 
 namespace Device {
 
-Util::Async::Spinlock Bios::interruptLock;
+Util::Async::Mutex Bios::interruptLock;
 
 uint16_t Bios::construct16BitRegister(uint8_t lowerValue, uint8_t higherValue) {
     return lowerValue | (higherValue << 8);
@@ -22,7 +22,7 @@
 
 namespace Util {
 namespace Async {
-class Spinlock;
+class Mutex;
 }  // namespace Async
 }  // namespace Util
 
@@ -106,7 +106,7 @@ public:
 
 private:
 
-    static Util::Async::Spinlock interruptLock;
+    static Util::Async::Mutex interruptLock;
 };
 
 }
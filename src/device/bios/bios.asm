@@ -42,6 +42,8 @@ bios_call:
     ; Safe registers
     pushfd
     pushad
+    ; The per-cpu data segment is overwritten by the 16-bit code
+    push gs
 
     ; Check if the scheduler is running (we have to switch the stack then,
     ; because bios calls expect the stack to be placed at 4MB)
@@ -143,6 +145,7 @@ skip_stack_switch_2:
     and ecx, 0xffffffef
     mov cr4, ecx
     ; Restore old register values
+    pop gs
     popad
     popfd
     ; Load old IDT
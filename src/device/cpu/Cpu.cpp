@@ -20,6 +20,7 @@
 #include "Cpu.h"
 #include "lib/util/async/Atomic.h"
 #include "lib/util/collection/ArrayList.h"
+#include "kernel/system/PerCpu.h"
 
 namespace Device {
 
@@ -40,11 +41,11 @@ const char *Cpu::softwareExceptions[]{
         "PagingError Exception", "UnsupportedOperation Exception"
 };
 
-int32_t Cpu::cliCount = 1; // Interrupts are disabled on startup
-
 void Cpu::enableInterrupts() {
-    auto cliCountWrapper = Util::Async::Atomic<int32_t>(cliCount);
-    int count = cliCountWrapper.fetchAndDec();
+    // Keeps track of how often disableInterrupts() and enableInterrupts() have been called on this CPU.
+    // Interrupts are still disabled at this point, so the calling thread cannot be migrated to another CPU.
+    auto count = Kernel::CpuLocal::cliCount.get();
+    Kernel::CpuLocal::cliCount.set(count - 1);
 
     if (count == 1) {
         // nmiCount has been decreased to 0 -> Enable interrupts
@@ -56,18 +57,42 @@ void Cpu::enableInterrupts() {
 }
 
 void Cpu::disableInterrupts() {
-    auto cliCountWrapper = Util::Async::Atomic<int32_t>(cliCount);
-    int count = cliCountWrapper.fetchAndInc();
+    // Disable interrupts first, so that the calling thread cannot be migrated to another CPU before its counter is updated
+    asm volatile ( "cli" );
+
+    auto count = Kernel::CpuLocal::cliCount.get();
+    Kernel::CpuLocal::cliCount.set(count + 1);
 
-    if (count == 0) {
-        // nmiCount has been increased from 0 to 1 -> Disable interrupts
-        asm volatile ( "cli" );
-    } else if (count < 0) {
+    if (count < 0) {
         // nmiCount is negative -> Illegal state
         Util::Exception::throwException(Util::Exception::ILLEGAL_STATE, "CPU: nmiCount is less than 0!");
     }
 }
 
+uint32_t Cpu::saveAndDisableInterrupts() {
+    uint32_t flags;
+    asm volatile (
+            "pushf;"
+            "pop %0;"
+            "cli;"
+            : "=r"(flags)
+            :
+            : "memory"
+            );
+
+    return flags;
+}
+
+void Cpu::restoreInterrupts(uint32_t flags) {
+    asm volatile (
+            "push %0;"
+            "popf;"
+            :
+            : "r"(flags)
+            : "memory", "cc"
+            );
+}
+
 void Cpu::halt() {
     asm volatile ( "cli\n"
                    "hlt"
@@ -75,6 +100,26 @@ void Cpu::halt() {
     __builtin_unreachable();
 }
 
+void Cpu::enableInterruptsAndHalt() {
+    asm volatile ( "sti\n"
+                   "hlt"
+                   : : : "memory"
+    );
+}
+
+void Cpu::monitor(const volatile void *address) {
+    asm volatile ( "monitor"
+                   : : "a"(address), "c"(0), "d"(0) : "memory"
+    );
+}
+
+void Cpu::enableInterruptsAndWait() {
+    asm volatile ( "sti\n"
+                   "mwait"
+                   : : "a"(0), "c"(0) : "memory"
+    );
+}
+
 void Cpu::throwException(Util::Exception::Error error, const char *message) {
     disableInterrupts();
     Util::System::errorMessage = message;
@@ -111,4 +156,12 @@ Util::Array<Cpu::Configuration0> Cpu::readCr0() {
     return cr0.toArray();
 }
 
+uint64_t Cpu::readTimestampCounter() {
+    uint32_t low;
+    uint32_t high;
+    asm volatile ("rdtsc" : "=a"(low), "=d"(high));
+
+    return (static_cast<uint64_t>(high) << 32) | low;
+}
+
 }
\ No newline at end of file
@@ -87,13 +87,47 @@ public:
      */
     static void disableInterrupts();
 
+    /**
+     * Disable hardware interrupts and return the previous EFLAGS register, without using the nesting counter.
+     * Intended for short critical sections, that may also be entered with interrupts already disabled.
+     */
+    static uint32_t saveAndDisableInterrupts();
+
+    /**
+     * Restore the interrupt flag, that has been saved by saveAndDisableInterrupts().
+     */
+    static void restoreInterrupts(uint32_t flags);
+
     static Util::Array<Configuration0> readCr0();
 
+    /**
+     * Read the time stamp counter, which is incremented with every clock cycle.
+     */
+    static uint64_t readTimestampCounter();
+
     /**
      * Stop the processor via hlt instruction.
      */
     [[noreturn]] static void halt();
 
+    /**
+     * Enable interrupts and halt the processor until the next interrupt arrives.
+     * Interrupts are only recognized after the instruction following sti, so an interrupt,
+     * that becomes pending after the caller has checked for work with interrupts disabled, still ends the halt.
+     */
+    static void enableInterruptsAndHalt();
+
+    /**
+     * Arm the address monitoring hardware for the cache line containing the given address (monitor instruction).
+     */
+    static void monitor(const volatile void *address);
+
+    /**
+     * Enable interrupts and wait for a write to the monitored address or an interrupt (mwait instruction).
+     * Like enableInterruptsAndHalt(), no interrupt can be missed in between.
+     */
+    static void enableInterruptsAndWait();
+
     /**
      * Enumeration of all hardware exceptions
      */
@@ -147,12 +181,6 @@ private:
     // Pointers to lists with hardware (software) exceptions
     static const char *hardwareExceptions[];
     static const char *softwareExceptions[];
-
-    /**
-     * Keeps track of how often disableInterrupts() and enableInterrupts() have been called.
-     * Interrupts stay disabled, as long as this number is greater than zero.
-     */
-    static int32_t cliCount;
 };
 
 }
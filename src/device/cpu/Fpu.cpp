@@ -17,6 +17,7 @@
 
 #include "kernel/service/InterruptService.h"
 #include "kernel/system/System.h"
+#include "kernel/system/PerCpu.h"
 #include "lib/util/hardware/CpuId.h"
 #include "Cpu.h"
 #include "Fpu.h"
@@ -37,16 +38,7 @@ namespace Device {
 Kernel::Logger Fpu::log = Kernel::Logger::get("FPU");
 
 Fpu::Fpu(const uint8_t *defaultFpuContext) {
-    disarmFpuMonitor();
-
-    // Make sure FPU emulation is disabled
-    asm volatile (
-            "mov %%cr0, %%eax;"
-            "and $0xfffffffb, %%eax;"
-            "mov %%eax, %%cr0;"
-            : : :
-            "eax"
-            );
+    configureCurrentProcessor();
 
     if (Device::Fpu::isFxsrAvailable()) {
         log.info("FXSR support detected -> Using FXSAVE/FXRSTR for FPU context switching");
@@ -58,17 +50,9 @@ Fpu::Fpu(const uint8_t *defaultFpuContext) {
 
         if (features.contains(Util::Hardware::CpuId::SSE)) {
             log.info("SSE support detected -> Activating OSFXSR and OSXMMEXCPT");
-            asm volatile (
-                    "mov %%cr4, %%eax;"
-                    "or $0x00000600, %%eax;"
-                    "mov %%eax, %%cr4;"
-                    : : :
-                    "eax"
-                    );
         }
 
         asm volatile (
-                "fninit;"
                 "fxsave (%0);"
                 : :
                 "r"(defaultFpuContext)
@@ -76,7 +60,6 @@ Fpu::Fpu(const uint8_t *defaultFpuContext) {
     } else {
         log.info("FXSR is not supported -> Falling back to FNSAVE/FRSTR for FPU context switching");
         asm volatile (
-                "fninit;"
                 "fnsave (%0);"
                 : :
                 "r"(defaultFpuContext)
@@ -84,36 +67,68 @@ Fpu::Fpu(const uint8_t *defaultFpuContext) {
     }
 }
 
+void Fpu::configureCurrentProcessor() {
+    disarmFpuMonitor();
+
+    // Make sure FPU emulation is disabled
+    asm volatile (
+            "mov %%cr0, %%eax;"
+            "and $0xfffffffb, %%eax;"
+            "mov %%eax, %%cr0;"
+            : : :
+            "eax"
+            );
+
+    if (isFxsrAvailable() && Util::Hardware::CpuId::getCpuFeatures().contains(Util::Hardware::CpuId::SSE)) {
+        asm volatile (
+                "mov %%cr4, %%eax;"
+                "or $0x00000600, %%eax;"
+                "mov %%eax, %%cr4;"
+                : : :
+                "eax"
+                );
+    }
+
+    asm volatile ("fninit");
+}
+
 void Fpu::plugin() {
     Kernel::System::getService<Kernel::InterruptService>().assignInterrupt(Kernel::InterruptVector::DEVICE_NOT_AVAILABLE, *this);
 }
 
 void Fpu::trigger(const Kernel::InterruptFrame &frame) {
     auto &schedulerService = Kernel::System::getService<Kernel::SchedulerService>();
+    auto cpuId = Kernel::CpuLocal::cpuId.get();
     schedulerService.lockScheduler();
 
     // Disable FPU monitoring (will be enabled by scheduler at next thread switch)
     disarmFpuMonitor();
 
     auto &currentThread = schedulerService.getCurrentThread();
-    if (&currentThread == lastFpuThread) {
+    if (&currentThread == lastFpuThreads[cpuId]) {
         schedulerService.unlockScheduler();
         return;
     }
 
     if (fxsrAvailable) {
-        switchContext(currentThread);
+        switchContext(currentThread, cpuId);
     } else {
-        switchContextFpuOnly(currentThread);
+        switchContextFpuOnly(currentThread, cpuId);
     }
 
-    lastFpuThread = &currentThread;
+    lastFpuThreads[cpuId] = &currentThread;
     schedulerService.unlockScheduler();
 }
 
 void Fpu::checkTerminatedThread(Kernel::Thread &thread) {
-    Util::Async::Atomic<uint32_t> wrapper(reinterpret_cast<uint32_t&>(lastFpuThread));
-    wrapper.compareAndSet(reinterpret_cast<uint32_t>(&thread), 0);
+    for (auto &lastFpuThread : lastFpuThreads) {
+        Util::Async::Atomic<uint32_t> wrapper(reinterpret_cast<uint32_t&>(lastFpuThread));
+        wrapper.compareAndSet(reinterpret_cast<uint32_t>(&thread), 0);
+    }
+}
+
+bool Fpu::isContextLoaded(const Kernel::Thread &thread, uint8_t cpuId) const {
+    return lastFpuThreads[cpuId] == &thread;
 }
 
 bool Fpu::isAvailable() {
@@ -154,12 +169,12 @@ bool Fpu::probeFpu() {
     return fpuStatus == 0;
 }
 
-void Fpu::switchContext(Kernel::Thread &currentThread) {
-    if (lastFpuThread != nullptr) {
+void Fpu::switchContext(Kernel::Thread &currentThread, uint8_t cpuId) {
+    if (lastFpuThreads[cpuId] != nullptr) {
         asm volatile (
                 "fxsave (%0)"
                 : :
-                "r"(lastFpuThread->getFpuContext())
+                "r"(lastFpuThreads[cpuId]->getFpuContext())
                 );
     }
 
@@ -170,12 +185,12 @@ void Fpu::switchContext(Kernel::Thread &currentThread) {
             );
 }
 
-void Fpu::switchContextFpuOnly(Kernel::Thread &currentThread) {
-    if (lastFpuThread != nullptr) {
+void Fpu::switchContextFpuOnly(Kernel::Thread &currentThread, uint8_t cpuId) {
+    if (lastFpuThreads[cpuId] != nullptr) {
         asm volatile (
                 "fnsave (%0)"
                 : :
-                "r"(lastFpuThread->getFpuContext())
+                "r"(lastFpuThreads[cpuId]->getFpuContext())
                 );
     }
 
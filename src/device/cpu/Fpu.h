@@ -59,24 +59,36 @@ public:
 
     void checkTerminatedThread(Kernel::Thread &thread);
 
+    /**
+     * Check if the FPU state of a thread is still held in the registers of a CPU.
+     * Such a thread must not be migrated to another CPU.
+     */
+    [[nodiscard]] bool isContextLoaded(const Kernel::Thread &thread, uint8_t cpuId) const;
+
     static bool isAvailable();
 
     static bool isFxsrAvailable();
 
+    /**
+     * Disable FPU emulation, enable SSE (if available) and initialize the FPU of the calling CPU.
+     * Needs to be called once on every CPU.
+     */
+    static void configureCurrentProcessor();
+
     static void armFpuMonitor();
 
     static void disarmFpuMonitor();
 
 private:
 
-    void switchContext(Kernel::Thread &currentThread);
+    void switchContext(Kernel::Thread &currentThread, uint8_t cpuId);
 
-    void switchContextFpuOnly(Kernel::Thread &currentThread);
+    void switchContextFpuOnly(Kernel::Thread &currentThread, uint8_t cpuId);
 
     static bool probeFpu();
 
     bool fxsrAvailable = isFxsrAvailable();
-    Kernel::Thread *lastFpuThread = nullptr;
+    Kernel::Thread *lastFpuThreads[256]{}; // Indexed by local APIC id
 
     static Kernel::Logger log;
 };
@@ -156,6 +156,8 @@ boot_ap_32:
     lgdt [eax]
     mov ax, 0x28
     ltr ax
+    mov ax, 0x30 ; Per-cpu data segment
+    mov gs, ax
 
     ; Load the correct stack for this AP
     mov ebx, [boot_ap_stacks - boot_ap + startup_address] ; Stackpointer array
@@ -24,6 +24,12 @@
 #include "device/interrupt/apic/Apic.h"
 #include "kernel/system/System.h"
 #include "kernel/service/InterruptService.h"
+#include "kernel/service/MemoryService.h"
+#include "kernel/service/SchedulerService.h"
+#include "kernel/system/SystemCall.h"
+#include "device/cpu/Cpu.h"
+#include "device/cpu/Fpu.h"
+#include "lib/util/async/Spinlock.h"
 
 namespace Device {
 
@@ -31,17 +37,43 @@ volatile bool runningApplicationProcessors[256]{}; // Once an AP is running it s
 
 Kernel::Logger log = Kernel::Logger::get("SMP");
 
+Util::Async::Spinlock bringUpLock;
+
 [[noreturn]] void applicationProcessorEntry(uint8_t initializedApplicationProcessorsCounter) {
     runningApplicationProcessors[initializedApplicationProcessorsCounter] = true; // Mark this AP as running
-    while (true) {}
 
-    // Initialize this AP's APIC
     auto &interruptService = Kernel::System::getService<Kernel::InterruptService>();
+    while (!interruptService.isParallelComputingAllowed()) {}
+
+    // The APs are brought up one after another, because the APIC and interrupt handler structures are not synchronized
+    bringUpLock.acquire();
+
+    // Initialize this AP's APIC
     auto &apic = interruptService.getApic();
     apic.initializeCurrentLocalApic();
     apic.enableCurrentErrorHandler();
 
-    while (!interruptService.isParallelComputingAllowed()) {}
+    if (Fpu::isAvailable()) {
+        Fpu::configureCurrentProcessor();
+    }
+
+    Kernel::SystemCall::initializeFastSystemCalls();
+
+    // Pages may have been unmapped, while this AP was waiting -> Flush the whole TLB before joining shootdowns
+    Kernel::System::getService<Kernel::MemoryService>().getTlbShootdownHandler().addCurrentProcessor();
+    asm volatile (
+            "mov %%cr3, %%eax;"
+            "mov %%eax, %%cr3;"
+            : : :
+            "eax", "memory"
+            );
+
+    apic.startCurrentTimer();
+    log.info("CPU [%u] is joining the scheduler", LocalApic::getId());
+    bringUpLock.release();
+
+    Cpu::enableInterrupts();
+    Kernel::System::getService<Kernel::SchedulerService>().startApplicationProcessor();
 }
 
 }
\ No newline at end of file
@@ -27,12 +27,15 @@
 #include "kernel/interrupt/InterruptVector.h"
 #include "kernel/system/System.h"
 #include "kernel/service/MemoryService.h"
+#include "kernel/service/InterruptService.h"
 #include "lib/util/base/Constants.h"
 #include "kernel/paging/Paging.h"
 #include "kernel/system/TaskStateSegment.h"
+#include "kernel/system/PerCpu.h"
 #include "device/interrupt/apic/IoApic.h"
 #include "device/interrupt/apic/LocalApic.h"
 #include "device/interrupt/apic/LocalApicErrorHandler.h"
+#include "device/interrupt/apic/LocalApicWakeupHandler.h"
 #include "kernel/log/Logger.h"
 #include "lib/util/base/Address.h"
 #include "lib/util/base/Exception.h"
@@ -95,6 +98,7 @@ Apic* Apic::initialize() {
     // We only require one error handler, as every AP can only access its own local APIC's error register
     apic->errorHandler.plugin();
     apic->enableCurrentErrorHandler();
+    apic->wakeupHandler.plugin();
 
     ApicTimer::calibrate();
     apic->startCurrentTimer();
@@ -140,9 +144,9 @@ bool Apic::status(InterruptRequest interruptRequest) {
 }
 
 void Apic::sendEndOfInterrupt(Kernel::InterruptVector vector) {
-    if (isLocalInterrupt(vector) && vector != Kernel::InterruptVector::LINT1) {
+    if (isLocalInterrupt(vector) && vector != Kernel::InterruptVector::LINT1 && vector != Kernel::InterruptVector::APICTIMER) {
         // Excludes NMI, IPIs and SMIs are also excluded, but these don't have vector numbers,
-        // so they won't reach this anyway.
+        // so they won't reach this anyway. The APIC timer is acknowledged by its handler (see ApicTimer::trigger()).
         LocalApic::sendEndOfInterrupt();
     } else if (isExternalInterrupt(vector)) {
         // Edge-triggered external interrupts have to be EOId in the local APIC,
@@ -155,7 +159,7 @@ void Apic::sendEndOfInterrupt(Kernel::InterruptVector vector) {
 }
 
 bool Apic::isLocalInterrupt(Kernel::InterruptVector vector) const {
-    return vector >= Kernel::InterruptVector::CMCI && vector <= Kernel::InterruptVector::ERROR;
+    return vector >= Kernel::InterruptVector::WAKEUP && vector <= Kernel::InterruptVector::ERROR;
 }
 
 bool Apic::isExternalInterrupt(Kernel::InterruptVector vector) const {
@@ -299,7 +303,7 @@ void Apic::startCurrentTimer() {
         return;
     }
 
-    auto *apicTimer = new Device::ApicTimer(10, 10);
+    auto *apicTimer = ApicTimer::isTicklessModeEnabled() ? new Device::ApicTimer() : new Device::ApicTimer(10, 10);
     apicTimer->plugin();
     localTimers.put(LocalApic::getId(), apicTimer);
 }
@@ -441,26 +445,38 @@ void *Apic::prepareApplicationProcessorGdts() {
     // Allocate descriptor pointer array
     auto **gdts = reinterpret_cast<Cpu::Descriptor**>(new Cpu::Descriptor*[localApics.size() - 1]); // Skip BSP
 
-    for (uint32_t i = 0; i < localApics.size() - 1; ++i) {
-        gdts[i] = allocateApplicationProcessorGdt();
+    // Same order as in startupApplicationProcessors(), because the APs use their startup counter as index
+    uint32_t i = 0;
+    for (const auto *localApic : localApics.values()) {
+        if (localApic->getCpuId() == LocalApic::getId()) {
+            continue;
+        }
+
+        gdts[i++] = allocateApplicationProcessorGdt(localApic->getCpuId());
     }
 
     return reinterpret_cast<void *>(gdts);
 }
 
-Cpu::Descriptor *Apic::allocateApplicationProcessorGdt() {
-    // Allocate memory for the GDT and TSS. This is never freed, as its used as long as the system runs.
+Cpu::Descriptor *Apic::allocateApplicationProcessorGdt(uint8_t cpuId) {
+    // Allocate memory for the GDT, TSS and per-cpu data. This is never freed, as its used as long as the system runs.
     auto &memoryService = Kernel::System::getService<Kernel::MemoryService>();
 
-    auto *gdt = reinterpret_cast<uint16_t*>(memoryService.allocateLowerMemory(48));
+    auto *gdt = reinterpret_cast<uint16_t*>(memoryService.allocateLowerMemory(56));
 
     const uint32_t tssSize = sizeof(Kernel::TaskStateSegment);
-    auto *tss = reinterpret_cast<void *>(memoryService.allocateLowerMemory(tssSize));
+    auto *tss = reinterpret_cast<Kernel::TaskStateSegment*>(memoryService.allocateLowerMemory(tssSize));
 
     // Zero everything
-    Util::Address<uint32_t>(gdt).setRange(0, 48);
+    Util::Address<uint32_t>(gdt).setRange(0, 56);
     Util::Address<uint32_t>(tss).setRange(0, tssSize);
 
+    auto *perCpuData = new Kernel::PerCpuData{};
+    perCpuData->self = perCpuData;
+    perCpuData->cliCount = 1; // Interrupts are disabled on startup
+    perCpuData->currentAddressSpace = &memoryService.getKernelAddressSpace();
+    perCpuData->taskStateSegment = tss;
+
     // Set up general GDT for the AP
     // First entry has to be null
     Kernel::System::createGlobalDescriptorTableEntry(gdt, 0, 0, 0, 0, 0);
@@ -474,9 +490,14 @@ Cpu::Descriptor *Apic::allocateApplicationProcessorGdt() {
     Kernel::System::createGlobalDescriptorTableEntry(gdt, 4, 0, 0xFFFFFFFF, 0xF2, 0xC);
     // TSS segment
     Kernel::System::createGlobalDescriptorTableEntry(gdt, 5, reinterpret_cast<uint32_t>(tss), tssSize, 0x89, 0x4);
+    // Per-cpu data segment
+    Kernel::System::createGlobalDescriptorTableEntry(gdt, 6, reinterpret_cast<uint32_t>(perCpuData), sizeof(Kernel::PerCpuData) - 1, 0x92, 0x4);
+
+    Kernel::System::getService<Kernel::InterruptService>().addCpu(cpuId);
+    Kernel::System::registerPerCpuData(cpuId, *perCpuData);
 
     return new Cpu::Descriptor {
-            .limit = 6 * 8,
+            .limit = 7 * 8,
             .address = reinterpret_cast<uint32_t>(gdt) // + Kernel::MemoryLayout::KERNEL_START
     };
 }
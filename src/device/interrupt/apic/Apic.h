@@ -25,6 +25,7 @@
 
 #include "LocalApic.h"
 #include "LocalApicErrorHandler.h"
+#include "LocalApicWakeupHandler.h"
 #include "device/time/ApicTimer.h"
 #include "device/cpu/Cpu.h"
 #include "lib/util/collection/HashMap.h"
@@ -172,7 +173,7 @@ private:
      * This is basically a shorter and slightly modified version of System::InitializeGlobalDescriptorTables.
      * The main difference is that only a single GDT is used and its memory is allocated by this function.
      */
-    Cpu::Descriptor* allocateApplicationProcessorGdt();
+    Cpu::Descriptor* allocateApplicationProcessorGdt(uint8_t cpuId);
 
     Kernel::GlobalSystemInterrupt getIrqOverride(InterruptRequest interruptRequest);
 
@@ -187,6 +188,7 @@ private:
     Util::HashMap<uint8_t, ApicTimer*> localTimers; // All ApicTimer instances.
     IoApic *ioApic;                      // The IoApic instance responsible for the external interrupts.
     LocalApicErrorHandler errorHandler;  // The interrupt handler that gets triggered on an internal APIC error.
+    LocalApicWakeupHandler wakeupHandler; // The interrupt handler for IPIs, that wake up halted idle CPUs.
 
     static Kernel::Logger log;
 
@@ -25,6 +25,7 @@
 #include "kernel/service/InterruptService.h"
 #include "lib/util/base/Constants.h"
 #include "kernel/service/MemoryService.h"
+#include "device/cpu/Cpu.h"
 #include "device/cpu/IoPort.h"
 #include "device/cpu/ModelSpecificRegister.h"
 #include "kernel/interrupt/InterruptVector.h"
@@ -202,10 +203,10 @@ void LocalApic::writeLocalVectorTable(LocalApic::LocalInterrupt lint, const Loca
 }
 
 LocalApic::InterruptCommandRegisterEntry LocalApic::readInterruptCommandRegister() {
-    commandLock.acquire(); // This needs to be synchronized in case multiple APs issue IPIs
+    auto flags = acquireCommandLock();
     const uint32_t low = readDoubleWord(ICR_LOW);
     const uint64_t high = readDoubleWord(ICR_HIGH);
-    commandLock.release();
+    releaseCommandLock(flags);
 
     return InterruptCommandRegisterEntry(low | high << 32);
 
@@ -214,10 +215,26 @@ LocalApic::InterruptCommandRegisterEntry LocalApic::readInterruptCommandRegister
 void LocalApic::writeInterruptCommandRegister(const LocalApic::InterruptCommandRegisterEntry &icrEntry) {
     auto value = static_cast<uint64_t>(icrEntry);
 
-    commandLock.acquire(); // This needs to be synchronized in case multiple APs issue IPIs
+    auto flags = acquireCommandLock();
     writeDoubleWord(ICR_HIGH, value >> 32);
     writeDoubleWord(ICR_LOW, value & 0xFFFFFFFF); // Writing the low DW sends the IPI
+    releaseCommandLock(flags);
+}
+
+uint32_t LocalApic::acquireCommandLock() {
+    // This needs to be synchronized in case multiple APs issue IPIs.
+    // Interrupt handlers may also send IPIs (e.g. to wake up an idle CPU), so the lock is only held with interrupts disabled.
+    auto flags = Device::Cpu::saveAndDisableInterrupts();
+    while (!commandLock.tryAcquire()) {
+        asm volatile ("pause");
+    }
+
+    return flags;
+}
+
+void LocalApic::releaseCommandLock(uint32_t flags) {
     commandLock.release();
+    Device::Cpu::restoreInterrupts(flags);
 }
 
 void LocalApic::allow(LocalApic::LocalInterrupt lint) {
@@ -272,6 +289,30 @@ void LocalApic::sendStartupInterProcessorInterrupt(uint8_t id, uint32_t startupC
     writeInterruptCommandRegister(icrEntry); // Writing ICR issues IPI
 }
 
+void LocalApic::sendNonMaskableInterProcessorInterrupt(uint8_t id) {
+    InterruptCommandRegisterEntry icrEntry{};
+    icrEntry.vector = static_cast<Kernel::InterruptVector>(0); // NMI doesn't have vector
+    icrEntry.deliveryMode = InterruptCommandRegisterEntry::DeliveryMode::NMI;
+    icrEntry.destinationMode = InterruptCommandRegisterEntry::DestinationMode::PHYSICAL;
+    icrEntry.level = InterruptCommandRegisterEntry::Level::ASSERT;
+    icrEntry.triggerMode = InterruptCommandRegisterEntry::TriggerMode::EDGE;
+    icrEntry.destinationShorthand = InterruptCommandRegisterEntry::DestinationShorthand::NO;
+    icrEntry.destination = id;
+    writeInterruptCommandRegister(icrEntry); // Writing ICR issues IPI
+}
+
+void LocalApic::sendInterProcessorInterrupt(uint8_t id, Kernel::InterruptVector vector) {
+    InterruptCommandRegisterEntry icrEntry{};
+    icrEntry.vector = vector;
+    icrEntry.deliveryMode = InterruptCommandRegisterEntry::DeliveryMode::FIXED;
+    icrEntry.destinationMode = InterruptCommandRegisterEntry::DestinationMode::PHYSICAL;
+    icrEntry.level = InterruptCommandRegisterEntry::Level::ASSERT;
+    icrEntry.triggerMode = InterruptCommandRegisterEntry::TriggerMode::EDGE;
+    icrEntry.destinationShorthand = InterruptCommandRegisterEntry::DestinationShorthand::NO;
+    icrEntry.destination = id;
+    writeInterruptCommandRegister(icrEntry); // Writing ICR issues IPI
+}
+
 void LocalApic::waitForInterProcessorInterruptDispatch() {
     do {
         // Spinloop: Pause prevents speculative memory reads, memory prevents compiler memory reordering,
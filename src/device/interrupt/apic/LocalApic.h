@@ -347,6 +347,24 @@ public:
      */
     static void sendStartupInterProcessorInterrupt(uint8_t id, uint32_t startupCodeAddress);
 
+    /**
+     * Send an NMI to another CPU.
+     *
+     * An NMI is delivered, even if the target CPU has disabled interrupts (e.g. while holding a spinlock).
+     * It is always handled by the NON_MASKABLE_INTERRUPT vector.
+     *
+     * @param id The local APIC id/CPU id of the target CPU
+     */
+    static void sendNonMaskableInterProcessorInterrupt(uint8_t id);
+
+    /**
+     * Send a fixed interrupt with the given vector to another CPU.
+     *
+     * @param id The local APIC id/CPU id of the target CPU
+     * @param vector The interrupt vector, that is raised on the target CPU
+     */
+    static void sendInterProcessorInterrupt(uint8_t id, Kernel::InterruptVector vector);
+
     /**
      * Poll the ICR until the delivery status bit is unset.
      */
@@ -444,6 +462,15 @@ public:
 
 private:
 
+    /**
+     * Acquire the lock for the interrupt command register with interrupts disabled.
+     *
+     * @return The previous EFLAGS register, which has to be passed to releaseCommandLock()
+     */
+    static uint32_t acquireCommandLock();
+
+    static void releaseCommandLock(uint32_t flags);
+
     uint8_t cpuId; // The CPU core this instance belongs to, LocalApic::getId() only returns the current AP's id!
     Util::ArrayList<NmiSource> nmiSources;
 
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_LOCALAPICWAKEUPHANDLER_H
+#define HHUOS_LOCALAPICWAKEUPHANDLER_H
+
+#include "kernel/interrupt/InterruptHandler.h"
+
+namespace Kernel {
+struct InterruptFrame;
+}  // namespace Kernel
+
+namespace Device {
+
+/**
+ * Handles the WAKEUP interprocessor interrupt, which is sent to a halted idle CPU, when a thread has become ready on it.
+ * The interrupt itself ends the halt, so there is nothing left to do for the handler.
+ */
+class LocalApicWakeupHandler : public Kernel::InterruptHandler {
+
+public:
+    /**
+     * Default Constructor.
+     */
+    LocalApicWakeupHandler() = default;
+
+    /**
+     * Copy Constructor.
+     */
+    LocalApicWakeupHandler(const LocalApicWakeupHandler &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    LocalApicWakeupHandler &operator=(const LocalApicWakeupHandler &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~LocalApicWakeupHandler() override = default;
+
+    /**
+     * Overriding function from InterruptHandler.
+     */
+    void plugin() override;
+
+    /**
+     * Overriding function from InterruptHandler.
+     */
+    void trigger(const Kernel::InterruptFrame &frame) override;
+};
+
+}
+
+#endif
@@ -28,6 +28,7 @@
 #include "lib/util/base/Address.h"
 #include "lib/util/base/Constants.h"
 #include "kernel/network/ethernet/EthernetModule.h"
+#include "kernel/log/Trace.h"
 
 namespace Device::Network {
 
@@ -44,6 +45,9 @@ NetworkDevice::NetworkDevice() :
     auto &readerThread = Kernel::Thread::createKernelThread(Util::String::format("Packet-Reader"), processService.getKernelProcess(), reader);
     auto &writerThread = Kernel::Thread::createKernelThread(Util::String::format("Packet-Writer"), processService.getKernelProcess(), writer);
 
+    // Packets are buffered, so the background threads should not delay interactive ones
+    schedulerService.setPriority(readerThread, Util::Async::Thread::LOW);
+    schedulerService.setPriority(writerThread, Util::Async::Thread::LOW);
     schedulerService.ready(readerThread);
     schedulerService.ready(writerThread);
 }
@@ -53,6 +57,7 @@ const Util::String& NetworkDevice::getIdentifier() const {
 }
 
 void NetworkDevice::sendPacket(const uint8_t *packet, uint32_t length) {
+    Kernel::Trace::tracepoint(Kernel::Trace::PACKET_TRANSMIT, length);
     outgoingPacketLock.acquire();
     auto *buffer = reinterpret_cast<uint8_t*>(packetMemoryManager.allocateBlock());
     auto source = Util::Address<uint32_t>(packet);
@@ -61,6 +66,7 @@ void NetworkDevice::sendPacket(const uint8_t *packet, uint32_t length) {
 
     outgoingPacketQueue.add(Packet{buffer, length});
     outgoingPacketLock.release();
+    outgoingPacketWaitQueue.notify();
 }
 
 void NetworkDevice::handleIncomingPacket(const uint8_t *packet, uint32_t length) {
@@ -68,6 +74,7 @@ void NetworkDevice::handleIncomingPacket(const uint8_t *packet, uint32_t length)
         return;
     }
 
+    Kernel::Trace::tracepoint(Kernel::Trace::PACKET_RECEIVE, length);
     auto *buffer = reinterpret_cast<uint8_t*>(packetMemoryManager.allocateBlock());
     auto source = Util::Address<uint32_t>(packet);
     auto target = Util::Address<uint32_t>(buffer);
@@ -75,7 +82,10 @@ void NetworkDevice::handleIncomingPacket(const uint8_t *packet, uint32_t length)
 
     if (!incomingPacketQueue.offer(Packet{buffer, length})) {
         packetMemoryManager.freeBlock(buffer);
+        return;
     }
+
+    incomingPacketWaitQueue.notify();
 }
 
 NetworkDevice::~NetworkDevice() {
@@ -83,17 +93,17 @@ NetworkDevice::~NetworkDevice() {
 }
 
 NetworkDevice::Packet NetworkDevice::getNextIncomingPacket() {
-    while (incomingPacketQueue.isEmpty()) {
-        Util::Async::Thread::yield();
-    }
+    incomingPacketWaitQueue.waitUntil([this]() {
+        return !incomingPacketQueue.isEmpty();
+    });
 
     return incomingPacketQueue.poll();
 }
 
 NetworkDevice::Packet NetworkDevice::getNextOutgoingPacket() {
-    while (outgoingPacketQueue.isEmpty()) {
-        Util::Async::Thread::yield();
-    }
+    outgoingPacketWaitQueue.waitUntil([this]() {
+        return !outgoingPacketQueue.isEmpty();
+    });
 
     return outgoingPacketQueue.poll();
 }
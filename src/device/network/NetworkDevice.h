@@ -24,6 +24,7 @@
 #include "lib/util/collection/ArrayBlockingQueue.h"
 #include "lib/util/network/MacAddress.h"
 #include "kernel/log/Logger.h"
+#include "kernel/process/WaitQueue.h"
 #include "lib/util/async/Spinlock.h"
 #include "lib/util/base/String.h"
 
@@ -107,6 +108,8 @@ private:
     Util::ArrayBlockingQueue<Packet> incomingPacketQueue;
     Util::ArrayBlockingQueue<Packet> outgoingPacketQueue;
     Util::Async::Spinlock outgoingPacketLock;
+    Kernel::WaitQueue incomingPacketWaitQueue;
+    Kernel::WaitQueue outgoingPacketWaitQueue;
 
     PacketReader *reader;
     PacketWriter *writer;
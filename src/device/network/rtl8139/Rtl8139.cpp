@@ -119,10 +119,9 @@ void Rtl8139::plugin() {
 void Rtl8139::trigger(const Kernel::InterruptFrame &frame) {
     auto interrupt = baseRegister.readWord(INTERRUPT_STATUS);
     if (interrupt & RECEIVE_OK) {
-        while (!(baseRegister.readByte(COMMAND) & BUFFER_EMPTY)) {
-            processIncomingPacket();
-        }
+        // Draining the receive buffer is deferred to the interrupt worker thread
         baseRegister.writeWord(INTERRUPT_STATUS, RECEIVE_OK);
+        Kernel::System::getService<Kernel::InterruptService>().deferWork(*this);
     } else if (interrupt & TRANSMIT_OK) {
         freeLastSendBuffer();
         baseRegister.writeWord(INTERRUPT_STATUS, TRANSMIT_OK);
@@ -133,6 +132,12 @@ void Rtl8139::trigger(const Kernel::InterruptFrame &frame) {
     }
 }
 
+void Rtl8139::processDeferredWork() {
+    while (!(baseRegister.readByte(COMMAND) & BUFFER_EMPTY)) {
+        processIncomingPacket();
+    }
+}
+
 bool Rtl8139::isTransmitDescriptorAvailable() {
     auto status = baseRegister.readDoubleWord(TRANSMIT_STATUS + transmitDescriptor * 4);
     return (status & OWN);
@@ -64,6 +64,8 @@ public:
 
     void trigger(const Kernel::InterruptFrame &frame) override;
 
+    void processDeferredWork() override;
+
 protected:
 
     void handleOutgoingPacket(const uint8_t *packet, uint32_t length) override;
@@ -26,6 +26,7 @@ namespace Device {
 
 const IoPort Pci::configAddressPort = IoPort(CONFIG_ADDRESS);
 const IoPort Pci::configDataPort = IoPort(CONFIG_DATA);
+Util::Async::Spinlock Pci::configLock = Util::Async::Spinlock("pci-config");
 Kernel::Logger Pci::log = Kernel::Logger::get("PCI");
 Util::ArrayList<PciDevice> Pci::devices = Util::ArrayList<PciDevice>();
 
@@ -35,8 +36,9 @@ void Pci::prepareRegister(uint8_t bus, uint8_t device, uint8_t function, uint8_t
 }
 
 uint32_t Pci::readDoubleWord(uint8_t bus, uint8_t device, uint8_t function, uint8_t offset) {
+    configLock.acquire();
     prepareRegister(bus, device, function, offset);
-    return configDataPort.readDoubleWord();
+    return configLock.releaseAndReturn(configDataPort.readDoubleWord());
 }
 
 uint16_t Pci::readWord(uint8_t bus, uint8_t device, uint8_t function, uint8_t offset) {
@@ -48,18 +50,24 @@ uint8_t Pci::readByte(uint8_t bus, uint8_t device, uint8_t function, uint8_t off
 }
 
 void Pci::writeDoubleWord(uint8_t bus, uint8_t device, uint8_t function, uint8_t offset, uint32_t value) {
+    configLock.acquire();
     prepareRegister(bus, device, function, offset);
     configDataPort.writeDoubleWord(value);
+    configLock.release();
 }
 
 void Pci::writeWord(uint8_t bus, uint8_t device, uint8_t function, uint8_t offset, uint16_t value) {
+    configLock.acquire();
     prepareRegister(bus, device, function, offset);
     configDataPort.writeWord(offset & 0x02, value);
+    configLock.release();
 }
 
 void Pci::writeByte(uint8_t bus, uint8_t device, uint8_t function, uint8_t offset, uint8_t value) {
+    configLock.acquire();
     prepareRegister(bus, device, function, offset);
     configDataPort.writeByte(offset & 0x03, value);
+    configLock.release();
 }
 
 void Pci::scan() {
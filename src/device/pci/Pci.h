@@ -21,6 +21,7 @@
 #include <cstdint>
 
 #include "lib/util/collection/Array.h"
+#include "lib/util/async/Spinlock.h"
 
 namespace Kernel {
 class Logger;
@@ -201,6 +202,7 @@ private:
 
     static const IoPort configAddressPort;
     static const IoPort configDataPort;
+    static Util::Async::Spinlock configLock; // The address and data ports must be accessed as a pair
     
     static Kernel::Logger log;
     static Util::ArrayList<PciDevice> devices;
@@ -66,6 +66,8 @@ SoundBlaster::SoundBlaster(uint16_t baseAddress, uint8_t irqNumber, uint8_t dmaC
     auto *soundBlasterNode = new SoundBlasterNode(this, *runnable, thread);
 
     filesystemService.getFilesystem().getVirtualDriver("/device").addNode("/", soundBlasterNode);
+    // Audio glitches, if the DMA buffer is not refilled in time
+    schedulerService.setPriority(thread, Util::Async::Thread::HIGH);
     schedulerService.ready(thread);
 }
 
@@ -217,16 +219,24 @@ void SoundBlaster::ackInterrupt() {
 }
 
 void SoundBlaster::waitForInterrupt() {
-    while (!receivedInterrupt) {
-        Util::Async::Thread::yield();
-    }
+    interruptWaitQueue.waitUntil([this]() {
+        if (!receivedInterrupt) {
+            return false;
+        }
 
-    receivedInterrupt = false;
+        receivedInterrupt = false;
+        return true;
+    });
 }
 
 void SoundBlaster::trigger(const Kernel::InterruptFrame &frame) {
-    receivedInterrupt = true;
     ackInterrupt();
+    Kernel::System::getService<Kernel::InterruptService>().deferWork(*this);
+}
+
+void SoundBlaster::processDeferredWork() {
+    receivedInterrupt = true;
+    interruptWaitQueue.notify();
 }
 
 uint8_t* SoundBlaster::getDmaBuffer() const {
@@ -22,6 +22,7 @@
 
 #include "kernel/interrupt/InterruptHandler.h"
 #include "device/cpu/IoPort.h"
+#include "kernel/process/WaitQueue.h"
 
 namespace Kernel {
 class Logger;
@@ -95,6 +96,11 @@ public:
      */
     void trigger(const Kernel::InterruptFrame &frame) override;
 
+    /**
+     * Overriding function from InterruptHandler.
+     */
+    void processDeferredWork() override;
+
     /**
      * Set the audio playback parameters.
      *
@@ -249,6 +255,7 @@ private:
     uint8_t *physicalDmaAddress = nullptr;
 
     bool receivedInterrupt = false;
+    Kernel::WaitQueue interruptWaitQueue;
 
     SoundBlasterRunnable *runnable;
 
@@ -49,4 +49,21 @@ bool SoundBlasterNode::control(uint32_t request, const Util::Array<uint32_t> &pa
     }
 }
 
+uint64_t SoundBlasterNode::writeData(const uint8_t *sourceBuffer, uint64_t pos, uint64_t numBytes) {
+    // The runnable only sleeps while its pipe is empty. Writing chunks, that fit into the pipe,
+    // makes sure it is woken up, before a large write blocks on a full pipe.
+    uint64_t written = 0;
+    while (written < numBytes) {
+        uint64_t chunkSize = runnable.getInputStreamBufferSize();
+        if (chunkSize > numBytes - written) {
+            chunkSize = numBytes - written;
+        }
+
+        written += StreamNode::writeData(sourceBuffer + written, pos + written, chunkSize);
+        runnable.notifyInputAvailable();
+    }
+
+    return written;
+}
+
 }
\ No newline at end of file
@@ -59,6 +59,11 @@ public:
      */
     bool control(uint32_t request, const Util::Array<uint32_t> &parameters) override;
 
+    /**
+     * Overriding function from StreamNode.
+     */
+    uint64_t writeData(const uint8_t *sourceBuffer, uint64_t pos, uint64_t numBytes) override;
+
 private:
 
     SoundBlaster *soundBlaster;
@@ -17,7 +17,6 @@
 
 #include "SoundBlasterRunnable.h"
 
-#include "lib/util/async/Thread.h"
 #include "device/sound/soundblaster/SoundBlaster.h"
 #include "lib/util/base/Address.h"
 
@@ -46,11 +45,18 @@ void SoundBlasterRunnable::run() {
                 dmaOffset = 0;
             }
 
-            Util::Async::Thread::yield();
-
             inputStreamLock.acquire();
             available = inputStream->available();
+            if (available == 0 && isRunning) {
+                // Sleep until new samples are written to the sound blaster node
+                inputWaitQueue.wait(inputStreamLock);
+                available = inputStream->available();
+            }
             inputStreamLock.release();
+
+            if (!isRunning) {
+                return;
+            }
         }
 
         const auto bufferSize = soundBlaster.getDmaBufferSize();
@@ -89,7 +95,25 @@ void SoundBlasterRunnable::run() {
 }
 
 void SoundBlasterRunnable::stop() {
+    inputStreamLock.acquire();
     isRunning = false;
+    inputWaitQueue.notify();
+    inputStreamLock.release();
+}
+
+void SoundBlasterRunnable::notifyInputAvailable() {
+    // Notifying under the lock prevents the wakeup from getting lost between checking for samples and waiting
+    inputStreamLock.acquire();
+    inputWaitQueue.notify();
+    inputStreamLock.release();
+}
+
+uint32_t SoundBlasterRunnable::getInputStreamBufferSize() {
+    inputStreamLock.acquire();
+    auto size = inputStream->getBufferSize();
+    inputStreamLock.release();
+
+    return size;
 }
 
 void SoundBlasterRunnable::adjustInputStreamBuffer(uint16_t sampleRate, uint8_t channels, uint8_t bitsPerSample) {
@@ -24,6 +24,7 @@
 #include "lib/util/io/stream/PipedOutputStream.h"
 #include "lib/util/io/stream/PipedInputStream.h"
 #include "lib/util/async/Spinlock.h"
+#include "kernel/process/WaitQueue.h"
 
 namespace Device {
 class SoundBlaster;
@@ -57,6 +58,13 @@ public:
 
     void stop();
 
+    /**
+     * Wake up the runnable, if it is waiting for new samples.
+     */
+    void notifyInputAvailable();
+
+    uint32_t getInputStreamBufferSize();
+
     void adjustInputStreamBuffer(uint16_t sampleRate, uint8_t channels, uint8_t bitsPerSample);
 
 private:
@@ -68,6 +76,7 @@ private:
     SoundBlaster &soundBlaster;
 
     Util::Async::Spinlock inputStreamLock;
+    Kernel::WaitQueue inputWaitQueue;
 
     Util::Io::PipedInputStream *inputStream = new Util::Io::PipedInputStream();
     Util::Io::PipedOutputStream *outputStream = new Util::Io::PipedOutputStream();
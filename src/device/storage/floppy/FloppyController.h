@@ -23,7 +23,7 @@
 #include "device/cpu/IoPort.h"
 #include "device/isa/Isa.h"
 #include "kernel/interrupt/InterruptHandler.h"
-#include "lib/util/async/Spinlock.h"
+#include "lib/util/async/Mutex.h"
 
 namespace Kernel {
 class Logger;
@@ -333,7 +333,7 @@ private:
     Device::IoPort digitalInputRegister;
     Device::IoPort configControlRegister;
 
-    Util::Async::Spinlock ioLock;
+    Util::Async::Mutex ioLock;
 
     static Kernel::Logger log;
 
@@ -41,6 +41,8 @@
 #include "kernel/interrupt/InterruptVector.h"
 #include "lib/util/collection/ArrayList.h"
 #include "lib/util/collection/Iterator.h"
+#include "lib/util/async/Atomic.h"
+#include "kernel/system/InitializationGroup.h"
 
 namespace Device::Storage {
 
@@ -124,20 +126,32 @@ IdeController::ChannelRegisters::ChannelRegisters()
         : command(0), control(0), dma(0) {}
 
 void IdeController::initializeDrives() {
-    auto devices = Util::ArrayList<IdeDevice*>();
+    IdeDevice *devices[CHANNELS_PER_CONTROLLER][DEVICES_PER_CHANNEL]{};
+    auto probes = Kernel::InitializationGroup();
     for (uint32_t i = 0; i < CHANNELS_PER_CONTROLLER; i++) {
-        for (uint32_t j = 0; j < DEVICES_PER_CHANNEL; j++) {
-            if (resetDrive(i, j)) {
-                auto *device = identifyDrive(i, j);
-                if (device != nullptr) {
-                    devices.add(device);
-                }
+        probes.start(i == 0 ? "ide_primary" : "ide_secondary", new ChannelProbe(*this, i, devices[i]));
+    }
+
+    probes.join();
+
+    // Register the drives in a fixed order, so that their names do not depend on which channel finished first
+    for (auto &channelDevices : devices) {
+        for (auto *device : channelDevices) {
+            if (device != nullptr) {
+                Kernel::System::getService<Kernel::StorageService>().registerDevice(device, "ide");
             }
         }
     }
+}
+
+IdeController::ChannelProbe::ChannelProbe(IdeController &controller, uint8_t channel, IdeDevice **devices) :
+        controller(controller), channel(channel), devices(devices) {}
 
-    for (auto *device : devices) {
-        Kernel::System::getService<Kernel::StorageService>().registerDevice(device, "ide");
+void IdeController::ChannelProbe::run() {
+    for (uint32_t i = 0; i < DEVICES_PER_CHANNEL; i++) {
+        if (controller.resetDrive(channel, i)) {
+            devices[i] = controller.identifyDrive(channel, i);
+        }
     }
 }
 
@@ -365,10 +379,27 @@ void IdeController::plugin() {
 }
 
 void IdeController::trigger(const Kernel::InterruptFrame &frame) {
+    auto pending = Util::Async::Atomic<uint32_t>(pendingInterrupts);
     if (frame.interrupt == Kernel::InterruptVector::PRIMARY_ATA) {
-        channels[0].receivedInterrupt = true;
+        // Reading the status register acknowledges the interrupt
+        channels[0].command.status.readByte();
+        pending.bitSet(0);
     } else if (frame.interrupt == Kernel::InterruptVector::SECONDARY_ATA) {
-        channels[1].receivedInterrupt = true;
+        channels[1].command.status.readByte();
+        pending.bitSet(1);
+    } else {
+        return;
+    }
+
+    Kernel::System::getService<Kernel::InterruptService>().deferWork(*this);
+}
+
+void IdeController::processDeferredWork() {
+    auto pending = Util::Async::Atomic<uint32_t>(pendingInterrupts).getAndSet(0);
+    for (uint32_t i = 0; i < CHANNELS_PER_CONTROLLER; i++) {
+        if (pending & (1 << i)) {
+            channels[i].receivedInterrupt = true;
+        }
     }
 }
 
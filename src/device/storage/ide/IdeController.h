@@ -25,7 +25,8 @@
 
 #include "kernel/interrupt/InterruptHandler.h"
 #include "device/cpu/IoPort.h"
-#include "lib/util/async/Spinlock.h"
+#include "lib/util/async/Mutex.h"
+#include "lib/util/async/Runnable.h"
 
 namespace Device {
 class PciDevice;
@@ -69,6 +70,8 @@ public:
 
     void trigger(const Kernel::InterruptFrame &frame) override;
 
+    void processDeferredWork() override;
+
 private:
 
     static const constexpr uint8_t PCI_SUBCLASS_IDE = 0x01;
@@ -266,6 +269,31 @@ private:
         DmaRegisters dma;                     // DMA Bus Master Register Set IoPorts
     };
 
+    /**
+     * Resets and identifies the drives of a single channel.
+     * The channels are independent, so they are probed in parallel (each reset waits at least 10 ms).
+     */
+    class ChannelProbe : public Util::Async::Runnable {
+
+    public:
+
+        ChannelProbe(IdeController &controller, uint8_t channel, IdeDevice **devices);
+
+        ChannelProbe(const ChannelProbe &other) = delete;
+
+        ChannelProbe &operator=(const ChannelProbe &other) = delete;
+
+        ~ChannelProbe() override = default;
+
+        void run() override;
+
+    private:
+
+        IdeController &controller;
+        uint8_t channel;
+        IdeDevice **devices;
+    };
+
     void initializeDrives();
 
     bool resetDrive(uint8_t channel, uint8_t drive);
@@ -297,7 +325,8 @@ private:
     static void copyByteSwappedString(const char *source, char *target, uint32_t length);
 
     ChannelRegisters channels[CHANNELS_PER_CONTROLLER]{};
-    Util::Async::Spinlock ioLock;
+    Util::Async::Mutex ioLock;
+    uint32_t pendingInterrupts = 0; // Channels, that have received an interrupt, which has not been processed yet
     bool supportsDma = false;
 
     static Kernel::Logger log;
@@ -23,10 +23,13 @@
 #include "device/interrupt/apic/LocalApic.h"
 #include "Pit.h"
 #include "kernel/service/SchedulerService.h"
+#include "kernel/system/PerCpu.h"
 #include "kernel/system/System.h"
 #include "kernel/service/InterruptService.h"
 #include "kernel/interrupt/InterruptVector.h"
 #include "kernel/log/Logger.h"
+#include "kernel/multiboot/Multiboot.h"
+#include "lib/util/math/Math.h"
 
 namespace Kernel {
 struct InterruptFrame;
@@ -50,6 +53,14 @@ ApicTimer::ApicTimer(uint32_t timerInterval, uint32_t yieldInterval) : cpuId(Loc
     LocalApic::writeDoubleWord(LocalApic::TIMER_INITIAL, counter);
 }
 
+ApicTimer::ApicTimer() : cpuId(LocalApic::getId()), timerInterval(0), yieldInterval(0), oneShot(true) {
+    LocalApic::writeDoubleWord(LocalApic::TIMER_DIVIDE, divider);
+    LocalApic::LocalVectorTableEntry lvtEntry = LocalApic::readLocalVectorTable(LocalApic::TIMER);
+    lvtEntry.timerMode = LocalApic::LocalVectorTableEntry::TimerMode::ONESHOT;
+    LocalApic::writeLocalVectorTable(LocalApic::TIMER, lvtEntry);
+    LocalApic::writeDoubleWord(LocalApic::TIMER_INITIAL, 0); // An initial count of 0 stops the timer
+}
+
 void ApicTimer::plugin() {
     auto &interruptService = Kernel::System::getService<Kernel::InterruptService>();
     interruptService.assignInterrupt(Kernel::InterruptVector::APICTIMER, *this);
@@ -64,18 +75,19 @@ void ApicTimer::trigger(const Kernel::InterruptFrame &frame) {
     }
 
     // Increase the "core-local" time, the system time is still managed by the PIT.
-    time.addNanoseconds(timerInterval * 1000000); // Interval is in milliseconds
+    auto elapsedNanoseconds = oneShot ? deadline * 1000 : timerInterval * 1000000;
+    time.addNanoseconds(elapsedNanoseconds);
 
-    if (cpuId != 0) {
-        // Currently there is only one scheduler, it should get triggered only by the BSP.
-        // Otherwise, the scheduler would be triggered n-times faster than intended, where n
-        // is the CPU count.
-        return;
-    }
+    auto &schedulerService = *Kernel::CpuLocal::schedulerService.get();
+    schedulerService.getProfiler().tick(frame, elapsedNanoseconds);
 
-    if (time.toMilliseconds() % yieldInterval == 0) {
-        // Currently there is only one main scheduler, for SMP systems this should yield the core scheduler or something similar.
-        Kernel::System::getService<Kernel::SchedulerService>().yield();
+    // Every core runs its own scheduler, so the interrupt is acknowledged before switching to another thread.
+    // Otherwise, the APIC timer would stay masked by the in-service register until this thread is scheduled again.
+    LocalApic::sendEndOfInterrupt();
+
+    // In one-shot mode, the scheduler sets the next deadline
+    if (oneShot || time.toMilliseconds() % yieldInterval == 0) {
+        schedulerService.tick();
     }
 }
 
@@ -102,4 +114,31 @@ uint8_t ApicTimer::getCpuId() const {
     return cpuId;
 }
 
+bool ApicTimer::isOneShot() const {
+    return oneShot;
+}
+
+void ApicTimer::setDeadline(uint32_t microseconds) {
+    uint32_t remainder;
+    auto counter = Util::Math::divide(static_cast<uint64_t>(ticksPerMilliseconds) * microseconds, 1000, remainder);
+    if (counter == 0) {
+        counter = 1;
+    } else if (counter > UINT32_MAX) {
+        counter = UINT32_MAX;
+    }
+
+    // Writing the initial count (re-)starts the timer
+    deadline = microseconds;
+    LocalApic::writeDoubleWord(LocalApic::TIMER_INITIAL, static_cast<uint32_t>(counter));
+}
+
+void ApicTimer::stop() {
+    deadline = 0;
+    LocalApic::writeDoubleWord(LocalApic::TIMER_INITIAL, 0);
+}
+
+bool ApicTimer::isTicklessModeEnabled() {
+    return Kernel::Multiboot::hasKernelOption("tickless") && Kernel::Multiboot::getKernelOption("tickless") == "true";
+}
+
 }
\ No newline at end of file
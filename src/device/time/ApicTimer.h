@@ -74,6 +74,12 @@ public:
      */
     ApicTimer(uint32_t timerInterval, uint32_t yieldInterval);
 
+    /**
+     * Constructor for tickless operation.
+     * The timer runs in one-shot mode and does not fire, until the scheduler sets a deadline.
+     */
+    ApicTimer();
+
     /**
      * Copy Constructor.
      */
@@ -114,10 +120,31 @@ public:
 
     [[nodiscard]] uint8_t getCpuId() const;
 
+    [[nodiscard]] bool isOneShot() const;
+
+    /**
+     * Let a one-shot timer fire once after the given delay. A previously set deadline is replaced.
+     * Must be called on the CPU, that owns this timer.
+     */
+    void setDeadline(uint32_t microseconds);
+
+    /**
+     * Cancel the deadline of a one-shot timer. Must be called on the CPU, that owns this timer.
+     */
+    void stop();
+
+    /**
+     * Check if the kernel option "tickless=true" is set (only applies, if the local APIC is used).
+     * In tickless mode, the APIC timers run in one-shot mode and the PIT is stopped, unless the clock source needs it to keep the system time.
+     */
+    [[nodiscard]] static bool isTicklessModeEnabled();
+
 private:
     uint8_t cpuId;          // The id of the CPU that uses this timer.
     uint32_t timerInterval; // The interrupt trigger interval in milliseconds.
     uint32_t yieldInterval; // The preemption trigger interval in milliseconds.
+    bool oneShot = false;
+    uint32_t deadline = 0;  // The currently programmed one-shot delay in microseconds.
 
     Util::Time::Timestamp time{}; // The "core-local" timestamp.
 
@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "ClockSource.h"
+
+#include "device/cpu/Cpu.h"
+#include "lib/util/math/Math.h"
+
+namespace Device {
+
+ClockSource::ClockSource(const char *name, uint32_t rating) : name(name), rating(rating) {}
+
+Util::Time::Timestamp ClockSource::getTime() {
+    // May be called with interrupts disabled (e.g. by the scheduler), so the nesting counter is not used
+    auto flags = Device::Cpu::saveAndDisableInterrupts();
+    while (!lock.tryAcquire()) {
+        asm volatile ("pause");
+    }
+
+    auto counter = readCounter();
+    auto elapsedTicks = counter > startCounter ? counter - startCounter : 0;
+
+    uint32_t nanoseconds;
+    auto seconds = Util::Math::divide(toNanoseconds(elapsedTicks), 1000000000, nanoseconds);
+    auto result = startTime;
+    result.addSeconds(static_cast<uint32_t>(seconds));
+    result.addNanoseconds(nanoseconds);
+
+    if (result < lastTime) {
+        result = lastTime;
+    } else {
+        lastTime = result;
+    }
+
+    lock.release();
+    Device::Cpu::restoreInterrupts(flags);
+
+    return result;
+}
+
+void ClockSource::start(const Util::Time::Timestamp &time) {
+    auto flags = Device::Cpu::saveAndDisableInterrupts();
+    while (!lock.tryAcquire()) {
+        asm volatile ("pause");
+    }
+
+    startCounter = readCounter();
+    startTime = time;
+    lastTime = time;
+
+    lock.release();
+    Device::Cpu::restoreInterrupts(flags);
+}
+
+uint64_t ClockSource::toNanoseconds(uint64_t ticks) const {
+    // Multiply the 64-bit tick count with the 32.32 fixed point factor in parts, so that no 128-bit product is needed
+    auto integer = static_cast<uint32_t>(nanosecondsPerTick >> 32);
+    auto fraction = static_cast<uint32_t>(nanosecondsPerTick);
+    auto ticksLow = static_cast<uint32_t>(ticks);
+    auto ticksHigh = static_cast<uint32_t>(ticks >> 32);
+
+    return ticks * integer + static_cast<uint64_t>(ticksHigh) * fraction + ((static_cast<uint64_t>(ticksLow) * fraction) >> 32);
+}
+
+bool ClockSource::requiresPeriodicReads() const {
+    return false;
+}
+
+const char* ClockSource::getName() const {
+    return name;
+}
+
+uint32_t ClockSource::getRating() const {
+    return rating;
+}
+
+void ClockSource::setNanosecondsPerTick(uint64_t nanosecondsPerTick) {
+    this->nanosecondsPerTick = nanosecondsPerTick;
+}
+
+}
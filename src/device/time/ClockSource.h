@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_CLOCKSOURCE_H
+#define HHUOS_CLOCKSOURCE_H
+
+#include <cstdint>
+
+#include "TimeProvider.h"
+#include "lib/util/async/Spinlock.h"
+#include "lib/util/time/Timestamp.h"
+
+namespace Device {
+
+/**
+ * A free running counter, that keeps the system time with a higher resolution than counting timer interrupts.
+ * The time service uses the registered clock source with the highest rating.
+ * Counter values are converted with a 32.32 fixed point factor, since the kernel can not divide 64-bit integers.
+ */
+class ClockSource : public TimeProvider {
+
+public:
+    /**
+     * Constructor.
+     *
+     * @param name A short name for log messages (e.g. "HPET")
+     * @param rating Higher rated clock sources are preferred (see the RATING constants of the implementations)
+     */
+    ClockSource(const char *name, uint32_t rating);
+
+    /**
+     * Copy Constructor.
+     */
+    ClockSource(const ClockSource &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    ClockSource &operator=(const ClockSource &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~ClockSource() override = default;
+
+    /**
+     * Read the current counter value. The counter must never go back.
+     */
+    [[nodiscard]] virtual uint64_t readCounter() = 0;
+
+    /**
+     * Check if the counter only keeps the time, as long as it is read periodically (e.g. because it is extended in software).
+     * In this case, the PIT must keep running in tickless mode.
+     */
+    [[nodiscard]] virtual bool requiresPeriodicReads() const;
+
+    /**
+     * Overriding function from TimeProvider.
+     * The returned time never goes back, even if the counters of different CPUs are not perfectly synchronized.
+     */
+    [[nodiscard]] Util::Time::Timestamp getTime() override;
+
+    /**
+     * Continue the system time of the previously used time provider, so that it does not jump when switching clock sources.
+     */
+    void start(const Util::Time::Timestamp &time);
+
+    [[nodiscard]] uint64_t toNanoseconds(uint64_t ticks) const;
+
+    [[nodiscard]] const char* getName() const;
+
+    [[nodiscard]] uint32_t getRating() const;
+
+protected:
+
+    /**
+     * @param nanosecondsPerTick Length of a counter tick as 32.32 fixed point number
+     */
+    void setNanosecondsPerTick(uint64_t nanosecondsPerTick);
+
+private:
+
+    const char *name;
+    uint32_t rating;
+    uint64_t nanosecondsPerTick = 0;
+
+    uint64_t startCounter = 0;
+    Util::Time::Timestamp startTime{};
+    Util::Time::Timestamp lastTime{};
+    Util::Async::Spinlock lock = Util::Async::Spinlock("clock-source");
+};
+
+}
+
+#endif
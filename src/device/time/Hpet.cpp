@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "Hpet.h"
+
+#include "device/power/acpi/Acpi.h"
+#include "kernel/service/MemoryService.h"
+#include "kernel/system/System.h"
+#include "lib/util/base/Constants.h"
+#include "lib/util/hardware/Acpi.h"
+#include "lib/util/math/Math.h"
+
+namespace Device {
+
+Hpet::Hpet() : ClockSource("HPET", RATING) {
+    const auto &table = Acpi::getTable<Util::Hardware::Acpi::Hpet>("HPET");
+    auto baseAddress = static_cast<uint32_t>(table.address.address);
+
+    // The memory allocated here is never freed, since the HPET is used until the system is shut down
+    auto &memoryService = Kernel::System::getService<Kernel::MemoryService>();
+    auto *virtualAddress = static_cast<uint8_t*>(memoryService.mapIO(baseAddress, Util::PAGESIZE));
+    registers = reinterpret_cast<volatile uint32_t*>(virtualAddress + baseAddress % Util::PAGESIZE);
+
+    wideCounter = (readRegister(CAPABILITIES) & COUNTER_SIZE_CAPABILITY) != 0;
+
+    uint32_t remainder;
+    auto period = readRegister(COUNTER_PERIOD); // Femtoseconds
+    setNanosecondsPerTick(Util::Math::divide(static_cast<uint64_t>(period) << 32, FEMTOSECONDS_PER_NANOSECOND, remainder));
+
+    writeRegister(CONFIGURATION, readRegister(CONFIGURATION) | ENABLE);
+}
+
+bool Hpet::isAvailable() {
+    return Acpi::isAvailable() && Acpi::hasTable("HPET");
+}
+
+uint64_t Hpet::readCounter() {
+    if (!wideCounter) {
+        auto counter = readRegister(MAIN_COUNTER);
+        if (counter < lastCounter) {
+            counterOverflows++;
+        }
+
+        lastCounter = counter;
+        return static_cast<uint64_t>(counterOverflows) << 32 | counter;
+    }
+
+    // The 64-bit counter can only be read in two halves -> Retry, if the upper half has changed in between
+    uint32_t high;
+    uint32_t low;
+    do {
+        high = readRegister(MAIN_COUNTER_HIGH);
+        low = readRegister(MAIN_COUNTER);
+    } while (high != readRegister(MAIN_COUNTER_HIGH));
+
+    return static_cast<uint64_t>(high) << 32 | low;
+}
+
+bool Hpet::requiresPeriodicReads() const {
+    return !wideCounter;
+}
+
+uint32_t Hpet::readRegister(Hpet::Register reg) const {
+    return registers[reg / sizeof(uint32_t)];
+}
+
+void Hpet::writeRegister(Hpet::Register reg, uint32_t value) {
+    registers[reg / sizeof(uint32_t)] = value;
+}
+
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_HPET_H
+#define HHUOS_HPET_H
+
+#include <cstdint>
+
+#include "ClockSource.h"
+
+namespace Device {
+
+/**
+ * High Precision Event Timer, found via the ACPI HPET table.
+ * Only its main counter is used, as a clock source with a resolution of at most 100 nanoseconds.
+ * The comparators are left untouched, so the legacy replacement routing of the PIT and RTC interrupts is not enabled.
+ */
+class Hpet : public ClockSource {
+
+public:
+    /**
+     * Constructor.
+     */
+    Hpet();
+
+    /**
+     * Copy Constructor.
+     */
+    Hpet(const Hpet &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    Hpet &operator=(const Hpet &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~Hpet() override = default;
+
+    [[nodiscard]] static bool isAvailable();
+
+    /**
+     * Overriding function from ClockSource.
+     */
+    [[nodiscard]] uint64_t readCounter() override;
+
+    /**
+     * Overriding function from ClockSource.
+     * A 32-bit main counter overflows every few minutes, which is only noticed if it is read at least that often.
+     */
+    [[nodiscard]] bool requiresPeriodicReads() const override;
+
+    static const constexpr uint32_t RATING = 250;
+
+private:
+
+    enum Register : uint32_t {
+        CAPABILITIES = 0x00,
+        COUNTER_PERIOD = 0x04,
+        CONFIGURATION = 0x10,
+        MAIN_COUNTER = 0xf0,
+        MAIN_COUNTER_HIGH = 0xf4
+    };
+
+    [[nodiscard]] uint32_t readRegister(Register reg) const;
+
+    void writeRegister(Register reg, uint32_t value);
+
+    volatile uint32_t *registers;
+    bool wideCounter;
+
+    // A 32-bit main counter is extended in software (readCounter() is only called with the clock source's lock held)
+    uint32_t lastCounter = 0;
+    uint32_t counterOverflows = 0;
+
+    static const constexpr uint32_t COUNTER_SIZE_CAPABILITY = 1 << 13;
+    static const constexpr uint32_t ENABLE = 1 << 0;
+    static const constexpr uint32_t FEMTOSECONDS_PER_NANOSECOND = 1000000;
+};
+
+}
+
+#endif
@@ -20,9 +20,12 @@
 #include "kernel/system/System.h"
 #include "kernel/log/Logger.h"
 #include "kernel/service/SchedulerService.h"
+#include "kernel/service/TimeService.h"
 #include "device/debug/FirmwareConfiguration.h"
 #include "device/interrupt/InterruptRequest.h"
 #include "kernel/interrupt/InterruptVector.h"
+#include "device/cpu/Cpu.h"
+#include "lib/util/math/Math.h"
 
 namespace Kernel {
 struct InterruptFrame;
@@ -32,12 +35,12 @@ namespace Device {
 
 Kernel::Logger Pit::log = Kernel::Logger::get("PIT");
 
-Pit::Pit(uint32_t timerInterval, uint32_t yieldInterval) : yieldInterval(yieldInterval) {
+Pit::Pit(uint32_t timerInterval, uint32_t yieldInterval) : ClockSource("PIT", RATING), yieldInterval(yieldInterval) {
     setInterruptRate(timerInterval);
 }
 
 void Pit::setInterruptRate(uint32_t interval) {
-    auto divisor = static_cast<uint32_t>(BASE_FREQUENCY * (interval / 1000.0));
+    divisor = static_cast<uint32_t>(BASE_FREQUENCY * (interval / 1000.0));
     if (divisor > UINT16_MAX) divisor = UINT16_MAX;
 
     timerInterval = static_cast<uint32_t>(1000000000 / (static_cast<double>(BASE_FREQUENCY) / divisor));
@@ -47,8 +50,12 @@ void Pit::setInterruptRate(uint32_t interval) {
     auto &interruptService = Kernel::System::getService<Kernel::InterruptService>();
     if (FirmwareConfiguration::isAvailable() && interruptService.usesApic()) {
         divisor *= 2;
+        if (divisor > UINT16_MAX) divisor = UINT16_MAX;
     }
 
+    uint32_t remainder;
+    setNanosecondsPerTick(Util::Math::divide(static_cast<uint64_t>(timerInterval) << 32, divisor, remainder));
+
     controlPort.writeByte(0x36); // Select channel 0, Use low-/high byte access mode, Set operating mode to rate generator
     dataPort0.writeByte((uint8_t) (divisor & 0xff)); // Low byte
     dataPort0.writeByte((uint8_t) (divisor >> 8)); // High byte
@@ -61,16 +68,90 @@ void Pit::plugin() {
 }
 
 void Pit::trigger(const Kernel::InterruptFrame &frame) {
+    timeLock.acquire();
     time.addNanoseconds(timerInterval);
+    interruptCount++;
+    timeLock.release();
+
+    // Publish the system time to user space (the time service is registered after the PIT has been plugged in)
+    if (Kernel::System::isServiceRegistered(Kernel::TimeService::SERVICE_ID)) {
+        Kernel::System::getService<Kernel::TimeService>().updateTimePage(timerInterval);
+    }
 
+    // With the APIC, every CPU's timer drives the scheduler and the profiler
     auto &interruptService = Kernel::System::getService<Kernel::InterruptService>();
-    if (!interruptService.usesApic() && time.toMilliseconds() % yieldInterval == 0) {
-        Kernel::System::getService<Kernel::SchedulerService>().yield();
+    if (interruptService.usesApic()) {
+        return;
+    }
+
+    auto &schedulerService = Kernel::System::getService<Kernel::SchedulerService>();
+    schedulerService.getProfiler().tick(frame, timerInterval);
+    if (time.toMilliseconds() % yieldInterval == 0) {
+        schedulerService.tick();
     }
 }
 
 Util::Time::Timestamp Pit::getTime() {
-    return time;
+    // May be called with interrupts disabled (e.g. by the scheduler), so the nesting counter is not used
+    auto flags = Device::Cpu::saveAndDisableInterrupts();
+    timeLock.acquire();
+
+    auto elapsedTicks = readElapsedTicks();
+    uint32_t remainder;
+    auto elapsedTime = static_cast<uint32_t>(Util::Math::divide(static_cast<uint64_t>(elapsedTicks) * timerInterval, divisor, remainder));
+    if (elapsedTime >= timerInterval) {
+        elapsedTime = timerInterval - 1;
+    }
+
+    auto result = time;
+    result.addNanoseconds(elapsedTime);
+
+    // The counter may already have been reloaded, while the interrupt is still pending -> Never go back in time
+    if (result < lastReadTime) {
+        result = lastReadTime;
+    } else {
+        lastReadTime = result;
+    }
+
+    timeLock.release();
+    Device::Cpu::restoreInterrupts(flags);
+
+    return result;
+}
+
+uint64_t Pit::readCounter() {
+    auto flags = Device::Cpu::saveAndDisableInterrupts();
+    timeLock.acquire();
+
+    auto counter = interruptCount * divisor + readElapsedTicks();
+    if (counter < lastCounter) {
+        counter = lastCounter;
+    } else {
+        lastCounter = counter;
+    }
+
+    timeLock.release();
+    Device::Cpu::restoreInterrupts(flags);
+
+    return counter;
+}
+
+bool Pit::requiresPeriodicReads() const {
+    return true;
+}
+
+void Pit::stop() {
+    auto &interruptService = Kernel::System::getService<Kernel::InterruptService>();
+    interruptService.forbidHardwareInterrupt(Device::InterruptRequest::PIT);
+    controlPort.writeByte(0x30); // Select channel 0, Use low-/high byte access mode, Set operating mode to interrupt on terminal count (halts until a new count is written)
+}
+
+uint32_t Pit::readElapsedTicks() {
+    controlPort.writeByte(0x00);
+    uint32_t counter = dataPort0.readByte();
+    counter |= dataPort0.readByte() << 8;
+
+    return counter < divisor ? divisor - counter : 0;
 }
 
 void Pit::earlyDelay(uint16_t us) {
@@ -22,8 +22,9 @@
 
 #include "kernel/interrupt/InterruptHandler.h"
 #include "device/cpu/IoPort.h"
-#include "TimeProvider.h"
+#include "ClockSource.h"
 #include "lib/util/time/Timestamp.h"
+#include "lib/util/async/Spinlock.h"
 
 namespace Kernel {
 class Logger;
@@ -32,7 +33,7 @@ struct InterruptFrame;
 
 namespace Device {
 
-class Pit : public Kernel::InterruptHandler, public TimeProvider {
+class Pit : public Kernel::InterruptHandler, public ClockSource {
 
 public:
     /**
@@ -70,9 +71,28 @@ public:
 
     /**
      * Overriding function from TimeProvider.
+     * The time since the last interrupt is read from the counter, so the resolution is not limited by the interrupt interval.
      */
     [[nodiscard]] Util::Time::Timestamp getTime() override;
 
+    /**
+     * Overriding function from ClockSource.
+     * Counts input clock ticks (at BASE_FREQUENCY) since the PIT has been initialized.
+     */
+    [[nodiscard]] uint64_t readCounter() override;
+
+    /**
+     * Overriding function from ClockSource.
+     * The PIT's time is advanced by its interrupt.
+     */
+    [[nodiscard]] bool requiresPeriodicReads() const override;
+
+    /**
+     * Stop the periodic interrupt. Used in tickless mode, once another clock source keeps the system time.
+     * The PIT's own time does not advance afterwards.
+     */
+    void stop();
+
     /**
      * Wait for a specified amount of time.
      *
@@ -84,6 +104,8 @@ public:
     static void earlyDelay(uint16_t us);
 
     static const constexpr uint32_t BASE_FREQUENCY = 1193182;
+    static const constexpr uint32_t RATING = 100; // Only used, if no other clock source is available
+    static const constexpr uint32_t TICKLESS_INTERVAL = 25; // Until the PIT is stopped. The divisor must still fit into 16 bits, if it is doubled (see setInterruptRate())
 
 private:
 
@@ -94,9 +116,22 @@ private:
      */
     void setInterruptRate(uint32_t interval);
 
+    /**
+     * Latch and read the counter of channel 0, which counts down from the divisor to 0 once per interrupt.
+     * Must be called with the time lock held.
+     *
+     * @return The number of input clock ticks since the last interrupt
+     */
+    uint32_t readElapsedTicks();
+
     Util::Time::Timestamp time{};
+    Util::Time::Timestamp lastReadTime{};
+    uint64_t interruptCount = 0;
+    uint64_t lastCounter = 0;
+    Util::Async::Spinlock timeLock;
     uint32_t timerInterval = 0;
     uint32_t yieldInterval;
+    uint32_t divisor = 0;
 
     IoPort controlPort = IoPort(0x43);
     IoPort dataPort0 = IoPort(0x40);
@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "TimestampCounter.h"
+
+#include "device/cpu/Cpu.h"
+#include "lib/util/hardware/CpuId.h"
+#include "lib/util/math/Math.h"
+
+namespace Device {
+
+TimestampCounter::TimestampCounter() : ClockSource("TSC", RATING) {}
+
+bool TimestampCounter::isAvailable() {
+    return Util::Hardware::CpuId::isInvariantTimestampCounterSupported();
+}
+
+void TimestampCounter::calibrate(TimeProvider &reference) {
+    auto startTime = reference.getTime();
+    auto startCycles = Device::Cpu::readTimestampCounter();
+
+    uint32_t elapsedTime;
+    uint64_t cycles;
+    do {
+        auto time = reference.getTime();
+        cycles = Device::Cpu::readTimestampCounter();
+        elapsedTime = (time.toSeconds() - startTime.toSeconds()) * 1000000000 + time.getFraction() - startTime.getFraction();
+    } while (elapsedTime < CALIBRATION_INTERVAL);
+
+    // The elapsed cycles fit into 32 bits, unless the counter runs faster than 40 GHz
+    uint32_t remainder;
+    auto elapsedCycles = static_cast<uint32_t>(cycles - startCycles);
+    setNanosecondsPerTick(Util::Math::divide(static_cast<uint64_t>(elapsedTime) << 32, elapsedCycles, remainder));
+}
+
+uint64_t TimestampCounter::readCounter() {
+    return Device::Cpu::readTimestampCounter();
+}
+
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_TIMESTAMPCOUNTER_H
+#define HHUOS_TIMESTAMPCOUNTER_H
+
+#include <cstdint>
+
+#include "ClockSource.h"
+
+namespace Device {
+
+/**
+ * Uses the time stamp counter of the CPU as clock source. It has the highest resolution and is the cheapest to read,
+ * but is only used, if it is invariant (constant rate, independent of power states). Since the counters of all CPUs
+ * are started at the same time, they are assumed to be synchronized (small differences are hidden by ClockSource::getTime()).
+ */
+class TimestampCounter : public ClockSource {
+
+public:
+    /**
+     * Constructor.
+     */
+    TimestampCounter();
+
+    /**
+     * Copy Constructor.
+     */
+    TimestampCounter(const TimestampCounter &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    TimestampCounter &operator=(const TimestampCounter &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~TimestampCounter() override = default;
+
+    [[nodiscard]] static bool isAvailable();
+
+    /**
+     * Measure the frequency of the time stamp counter by busy waiting on another time provider.
+     * Must be called with interrupts enabled, if the reference depends on timer interrupts.
+     */
+    void calibrate(TimeProvider &reference);
+
+    /**
+     * Overriding function from ClockSource.
+     */
+    [[nodiscard]] uint64_t readCounter() override;
+
+    static const constexpr uint32_t RATING = 300;
+
+private:
+
+    static const constexpr uint32_t CALIBRATION_INTERVAL = 100000000; // 100 ms
+};
+
+}
+
+#endif
@@ -31,87 +31,83 @@ class MemoryDriver;
 }  // namespace Memory
 
 
+Filesystem::MountPoint::MountPoint(Driver *driver) : driver(driver) {}
+
+Filesystem::MountPoint::~MountPoint() {
+    delete driver;
+}
+
 bool Filesystem::mount(const Util::String &deviceName, const Util::String &targetPath, const Util::String &driverName) {
     auto &storageService = Kernel::System::getService<Kernel::StorageService>();
     if (!storageService.isDeviceRegistered(deviceName)) {
         return false;
     }
 
-    lock.acquire();
-
     auto parsedPath = Util::Io::File::getCanonicalPath(targetPath) + Util::Io::File::SEPARATOR;
     auto *targetNode = getNode(parsedPath);
-    if (targetNode == nullptr) {
-        if (mountPoints.size() != 0) {
-            return lock.releaseAndReturn(false);
-        }
+    auto targetExists = targetNode != nullptr;
+    delete targetNode;
+
+    lock.acquireWrite();
+
+    if ((!targetExists && mountPoints.size() != 0) || mountPoints.containsKey(parsedPath)) {
+        return lock.releaseWriteAndReturn(false);
     }
 
     auto &device = storageService.getDevice(deviceName);
     auto *driver = INSTANCE_FACTORY_CREATE_INSTANCE(PhysicalDriver, driverName);
     if (driver == nullptr || !driver->mount(device)) {
         delete driver;
-        return lock.releaseAndReturn(false);
-    }
-
-    if (mountPoints.containsKey(parsedPath)) {
-        return lock.releaseAndReturn(false);
+        return lock.releaseWriteAndReturn(false);
     }
 
-    mountPoints.put(parsedPath, driver);
+    mountPoints.put(parsedPath, new MountPoint(driver));
     mountInformation.put(parsedPath, {deviceName, targetPath, driverName});
-    return lock.releaseAndReturn(true);
+    return lock.releaseWriteAndReturn(true);
 }
 
 bool Filesystem::mountVirtualDriver(const Util::String &targetPath, VirtualDriver *driver) {
     auto parsedPath = Util::Io::File::getCanonicalPath(targetPath) + Util::Io::File::SEPARATOR;
-
-    lock.acquire();
-
     auto *targetNode = getNode(parsedPath);
-    if (targetNode == nullptr) {
-        if (mountPoints.size() != 0) {
-            return lock.releaseAndReturn(false);
-        }
-    }
-
+    auto targetExists = targetNode != nullptr;
     delete targetNode;
 
-    if (mountPoints.containsKey(parsedPath)) {
-        return lock.releaseAndReturn(false);
+    lock.acquireWrite();
+
+    if ((!targetExists && mountPoints.size() != 0) || mountPoints.containsKey(parsedPath)) {
+        return lock.releaseWriteAndReturn(false);
     }
 
-    mountPoints.put(parsedPath, driver);
+    mountPoints.put(parsedPath, new MountPoint(driver));
     mountInformation.put(parsedPath, {"Virtual", targetPath, "VirtualDriver"});
-    return lock.releaseAndReturn(true);
+    return lock.releaseWriteAndReturn(true);
 }
 
 Memory::MemoryDriver& Filesystem::getVirtualDriver(const Util::String &path) {
-    lock.acquire();
     auto parsedPath = Util::Io::File::getCanonicalPath(path) + Util::Io::File::SEPARATOR;
-    auto *driver = mountPoints.get(parsedPath);
+    lock.acquireRead();
+    auto *driver = mountPoints.get(parsedPath)->driver;
 
-    return lock.releaseAndReturn<Memory::MemoryDriver&>(*reinterpret_cast<Memory::MemoryDriver*>(driver));
+    return lock.releaseReadAndReturn<Memory::MemoryDriver&>(*reinterpret_cast<Memory::MemoryDriver*>(driver));
 }
 
 bool Filesystem::unmount(const Util::String &path) {
     auto parsedPath = Util::Io::File::getCanonicalPath(path) + Util::Io::File::SEPARATOR;
-
-    lock.acquire();
-
     auto *targetNode = getNode(parsedPath);
     if (targetNode == nullptr) {
         if (path != "/") {
-            return lock.releaseAndReturn(false);
+            return false;
         }
     }
 
     delete targetNode;
 
+    lock.acquireWrite();
+
     for(const Util::String &key : mountPoints.keys()) {
         if(key.beginsWith(parsedPath)) {
             if(key != parsedPath) {
-                return lock.releaseAndReturn(false);
+                return lock.releaseWriteAndReturn(false);
             }
         }
     }
@@ -119,10 +115,10 @@ bool Filesystem::unmount(const Util::String &path) {
     if(mountPoints.containsKey(parsedPath)) {
         mountInformation.remove(parsedPath);
         delete mountPoints.remove(parsedPath);
-        return lock.releaseAndReturn(true);
+        return lock.releaseWriteAndReturn(true);
     }
 
-    return lock.releaseAndReturn(false);
+    return lock.releaseWriteAndReturn(false);
 }
 
 bool Filesystem::createFilesystem(const Util::String &deviceName, const Util::String &driverName) {
@@ -131,83 +127,93 @@ bool Filesystem::createFilesystem(const Util::String &deviceName, const Util::St
         return false;
     }
 
-    lock.acquire();
+    // Formatting must not overlap with mounting
+    lock.acquireWrite();
 
     auto &device = storageService.getDevice(deviceName);
     auto *driver = INSTANCE_FACTORY_CREATE_INSTANCE(PhysicalDriver, driverName);
     auto result = driver->createFilesystem(device);
 
     delete driver;
-    return lock.releaseAndReturn(result);
+    return lock.releaseWriteAndReturn(result);
 }
 
 Node* Filesystem::getNode(const Util::String &path) {
     auto parsedPath = Util::Io::File::getCanonicalPath(path);
-    lock.acquire();
+    lock.acquireRead();
 
-    auto *driver = getMountedDriver(parsedPath);
-    if (driver == nullptr) {
-        return lock.releaseAndReturn(nullptr);
+    auto *mountPoint = getMountPoint(parsedPath);
+    if (mountPoint == nullptr) {
+        return lock.releaseReadAndReturn(nullptr);
     }
 
-    Node *ret = driver->getNode(parsedPath);
-    return lock.releaseAndReturn(ret);
+    mountPoint->lock.acquire();
+    Node *ret = mountPoint->driver->getNode(parsedPath);
+    mountPoint->lock.release();
+
+    return lock.releaseReadAndReturn(ret);
 }
 
 bool Filesystem::createFile(const Util::String &path) {
     auto parsedPath = Util::Io::File::getCanonicalPath(path);
-    lock.acquire();
+    lock.acquireRead();
 
-    auto *driver = getMountedDriver(parsedPath);
-    if (driver == nullptr) {
-        return lock.releaseAndReturn(false);
+    auto *mountPoint = getMountPoint(parsedPath);
+    if (mountPoint == nullptr) {
+        return lock.releaseReadAndReturn(false);
     }
 
-    bool ret = driver->createNode(parsedPath, Util::Io::File::REGULAR);
-    return lock.releaseAndReturn(ret);
+    mountPoint->lock.acquire();
+    bool ret = mountPoint->driver->createNode(parsedPath, Util::Io::File::REGULAR);
+    mountPoint->lock.release();
+
+    return lock.releaseReadAndReturn(ret);
 }
 
 bool Filesystem::createDirectory(const Util::String &path) {
     auto parsedPath = Util::Io::File::getCanonicalPath(path);
-    lock.acquire();
+    lock.acquireRead();
 
-    auto *driver = getMountedDriver(parsedPath);
-    if (driver == nullptr) {
-        return lock.releaseAndReturn(false);
+    auto *mountPoint = getMountPoint(parsedPath);
+    if (mountPoint == nullptr) {
+        return lock.releaseReadAndReturn(false);
     }
 
-    bool ret = driver->createNode(parsedPath, Util::Io::File::DIRECTORY);
-    return lock.releaseAndReturn(ret);
+    mountPoint->lock.acquire();
+    bool ret = mountPoint->driver->createNode(parsedPath, Util::Io::File::DIRECTORY);
+    mountPoint->lock.release();
+
+    return lock.releaseReadAndReturn(ret);
 }
 
 bool Filesystem::deleteFile(const Util::String &path) {
     auto parsedPath = Util::Io::File::getCanonicalPath(path);
-    lock.acquire();
+    lock.acquireRead();
 
     for (const Util::String &key : mountPoints.keys()) {
         if (key.beginsWith(parsedPath)) {
-            lock.release();
+            lock.releaseRead();
             return false;
         }
     }
 
-    auto *driver = getMountedDriver(parsedPath);
-    if (driver == nullptr) {
-        return lock.releaseAndReturn(false);
+    auto *mountPoint = getMountPoint(parsedPath);
+    if (mountPoint == nullptr) {
+        return lock.releaseReadAndReturn(false);
     }
 
-    bool ret = driver->deleteNode(parsedPath);
-    return lock.releaseAndReturn<bool>(ret);
+    mountPoint->lock.acquire();
+    bool ret = mountPoint->driver->deleteNode(parsedPath);
+    mountPoint->lock.release();
+
+    return lock.releaseReadAndReturn<bool>(ret);
 }
 
-Driver* Filesystem::getMountedDriver(Util::String &path) {
+Filesystem::MountPoint* Filesystem::getMountPoint(Util::String &path) {
     if (!path.endsWith(Util::Io::File::SEPARATOR)) {
         path += Util::Io::File::SEPARATOR;
     }
 
-
-    lock.acquire();
-
     Util::String ret;
     for (const Util::String &currentString: mountPoints.keys()) {
         if (path.beginsWith(currentString)) {
@@ -218,16 +224,16 @@ Driver* Filesystem::getMountedDriver(Util::String &path) {
     }
 
     if (ret.isEmpty()) {
-        return lock.releaseAndReturn(nullptr);
+        return nullptr;
     }
 
     path = path.substring(ret.length(), path.length() - 1);
-    return lock.releaseAndReturn(mountPoints.get(ret));
+    return mountPoints.get(ret);
 }
 
 Util::Array<MountInformation> Filesystem::getMountInformation() {
-    lock.acquire();
-    return lock.releaseAndReturn(mountInformation.values());
+    lock.acquireRead();
+    return lock.releaseReadAndReturn(mountInformation.values());
 }
 
 bool MountInformation::operator!=(const MountInformation &other) const {
@@ -18,6 +18,7 @@
 #ifndef HHUOS_FILESYSTEM_H
 #define HHUOS_FILESYSTEM_H
 
+#include "lib/util/async/ReadWriteLock.h"
 #include "lib/util/async/ReentrantSpinlock.h"
 #include "lib/util/collection/HashMap.h"
 #include "lib/util/collection/Array.h"
@@ -168,21 +169,38 @@ public:
     
 private:
     /**
-     * Get the driver, that is mounted at a specified path.
-     * The path needs to be absolute.
+     * A mounted driver. Drivers are not thread-safe, so all requests to the same driver are serialized with its lock,
+     * while requests to different mount points may be processed concurrently.
+     */
+    struct MountPoint {
+        explicit MountPoint(Driver *driver);
+
+        MountPoint(const MountPoint &other) = delete;
+
+        MountPoint &operator=(const MountPoint &other) = delete;
+
+        ~MountPoint();
+
+        Driver *driver;
+        Util::Async::ReentrantSpinlock lock;
+    };
+
+    /**
+     * Get the mount point, that a specified path belongs to.
+     * The path needs to be absolute and the caller must hold the filesystem lock (at least for reading).
      * CAUTION: May return nullptr, if the file does not exist.
      *          Always check the return value!
      *
      * @param path The path. After successful execution, the part up to the mount point will be truncated,
-     *             so that the path can be used for the returned driver.
+     *             so that the path can be used for the mount point's driver.
      *
-     * @return The driver (or nullptr on failure)
+     * @return The mount point (or nullptr on failure)
      */
-    [[nodiscard]] Driver* getMountedDriver(Util::String &path);
+    [[nodiscard]] MountPoint* getMountPoint(Util::String &path);
 
-    Util::HashMap<Util::String, Driver*> mountPoints;
+    Util::HashMap<Util::String, MountPoint*> mountPoints;
     Util::HashMap<Util::String, MountInformation> mountInformation;
-    Util::Async::ReentrantSpinlock lock;
+    Util::Async::ReadWriteLock lock; // Mount points are looked up for every filesystem request, but rarely changed
 };
 
 }
@@ -112,6 +112,16 @@ public:
     virtual bool control(uint32_t request, const Util::Array<uint32_t> &parameters) {
         return false;
     }
+
+    /**
+     * Get a stamp, that identifies the node's file and changes, whenever its content is modified or the file is replaced.
+     * It is used to decide, if pages loaded from an executable earlier may be shared with new processes.
+     *
+     * @return The stamp, or 0 if the filesystem can not identify the content (it is never shared)
+     */
+    virtual uint64_t getContentStamp() {
+        return 0;
+    }
 };
 
 }
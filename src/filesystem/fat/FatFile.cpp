@@ -19,9 +19,12 @@
 
 #include "filesystem/fat/FatNode.h"
 #include "lib/util/base/String.h"
+#include "lib/util/async/Atomic.h"
 
 namespace Filesystem::Fat {
 
+uint32_t FatFile::writeGeneration = 0;
+
 FatFile::FatFile(FIL *file, FILINFO *info) : FatNode(info), file(file) {}
 
 FatFile::~FatFile() {
@@ -64,7 +67,12 @@ uint64_t FatFile::writeData(const uint8_t *sourceBuffer, uint64_t pos, uint64_t
     }
 
     f_sync(file);
+    Util::Async::Atomic<uint32_t>(writeGeneration).inc();
     return writtenBytes;
 }
 
+uint64_t FatFile::getContentStamp() {
+    return static_cast<uint64_t>(writeGeneration) << 32 | file->obj.sclust;
+}
+
 }
\ No newline at end of file
@@ -76,9 +76,17 @@ public:
      */
     uint64_t writeData(const uint8_t *sourceBuffer, uint64_t pos, uint64_t numBytes) override;
 
+    /**
+     * Overriding function from Node.
+     * Combines the file's first cluster with a counter of all writes to FAT files, since timestamps may be unavailable.
+     */
+    uint64_t getContentStamp() override;
+
 private:
 
     FIL *file;
+
+    static uint32_t writeGeneration;
 };
 
 }
@@ -18,9 +18,12 @@
 #include "lib/util/base/Address.h"
 #include "MemoryFileNode.h"
 #include "filesystem/memory/MemoryNode.h"
+#include "lib/util/async/Atomic.h"
 
 namespace Filesystem::Memory {
 
+uint32_t MemoryFileNode::lastContentStamp = 0;
+
 MemoryFileNode::MemoryFileNode(const Util::String &name) : MemoryNode(name) {}
 
 Util::Io::File::Type MemoryFileNode::getType() {
@@ -70,8 +73,18 @@ uint64_t MemoryFileNode::writeData(const uint8_t *sourceBuffer, uint64_t pos, ui
 
     auto targetAddress = Util::Address<uint32_t>(data).add(pos);
     targetAddress.copyRange(sourceAddress, numBytes);
+    contentStamp = createContentStamp();
 
     return numBytes;
 }
 
+uint64_t MemoryFileNode::getContentStamp() {
+    return contentStamp;
+}
+
+uint32_t MemoryFileNode::createContentStamp() {
+    // Stamps are unique among all memory files, so that a new file at the same path never has the stamp of the old one
+    return Util::Async::Atomic<uint32_t>(lastContentStamp).fetchAndInc() + 1;
+}
+
 }
\ No newline at end of file
@@ -75,10 +75,17 @@ public:
      */
     uint64_t writeData(const uint8_t *sourceBuffer, uint64_t pos, uint64_t numBytes) override;
 
+    uint64_t getContentStamp() override;
+
 private:
 
+    [[nodiscard]] static uint32_t createContentStamp();
+
     uint64_t length = 0;
     uint8_t *data = nullptr;
+    uint32_t contentStamp = createContentStamp();
+
+    static uint32_t lastContentStamp;
 
 };
 
@@ -91,6 +91,11 @@ public:
      */
     bool control(uint32_t request, const Util::Array<uint32_t> &parameters) override;
 
+    /**
+     * Overriding function from Node.
+     */
+    uint64_t getContentStamp() override;
+
 private:
 
     MemoryNode &node;
@@ -34,7 +34,7 @@ uint64_t ProcessDirectoryNode::getLength() {
 }
 
 Util::Array<Util::String> ProcessDirectoryNode::getChildren() {
-    return Util::Array<Util::String>({"name", "cwd", "thread_count"});
+    return Util::Array<Util::String>({"name", "cwd", "thread_count", "cpu_cycles", "voluntary_switches", "involuntary_switches", "page_faults", "system_calls"});
 }
 
 uint64_t ProcessDirectoryNode::readData(uint8_t *targetBuffer, uint64_t pos, uint64_t numBytes) {
@@ -42,25 +42,39 @@ Node* ProcessDriver::getNode(const Util::String &path) {
     auto splitPath = path.split(Util::Io::File::SEPARATOR);
     auto id = Util::String::parseInt(splitPath[0]);
 
-    auto *process = processService.getProcess(id);
+    // The process may exit, while the node is created -> Keep it alive until then
+    auto *process = processService.acquireProcess(id);
     if (process == nullptr) {
         return nullptr;
     }
 
+    Node *node = nullptr;
+
     if (splitPath.length() == 1) {
-        return new ProcessDirectoryNode(id);
+        node = new ProcessDirectoryNode(id);
     } else if (splitPath.length() == 2) {
         const auto &name = splitPath[1];
         if (name == "name") {
-            return new ProcessFileNode(name, process->getName());
+            node = new ProcessFileNode(name, process->getName());
         } else if (name == "cwd") {
-            return new ProcessFileNode(name, process->getWorkingDirectory().getCanonicalPath());
+            node = new ProcessFileNode(name, process->getWorkingDirectory().getCanonicalPath());
         } else if (name == "thread_count") {
-            return new ProcessFileNode(name, Util::String::format("%u", process->getThreadCount()));
+            node = new ProcessFileNode(name, Util::String::format("%u", process->getThreadCount()));
+        } else if (name == "cpu_cycles") {
+            node = new ProcessFileNode(name, Util::String::toDecimalString(process->getStatistics().cpuCycles));
+        } else if (name == "voluntary_switches") {
+            node = new ProcessFileNode(name, Util::String::format("%u", process->getStatistics().voluntaryContextSwitches));
+        } else if (name == "involuntary_switches") {
+            node = new ProcessFileNode(name, Util::String::format("%u", process->getStatistics().involuntaryContextSwitches));
+        } else if (name == "page_faults") {
+            node = new ProcessFileNode(name, Util::String::format("%u", process->getStatistics().pageFaults));
+        } else if (name == "system_calls") {
+            node = new ProcessFileNode(name, Util::String::format("%u", process->getStatistics().systemCalls));
         }
     }
 
-    return nullptr;
+    process->removeReference();
+    return node;
 }
 
 bool ProcessDriver::createNode(const Util::String &path, Util::Io::File::Type type) {
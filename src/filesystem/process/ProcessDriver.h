@@ -18,6 +18,8 @@
 #ifndef HHUOS_PROCESSDRIVER_H
 #define HHUOS_PROCESSDRIVER_H
 
+#include <cstdint>
+
 #include "filesystem/core/VirtualDriver.h"
 #include "lib/util/base/String.h"
 #include "lib/util/io/file/File.h"
@@ -52,4 +52,8 @@ uint64_t ArchiveFileNode::writeData(const uint8_t *sourceBuffer, uint64_t pos, u
     return 0;
 }
 
+uint64_t ArchiveFileNode::getContentStamp() {
+    return dataAddress.get();
+}
+
 }
\ No newline at end of file
@@ -65,6 +65,12 @@ public:
      */
     uint64_t writeData(const uint8_t *sourceBuffer, uint64_t pos, uint64_t numBytes) override;
 
+    /**
+     * Overriding function from Node.
+     * Archives are read-only, so the file's location in the archive identifies its content.
+     */
+    uint64_t getContentStamp() override;
+
 private:
 
     uint32_t length = 0;
@@ -68,4 +68,8 @@ Filesystem::Node &FileDescriptorManager::getNode(int32_t fileDescriptor) {
     return *node;
 }
 
+bool FileDescriptorManager::isValid(int32_t fileDescriptor) const {
+    return fileDescriptor >= 0 && fileDescriptor < size && descriptorTable[fileDescriptor] != nullptr;
+}
+
 }
\ No newline at end of file
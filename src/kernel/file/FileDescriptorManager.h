@@ -42,6 +42,8 @@ public:
 
     Filesystem::Node& getNode(int32_t fileDescriptor);
 
+    [[nodiscard]] bool isValid(int32_t fileDescriptor) const;
+
 private:
 
     int32_t size;
@@ -29,9 +29,15 @@
 #include "lib/util/io/stream/PrintStream.h"
 #include "lib/util/base/System.h"
 #include "kernel/interrupt/InterruptVector.h"
+#include "kernel/log/Trace.h"
+#include "kernel/system/PerCpu.h"
 
 namespace Kernel {
 
+InterruptDispatcher::InterruptDispatcher() {
+    addCpu(0);
+}
+
 void InterruptDispatcher::dispatch(const InterruptFrame &frame) {
     auto &interruptService = System::getService<InterruptService>();
     auto slot = static_cast<InterruptVector>(frame.interrupt);
@@ -49,9 +55,16 @@ void InterruptDispatcher::dispatch(const InterruptFrame &frame) {
 
     // Ignore spurious interrupts
     if (interruptService.checkSpuriousInterrupt(slot)) {
+        recordSpurious(slot);
         return;
     }
 
+    // System calls have their own tracepoints and may block, so they are not recorded as interrupts
+    auto traced = slot != SYSTEM_CALL;
+    if (traced) {
+        Trace::tracepoint(Trace::INTERRUPT_ENTER, slot);
+    }
+
     // Throw exception, if there is no handler registered
     auto *handlerList = handler[slot];
     if (handlerList == nullptr) {
@@ -59,11 +72,99 @@ void InterruptDispatcher::dispatch(const InterruptFrame &frame) {
     }
 
     // Call installed interrupt handlers
+    auto contextSwitches = CpuLocal::contextSwitches.get();
+    auto startCycles = Device::Cpu::readTimestampCounter();
     for (uint32_t i = 0; i < handlerList->size(); i++) {
         handlerList->get(i)->trigger(frame);
     }
 
+    auto endCycles = Device::Cpu::readTimestampCounter();
+    if (traced) {
+        // A handler may have switched to another thread (e.g. the scheduler's timer tick), which also means,
+        // that the interrupted thread may now run on another CPU -> The measured cycles would include other threads
+        record(slot, endCycles - startCycles, CpuLocal::contextSwitches.get() != contextSwitches);
+    }
+
     interruptService.sendEndOfInterrupt(slot);
+    if (traced) {
+        Trace::tracepoint(Trace::INTERRUPT_EXIT, slot);
+    }
+}
+
+void InterruptDispatcher::addCpu(uint8_t cpuId) {
+    if (cpuStatistics[cpuId] == nullptr) {
+        cpuStatistics[cpuId] = new CpuStatistics{};
+    }
+}
+
+InterruptDispatcher::Statistics InterruptDispatcher::getStatistics(uint8_t slot) {
+    // The bootstrap processor's old table (CPU 0) is still summed up, after it has moved to its local APIC id
+    Statistics result{};
+    for (auto *cpu : cpuStatistics) {
+        if (cpu == nullptr) {
+            continue;
+        }
+
+        Statistics snapshot{};
+        uint32_t sequence;
+        do {
+            sequence = cpu->sequence[slot];
+            asm volatile ("" ::: "memory");
+            snapshot = cpu->vectors[slot];
+            asm volatile ("" ::: "memory");
+        } while ((sequence & 1) != 0 || sequence != cpu->sequence[slot]);
+
+        result += snapshot;
+    }
+
+    return result;
+}
+
+void InterruptDispatcher::recordSpurious(uint8_t slot) {
+    auto *cpu = cpuStatistics[CpuLocal::cpuId.get()];
+    if (cpu == nullptr) {
+        return;
+    }
+
+    cpu->sequence[slot]++;
+    asm volatile ("" ::: "memory");
+
+    cpu->vectors[slot].spuriousCount++;
+
+    asm volatile ("" ::: "memory");
+    cpu->sequence[slot]++;
+}
+
+void InterruptDispatcher::record(uint8_t slot, uint64_t cycles, bool switched) {
+    auto *cpu = cpuStatistics[CpuLocal::cpuId.get()];
+    if (cpu == nullptr) {
+        return;
+    }
+
+    // Bucket = floor(log2(cycles)), all invocations longer than 2^32 cycles end up in the last bucket
+    auto bucket = Statistics::HISTOGRAM_SIZE - 1;
+    if (cycles <= UINT32_MAX) {
+        auto lowCycles = static_cast<uint32_t>(cycles);
+        bucket = lowCycles == 0 ? 0 : 31 - __builtin_clz(lowCycles);
+    }
+
+    cpu->sequence[slot]++;
+    asm volatile ("" ::: "memory");
+
+    auto &entry = cpu->vectors[slot];
+    entry.count++;
+    if (switched) {
+        entry.switchCount++;
+    } else {
+        entry.totalCycles += cycles;
+        entry.histogram[bucket]++;
+        if (cycles > entry.maxCycles) {
+            entry.maxCycles = cycles;
+        }
+    }
+
+    asm volatile ("" ::: "memory");
+    cpu->sequence[slot]++;
 }
 
 void InterruptDispatcher::assign(uint8_t slot, InterruptHandler &isr) {
@@ -74,6 +175,22 @@ void InterruptDispatcher::assign(uint8_t slot, InterruptHandler &isr) {
     handler[slot]->add(&isr);
 }
 
+InterruptDispatcher::Statistics& InterruptDispatcher::Statistics::operator+=(const InterruptDispatcher::Statistics &other) {
+    count += other.count;
+    spuriousCount += other.spuriousCount;
+    switchCount += other.switchCount;
+    totalCycles += other.totalCycles;
+    if (other.maxCycles > maxCycles) {
+        maxCycles = other.maxCycles;
+    }
+
+    for (uint32_t i = 0; i < HISTOGRAM_SIZE; i++) {
+        histogram[i] += other.histogram[i];
+    }
+
+    return *this;
+}
+
 bool InterruptDispatcher::isUnrecoverableException(InterruptVector slot) {
     return (slot < PIT || (slot >= NULL_POINTER && slot <= UNSUPPORTED_OPERATION)) && handler[slot] == nullptr;
 }
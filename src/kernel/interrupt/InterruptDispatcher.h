@@ -42,10 +42,33 @@ class InterruptDispatcher {
 
 public:
 
+    /**
+     * Counters for a single interrupt vector. Each CPU counts its own interrupts, which are summed up when read.
+     * Cycles are measured with the timestamp counter from the first to the last handler of the vector,
+     * which is the time the handlers run with interrupts disabled.
+     * Bucket n of the histogram counts the invocations, that took [2^n, 2^(n+1)) cycles.
+     */
+    struct Statistics {
+        uint32_t count;
+        uint32_t spuriousCount;
+        uint32_t switchCount; // Invocations, which switched to another thread and are therefore not timed
+        uint64_t totalCycles;
+        uint64_t maxCycles;
+        uint32_t histogram[32];
+
+        /**
+         * Add the counters of another CPU. The maximum is the larger one of both.
+         */
+        Statistics& operator+=(const Statistics &other);
+
+        static const constexpr uint32_t HISTOGRAM_SIZE = sizeof(histogram) / sizeof(histogram[0]);
+    };
+
     /**
      * Default Constructor.
+     * Prepares the statistics of the bootstrap processor, which is registered as CPU 0 until its local APIC id is known.
      */
-    InterruptDispatcher() = default;
+    InterruptDispatcher();
 
     InterruptDispatcher(const InterruptDispatcher &other) = delete;
 
@@ -68,12 +91,43 @@ public:
      */
     void dispatch(const InterruptFrame &frame);
 
+    /**
+     * Prepare the statistics of a CPU. Must be called, before the CPU handles interrupts,
+     * since the statistics can not be allocated in an interrupt handler. Interrupts of unknown CPUs are not counted.
+     *
+     * @param cpuId The CPU's local APIC id
+     */
+    void addCpu(uint8_t cpuId);
+
+    /**
+     * Sum up the statistics of an interrupt vector over all CPUs.
+     * Each CPU's counters are copied consistently, but the CPUs may continue counting, while they are summed up.
+     * System calls are not recorded, since they may block and do not run with interrupts disabled.
+     */
+    [[nodiscard]] Statistics getStatistics(uint8_t slot);
+
 private:
 
     bool isUnrecoverableException(Kernel::InterruptVector slot);
 
+    void recordSpurious(uint8_t slot);
+
+    void record(uint8_t slot, uint64_t cycles, bool switched);
+
+    /**
+     * The counters of all interrupt vectors on a single CPU.
+     * They are only written by the CPU itself, so no lock is needed (which would deadlock, if an NMI interrupted its holder).
+     * The sequence number of a vector is odd, while its counters are updated. Readers retry, until it is even and unchanged.
+     */
+    struct CpuStatistics {
+        Statistics vectors[256];
+        uint32_t sequence[256];
+    };
+
     Util::List<InterruptHandler*>* handler[256];
 
+    CpuStatistics *cpuStatistics[256]{}; // Indexed by local APIC id
+
 };
 
 }
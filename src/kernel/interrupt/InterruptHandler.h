@@ -51,6 +51,12 @@ public:
      * Routine to handle an interrupt. Needs to be implemented in deriving class.
      */
     virtual void trigger(const InterruptFrame &frame) = 0;
+
+    /**
+     * Deferred part of the interrupt handling, which runs with interrupts enabled.
+     * Only called, after the handler has queued itself via InterruptService::deferWork().
+     */
+    virtual void processDeferredWork() {}
 };
 
 }
@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "InterruptStatisticsNode.h"
+
+#include "device/cpu/Cpu.h"
+#include "kernel/interrupt/InterruptVector.h"
+#include "kernel/service/InterruptService.h"
+#include "kernel/system/System.h"
+
+namespace Kernel {
+
+InterruptStatisticsNode::InterruptStatisticsNode(const Util::String &name) : StringNode(name) {}
+
+Util::String InterruptStatisticsNode::getString() {
+    auto &interruptService = System::getService<InterruptService>();
+
+    Util::String result;
+    for (uint32_t i = 0; i < 256; i++) {
+        auto statistics = interruptService.getInterruptStatistics(static_cast<InterruptVector>(i));
+        if (statistics.count == 0 && statistics.spuriousCount == 0) {
+            continue;
+        }
+
+        result += Util::String::format("%u", i);
+        if (i < PIT) {
+            result += Util::String(" (") + Device::Cpu::getExceptionName(i) + ")";
+        }
+
+        result += Util::String::format(": count=%u, spurious=%u, switched=%u, total_cycles=", statistics.count, statistics.spuriousCount, statistics.switchCount);
+        result += Util::String::toDecimalString(statistics.totalCycles) + ", max_cycles=" + Util::String::toDecimalString(statistics.maxCycles);
+
+        result += ", histogram=";
+        for (uint32_t j = 0; j < InterruptDispatcher::Statistics::HISTOGRAM_SIZE; j++) {
+            if (statistics.histogram[j] > 0) {
+                result += Util::String::format(" %u:%u", j, statistics.histogram[j]);
+            }
+        }
+
+        result += "\n";
+    }
+
+    return result;
+}
+
+}
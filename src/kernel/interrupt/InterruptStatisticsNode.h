@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_INTERRUPTSTATISTICSNODE_H
+#define HHUOS_INTERRUPTSTATISTICSNODE_H
+
+#include "filesystem/memory/StringNode.h"
+#include "lib/util/base/String.h"
+
+namespace Kernel {
+
+/**
+ * Lists the counters of all interrupt vectors, that have been raised at least once (see InterruptDispatcher::Statistics).
+ * The histogram is printed as "<n>:<count>" pairs for all non-empty buckets, with bucket n covering [2^n, 2^(n+1)) cycles.
+ */
+class InterruptStatisticsNode : public Filesystem::Memory::StringNode {
+
+public:
+    /**
+     * Constructor.
+     */
+    explicit InterruptStatisticsNode(const Util::String &name);
+
+    /**
+     * Copy Constructor.
+     */
+    InterruptStatisticsNode(const InterruptStatisticsNode &copy) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    InterruptStatisticsNode& operator=(const InterruptStatisticsNode &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~InterruptStatisticsNode() override = default;
+
+    /**
+     * Overriding function from StringNode.
+     */
+    Util::String getString() override;
+};
+
+}
+
+#endif
@@ -82,6 +82,7 @@ enum InterruptVector : uint8_t {
     UNSUPPORTED_OPERATION = 0xd3,
 
     // Local APIC interrupts (247 - 254)
+    WAKEUP = 0xf7, // Interprocessor interrupt, that ends the halt of an idle CPU
     CMCI = 0xf8,
     APICTIMER = 0xf9,
     THERMAL = 0xfa,
@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "WorkQueue.h"
+
+#include "device/cpu/Cpu.h"
+#include "kernel/interrupt/InterruptHandler.h"
+#include "lib/util/base/Exception.h"
+
+namespace Kernel {
+
+void WorkQueue::submit(InterruptHandler &handler) {
+    auto flags = Device::Cpu::saveAndDisableInterrupts();
+    acquireLock();
+
+    for (uint32_t i = 0; i < count; i++) {
+        if (pending[(head + i) % CAPACITY] == &handler) {
+            lock.release();
+            Device::Cpu::restoreInterrupts(flags);
+            return;
+        }
+    }
+
+    if (count == CAPACITY) {
+        lock.release();
+        Device::Cpu::restoreInterrupts(flags);
+        Util::Exception::throwException(Util::Exception::OUT_OF_BOUNDS, "WorkQueue: Too much deferred work!");
+    }
+
+    pending[(head + count) % CAPACITY] = &handler;
+    count++;
+
+    lock.release();
+    Device::Cpu::restoreInterrupts(flags);
+
+    if (workerRunning) {
+        waitQueue.notify();
+    }
+}
+
+void WorkQueue::drain() {
+    auto *handler = poll();
+    while (handler != nullptr) {
+        handler->processDeferredWork();
+        handler = poll();
+    }
+}
+
+bool WorkQueue::isWorkerRunning() const {
+    return workerRunning;
+}
+
+void WorkQueue::run() {
+    workerRunning = true;
+
+    while (true) {
+        waitQueue.waitUntil([this]() {
+            return count > 0;
+        });
+
+        drain();
+    }
+}
+
+void WorkQueue::acquireLock() {
+    // Interrupts are disabled and the lock is only held for a few instructions, so there is no need to yield
+    while (!lock.tryAcquire()) {
+        asm volatile ("pause");
+    }
+}
+
+InterruptHandler* WorkQueue::poll() {
+    auto flags = Device::Cpu::saveAndDisableInterrupts();
+    acquireLock();
+
+    InterruptHandler *handler = nullptr;
+    if (count > 0) {
+        handler = pending[head];
+        head = (head + 1) % CAPACITY;
+        count--;
+    }
+
+    lock.release();
+    Device::Cpu::restoreInterrupts(flags);
+
+    return handler;
+}
+
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_WORKQUEUE_H
+#define HHUOS_WORKQUEUE_H
+
+#include <cstdint>
+
+#include "kernel/process/WaitQueue.h"
+#include "lib/util/async/Runnable.h"
+#include "lib/util/async/Spinlock.h"
+
+namespace Kernel {
+class InterruptHandler;
+
+/**
+ * Queue for deferred interrupt work (bottom halves).
+ * An interrupt handler only acknowledges its device and queues itself via InterruptService::deferWork().
+ * The queued handlers are processed by a high priority kernel thread with interrupts enabled,
+ * so that long running work (e.g. copying received packets) does not delay other interrupts.
+ * As long as the worker thread is not running, the queue is drained on interrupt exit instead.
+ */
+class WorkQueue : public Util::Async::Runnable {
+
+public:
+    /**
+     * Default Constructor.
+     */
+    WorkQueue() = default;
+
+    /**
+     * Copy Constructor.
+     */
+    WorkQueue(const WorkQueue &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    WorkQueue &operator=(const WorkQueue &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~WorkQueue() override = default;
+
+    /**
+     * Queue the deferred work of an interrupt handler. Safe to be called from interrupt context.
+     * A handler, that is already queued, is not queued a second time.
+     */
+    void submit(InterruptHandler &handler);
+
+    /**
+     * Process all queued work in the calling context.
+     */
+    void drain();
+
+    [[nodiscard]] bool isWorkerRunning() const;
+
+    void run() override;
+
+    static const constexpr uint32_t CAPACITY = 64;
+
+private:
+
+    void acquireLock();
+
+    InterruptHandler *poll();
+
+    InterruptHandler *pending[CAPACITY]{};
+    uint32_t head = 0;
+    uint32_t count = 0;
+
+    Util::Async::Spinlock lock;
+    WaitQueue waitQueue;
+    bool workerRunning = false;
+};
+
+}
+
+#endif
@@ -23,6 +23,7 @@
 global setup_idt
 global reprogram_pics
 global interrupt_return
+global system_call_entry
 global on_exception
 
 ; Export variables
@@ -30,6 +31,7 @@ global idt_descriptor
 
 ; Import functions
 extern dispatch_interrupt
+extern dispatch_fast_system_call
 extern enable_interrupts
 extern disable_interrupts
 extern set_tss_stack_entry
@@ -152,6 +154,9 @@ wrapper_body:
     mov ds, ax
     mov es, ax
     mov fs, ax
+
+    ; Load per-cpu data segment
+    mov ax, 0x30
     mov gs, ax
 
     ; Restore eax
@@ -180,6 +185,87 @@ interrupt_return:
     add esp, 0x08
     iret
 
+; Entry point for system calls via SYSENTER (interrupts are disabled by the CPU)
+; The SYSENTER_ESP register is updated together with esp0 in the current CPU's TSS,
+; so the CPU has already switched to the kernel stack of the current thread (an NMI may arrive at any instruction)
+; ebp contains the user stack pointer, with the return address on top of it
+system_call_entry:
+    ; Build an interrupt frame, as if the system call had been issued via 'int 0x86'
+    ; SYSENTER only clears the interrupt flag (always set in user mode), so the user's flags are saved before anything modifies them
+    push 0x23
+    push ebp
+    pushfd
+    or dword [esp], 0x200
+    push 0x1b
+
+    ; The user stack pointer must lie in user space, before the return address is read from it
+    cmp ebp, KERNEL_START - 0x04
+    jae .invalid_user_stack
+    push dword [ebp]
+    jmp .save_state
+
+.invalid_user_stack:
+    ; Return to address 0 with an invalid stack, so that the calling thread faults in user mode
+    mov dword [esp + 0x08], 0x00
+    push 0x00
+
+.save_state:
+    push 0x00
+    push 0x86
+
+    ; Save state
+    pushad
+    push ds
+    push es
+    push fs
+    push gs
+    cld
+
+    mov bx, 0x10
+    mov ds, bx
+    mov es, bx
+    mov fs, bx
+
+    ; Load per-cpu data segment
+    mov bx, 0x30
+    mov gs, bx
+
+    ; Call system call handler (unless the user stack was invalid)
+    cmp dword [esp + 0x38], 0x00
+    je .return
+    push esp
+    call dispatch_fast_system_call
+    add  esp, 0x04
+
+.return:
+    ; Set TSS to current kernel stack
+    push esp
+    call set_tss_stack_entry
+    add  esp, 0x04
+
+    ; Load new state
+    pop gs
+    pop fs
+    pop es
+    pop ds
+    popad
+
+    ; Remove error code and interrupt number
+    add esp, 0x08
+
+    ; Load return address and user stack pointer (SYSEXIT returns to edx with esp = ecx)
+    mov edx, [esp]
+    mov ecx, [esp + 0x0c]
+
+    ; Restore the user's flags (SYSEXIT does not load them), but keep interrupts disabled until 'sti'
+    and dword [esp + 0x08], ~0x200
+    push dword [esp + 0x08]
+    popfd
+
+    ; The instruction after 'sti' is executed before interrupts are enabled
+    sti
+    sysexit
+
 section .data
 
 idt_descriptor:
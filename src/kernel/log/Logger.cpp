@@ -24,7 +24,7 @@
 #include "Logger.h"
 #include "kernel/log/Logger.h"
 #include "lib/util/base/Exception.h"
-#include "lib/util/async/Spinlock.h"
+#include "lib/util/async/TicketLock.h"
 #include "lib/util/collection/Array.h"
 #include "lib/util/collection/ArrayList.h"
 #include "lib/util/collection/HashMap.h"
@@ -36,7 +36,7 @@
 namespace Kernel {
 
 Logger::LogLevel Logger::currentLevel = LogLevel::TRACE;
-Util::Async::Spinlock Logger::lock;
+Util::Async::TicketLock Logger::lock("logger");
 Util::HashMap<Util::Io::OutputStream*, Util::Io::PrintStream*> Logger::streamMap;
 Util::ArrayList<Util::String> Logger::buffer;
 
@@ -22,7 +22,7 @@
 
 namespace Util {
 namespace Async {
-class Spinlock;
+class TicketLock;
 }  // namespace Async
 
 template <typename K, typename V> class HashMap;
@@ -96,7 +96,7 @@ private:
     const Util::String name;
 
     static LogLevel currentLevel;
-    static Util::Async::Spinlock lock;
+    static Util::Async::TicketLock lock; // Fair, since log messages are written while holding the lock
     static Util::HashMap<Util::Io::OutputStream*, Util::Io::PrintStream*> streamMap;
     static Util::ArrayList<Util::String> buffer;
 
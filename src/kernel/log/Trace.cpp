@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "Trace.h"
+
+#include "device/cpu/Cpu.h"
+#include "kernel/process/Thread.h"
+#include "kernel/system/PerCpu.h"
+#include "lib/util/async/Atomic.h"
+
+namespace Kernel {
+
+static_assert(sizeof(Trace::Record) == 32);
+
+Trace::Record *Trace::records = nullptr;
+uint32_t Trace::enabledEvents = 0;
+uint32_t Trace::writeIndex = 0;
+uint32_t Trace::readIndex = 0;
+uint32_t Trace::lostRecords = 0;
+Util::Async::Spinlock Trace::readLock;
+
+const char *Trace::eventNames[EVENT_COUNT] = {
+        "thread_switch",
+        "syscall_enter",
+        "syscall_exit",
+        "page_fault",
+        "interrupt_enter",
+        "interrupt_exit",
+        "packet_receive",
+        "packet_transmit"
+};
+
+void Trace::setEnabledEvents(uint32_t eventMask) {
+    readLock.acquire();
+    if (records == nullptr && eventMask != 0) {
+        records = new Record[CAPACITY]{};
+    }
+    readLock.release();
+
+    Util::Async::Atomic<uint32_t>(enabledEvents).set(eventMask & ((1 << EVENT_COUNT) - 1));
+}
+
+uint32_t Trace::getEnabledEvents() {
+    return enabledEvents;
+}
+
+uint32_t Trace::getLostRecords() {
+    return lostRecords;
+}
+
+const char* Trace::getEventName(Event event) {
+    return event < EVENT_COUNT ? eventNames[event] : "unknown";
+}
+
+void Trace::write(Event event, uint32_t argument0, uint32_t argument1) {
+    // Reserve a slot, so that tracepoints on other CPUs and in nested interrupts never write the same record
+    auto index = Util::Async::Atomic<uint32_t>(writeIndex).fetchAndInc();
+    auto &record = records[index % CAPACITY];
+    auto sequence = Util::Async::Atomic<uint32_t>(record.sequence);
+    sequence.set(0);
+
+    auto *thread = CpuLocal::currentThread.get();
+    record.event = event;
+    record.cpuId = CpuLocal::cpuId.get();
+    record.timestamp = Device::Cpu::readTimestampCounter();
+    record.threadId = thread == nullptr ? 0 : thread->getId();
+    record.arguments[0] = argument0;
+    record.arguments[1] = argument1;
+
+    sequence.set(index + 1);
+}
+
+uint32_t Trace::readRecords(Record *target, uint32_t count) {
+    readLock.acquire();
+    if (records == nullptr) {
+        return readLock.releaseAndReturn(0);
+    }
+
+    auto currentWriteIndex = Util::Async::Atomic<uint32_t>(writeIndex).get();
+    if (currentWriteIndex - readIndex > CAPACITY) {
+        // Records have been overwritten -> Continue with the oldest one, that is still available
+        lostRecords += currentWriteIndex - readIndex - CAPACITY;
+        readIndex = currentWriteIndex - CAPACITY;
+    }
+
+    uint32_t copied = 0;
+    while (readIndex != currentWriteIndex && copied < count) {
+        auto &record = records[readIndex % CAPACITY];
+        auto sequence = Util::Async::Atomic<uint32_t>(record.sequence);
+        auto expectedSequence = readIndex + 1;
+
+        auto sequenceBefore = sequence.get();
+        if (sequenceBefore != expectedSequence) {
+            if (static_cast<int32_t>(sequenceBefore - expectedSequence) < 0) {
+                // The record is still being written
+                break;
+            }
+
+            // The record has already been overwritten
+            lostRecords++;
+            readIndex++;
+            continue;
+        }
+
+        target[copied] = record;
+        if (sequence.get() == sequenceBefore) {
+            copied++;
+        } else {
+            lostRecords++;
+        }
+
+        readIndex++;
+    }
+
+    return readLock.releaseAndReturn(copied);
+}
+
+}
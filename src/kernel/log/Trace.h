@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_TRACE_H
+#define HHUOS_TRACE_H
+
+#include <cstdint>
+
+#include "lib/util/async/Spinlock.h"
+
+namespace Kernel {
+
+/**
+ * Static tracepoints, that write fixed-size records with a time stamp counter value into a lock-free ring buffer.
+ * The ring is drained by reading /device/trace. Once it is full, the oldest records are overwritten.
+ * Each event is enabled separately. A disabled tracepoint costs a single, well predicted branch.
+ */
+class Trace {
+
+public:
+
+    enum Event : uint16_t {
+        THREAD_SWITCH = 0,     // Previous thread id, next thread id
+        SYSTEM_CALL_ENTER = 1, // System call code
+        SYSTEM_CALL_EXIT = 2,  // System call code, result
+        PAGE_FAULT = 3,        // Fault address, error code
+        INTERRUPT_ENTER = 4,   // Interrupt vector
+        INTERRUPT_EXIT = 5,    // Interrupt vector
+        PACKET_RECEIVE = 6,    // Packet length
+        PACKET_TRANSMIT = 7,   // Packet length
+        EVENT_COUNT = 8
+    };
+
+    struct Record {
+        uint32_t sequence; // Index of the record in the ring + 1, once the record is complete
+        Event event;
+        uint8_t cpuId;
+        uint8_t reserved;
+        uint64_t timestamp;
+        uint32_t threadId;
+        uint32_t arguments[2];
+        uint32_t padding;
+    };
+
+    /**
+     * Default Constructor.
+     * Deleted, as this class has only static members.
+     */
+    Trace() = delete;
+
+    /**
+     * Copy Constructor.
+     */
+    Trace(const Trace &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    Trace &operator=(const Trace &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~Trace() = delete;
+
+    static inline void tracepoint(Event event, uint32_t argument0 = 0, uint32_t argument1 = 0) {
+        if (__builtin_expect((enabledEvents & (1 << event)) != 0, 0)) {
+            write(event, argument0, argument1);
+        }
+    }
+
+    /**
+     * Set the events to be recorded (one bit per event). Must not be called from interrupt context,
+     * since the ring buffer is allocated on first use.
+     */
+    static void setEnabledEvents(uint32_t eventMask);
+
+    [[nodiscard]] static uint32_t getEnabledEvents();
+
+    /**
+     * Remove the oldest records from the ring.
+     *
+     * @return The number of records, copied into the target buffer
+     */
+    static uint32_t readRecords(Record *target, uint32_t count);
+
+    /**
+     * Get the amount of records, that have been overwritten before they were read.
+     */
+    [[nodiscard]] static uint32_t getLostRecords();
+
+    [[nodiscard]] static const char* getEventName(Event event);
+
+    static const constexpr uint32_t CAPACITY = 8192;
+
+private:
+
+    static void write(Event event, uint32_t argument0, uint32_t argument1);
+
+    static Record *records;
+    static uint32_t enabledEvents;
+    static uint32_t writeIndex;
+    static uint32_t readIndex;
+    static uint32_t lostRecords;
+    static Util::Async::Spinlock readLock;
+
+    static const char *eventNames[EVENT_COUNT];
+};
+
+}
+
+#endif
@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "TraceNode.h"
+
+#include "kernel/log/Trace.h"
+
+namespace Kernel {
+
+TraceNode::TraceNode(const Util::String &name) : MemoryNode(name) {}
+
+Util::Io::File::Type TraceNode::getType() {
+    return Util::Io::File::CHARACTER;
+}
+
+uint64_t TraceNode::readData(uint8_t *targetBuffer, uint64_t pos, uint64_t numBytes) {
+    auto count = Trace::readRecords(reinterpret_cast<Trace::Record*>(targetBuffer), numBytes / sizeof(Trace::Record));
+    return count * sizeof(Trace::Record);
+}
+
+uint64_t TraceNode::writeData(const uint8_t *sourceBuffer, uint64_t pos, uint64_t numBytes) {
+    uint32_t eventMask = 0;
+    // Accept both commas and whitespace as separators
+    auto *buffer = new char[numBytes + 1];
+    for (uint32_t i = 0; i < numBytes; i++) {
+        buffer[i] = (sourceBuffer[i] == ',' || sourceBuffer[i] == '\n' || sourceBuffer[i] == '\t') ? ' ' : static_cast<char>(sourceBuffer[i]);
+    }
+    buffer[numBytes] = 0;
+
+    auto events = Util::String(buffer).split(" ");
+    delete[] buffer;
+
+    for (const auto &event : events) {
+        if (event == "all") {
+            eventMask = (1 << Trace::EVENT_COUNT) - 1;
+        } else if (event == "none") {
+            eventMask = 0;
+        } else {
+            for (uint32_t i = 0; i < Trace::EVENT_COUNT; i++) {
+                if (event == Trace::getEventName(static_cast<Trace::Event>(i))) {
+                    eventMask |= 1 << i;
+                }
+            }
+        }
+    }
+
+    Trace::setEnabledEvents(eventMask);
+    return numBytes;
+}
+
+}
@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_TRACENODE_H
+#define HHUOS_TRACENODE_H
+
+#include <cstdint>
+
+#include "filesystem/memory/MemoryNode.h"
+#include "lib/util/base/String.h"
+#include "lib/util/io/file/File.h"
+
+namespace Kernel {
+
+/**
+ * Interface to the kernel tracepoints.
+ * Writing "all", "none" or a list of event names, separated by commas or spaces, selects the events to be recorded.
+ * Reading removes recorded events and returns them as an array of Trace::Record structures.
+ */
+class TraceNode : public Filesystem::Memory::MemoryNode {
+
+public:
+    /**
+     * Constructor.
+     */
+    explicit TraceNode(const Util::String &name = "trace");
+
+    /**
+     * Copy Constructor.
+     */
+    TraceNode(const TraceNode &copy) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    TraceNode &operator=(const TraceNode &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~TraceNode() override = default;
+
+    /**
+     * Overriding function from Node.
+     */
+    Util::Io::File::Type getType() override;
+
+    /**
+     * Overriding function from Node.
+     */
+    uint64_t readData(uint8_t *targetBuffer, uint64_t pos, uint64_t numBytes) override;
+
+    /**
+     * Overriding function from Node.
+     */
+    uint64_t writeData(const uint8_t *sourceBuffer, uint64_t pos, uint64_t numBytes) override;
+};
+
+}
+
+#endif
@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "BlockCache.h"
+
+#include "kernel/service/MemoryService.h"
+#include "kernel/system/System.h"
+
+namespace Kernel {
+
+BlockCache::BlockCache(uint32_t blockSize, uint32_t alignment, uint32_t capacity) : pool(capacity), blockSize(blockSize), alignment(alignment) {}
+
+BlockCache::~BlockCache() {
+    auto &memoryService = System::getService<MemoryService>();
+    auto *block = pool.tryPop();
+    while (block != nullptr) {
+        memoryService.freeKernelMemory(block, alignment);
+        block = pool.tryPop();
+    }
+}
+
+void* BlockCache::allocate() {
+    auto *block = pool.tryPop();
+    if (block != nullptr) {
+        return block;
+    }
+
+    return System::getService<MemoryService>().allocateKernelMemory(blockSize, alignment);
+}
+
+void BlockCache::free(void *block) {
+    if (!pool.push(block)) {
+        System::getService<MemoryService>().freeKernelMemory(block, alignment);
+    }
+}
+
+uint32_t BlockCache::getBlockSize() const {
+    return blockSize;
+}
+
+}
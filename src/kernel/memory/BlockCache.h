@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_BLOCKCACHE_H
+#define HHUOS_BLOCKCACHE_H
+
+#include <cstdint>
+
+#include "lib/util/collection/Pool.h"
+
+namespace Kernel {
+
+/**
+ * Keeps freed kernel memory blocks of a fixed size, so that they can be recycled without going through the kernel heap.
+ * This is used for resources, that are allocated and freed for every thread (e.g. kernel stacks and FPU contexts).
+ * Blocks, that do not fit into the cache anymore, are returned to the kernel heap.
+ */
+class BlockCache {
+
+public:
+    /**
+     * Constructor.
+     */
+    BlockCache(uint32_t blockSize, uint32_t alignment, uint32_t capacity);
+
+    /**
+     * Copy Constructor.
+     */
+    BlockCache(const BlockCache &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    BlockCache &operator=(const BlockCache &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~BlockCache();
+
+    [[nodiscard]] void* allocate();
+
+    void free(void *block);
+
+    [[nodiscard]] uint32_t getBlockSize() const;
+
+private:
+
+    Util::Pool<void> pool;
+    uint32_t blockSize;
+    uint32_t alignment;
+};
+
+}
+
+#endif
@@ -20,7 +20,6 @@
 
 #include "DatagramSocket.h"
 
-#include "lib/util/async/Thread.h"
 #include "lib/util/network/NetworkAddress.h"
 #include "lib/util/network/Datagram.h"
 #include "kernel/network/Socket.h"
@@ -38,18 +37,22 @@ DatagramSocket::DatagramSocket(NetworkModule &networkModule, Util::Network::Sock
 
 Util::Network::Datagram *DatagramSocket::receive() {
     uint32_t startTime = Util::Time::getSystemTime().toMilliseconds();
-    while (incomingDatagramQueue.isEmpty()) {
-        Util::Async::Thread::yield();
 
+    lock.acquire();
+    while (incomingDatagramQueue.isEmpty()) {
         if (timeout > 0) {
-            auto currentTime = Util::Time::getSystemTime().toMilliseconds();
-            if (currentTime - startTime >= timeout) {
+            auto elapsedTime = Util::Time::getSystemTime().toMilliseconds() - startTime;
+            if (elapsedTime >= timeout) {
+                lock.release();
                 return nullptr;
             }
+
+            receiveQueue.wait(lock, Util::Time::Timestamp::ofMilliseconds(timeout - elapsedTime));
+        } else {
+            receiveQueue.wait(lock);
         }
     }
 
-    lock.acquire();
     auto *datagram = incomingDatagramQueue.poll();
     lock.release();
 
@@ -59,6 +62,7 @@ Util::Network::Datagram *DatagramSocket::receive() {
 void DatagramSocket::handleIncomingDatagram(Util::Network::Datagram *datagram) {
     lock.acquire();
     incomingDatagramQueue.offer(datagram);
+    receiveQueue.notifyAll();
     lock.release();
 }
 
@@ -24,6 +24,7 @@
 #include <cstdint>
 
 #include "Socket.h"
+#include "kernel/process/WaitQueue.h"
 #include "lib/util/async/Spinlock.h"
 #include "lib/util/collection/ArrayListBlockingQueue.h"
 #include "lib/util/collection/Array.h"
@@ -122,6 +123,7 @@ private:
 
     Util::Async::Spinlock lock;
     Util::ArrayListBlockingQueue<Util::Network::Datagram*> incomingDatagramQueue;
+    WaitQueue receiveQueue;
 };
 
 }
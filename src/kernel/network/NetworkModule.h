@@ -89,7 +89,7 @@ protected:
 
     void invokeNextLayerModule(uint32_t protocolId, LayerInformation information, Util::Io::ByteArrayInputStream &stream, Device::Network::NetworkDevice &device);
 
-    Util::Async::Spinlock socketLock;
+    Util::Async::Spinlock socketLock = Util::Async::Spinlock("network-sockets");
     Util::ArrayList<Socket*> socketList;
 
 private:
@@ -23,7 +23,6 @@
 #include "lib/util/async/Thread.h"
 #include "device/network/NetworkDevice.h"
 #include "kernel/log/Logger.h"
-#include "lib/util/base/Exception.h"
 #include "lib/util/io/stream/ByteArrayInputStream.h"
 #include "lib/util/io/stream/ByteArrayOutputStream.h"
 #include "lib/util/time/Timestamp.h"
@@ -84,12 +83,9 @@ void ArpModule::readPacket(Util::Io::ByteArrayInputStream &stream, LayerInformat
 
 bool ArpModule::resolveAddress(const Util::Network::Ip4::Ip4Address &protocolAddress, Util::Network::MacAddress &hardwareAddress, const Ip4::Ip4Interface &interface) {
     for (uint32_t i = 0; i < MAX_REQUEST_RETRIES; i++) {
-        lock.acquire();
-        if (hasHardwareAddress(protocolAddress)) {
-            hardwareAddress = getHardwareAddress(protocolAddress);
-            return lock.releaseAndReturn(true);
+        if (lookupHardwareAddress(protocolAddress, hardwareAddress)) {
+            return true;
         }
-        lock.release();
 
         auto &device = interface.getDevice();
         auto ipAddress = interface.getIp4Address();
@@ -111,20 +107,21 @@ bool ArpModule::resolveAddress(const Util::Network::Ip4::Ip4Address &protocolAdd
 }
 
 void ArpModule::setEntry(const Util::Network::Ip4::Ip4Address &protocolAddress, const Util::Network::MacAddress &hardwareAddress) {
-    lock.acquire();
+    lock.acquireWrite();
     for (auto &entry : arpCache) {
         if (entry.getProtocolAddress() == protocolAddress) {
             entry.setHardwareAddress(hardwareAddress);
-            lock.release();
+            lock.releaseWrite();
             return;
         }
     }
 
     arpCache.add(ArpEntry{protocolAddress, hardwareAddress});
-    lock.release();
+    lock.releaseWrite();
 }
 
 void ArpModule::removeEntry(const Util::Network::Ip4::Ip4Address &protocolAddress) {
+    lock.acquireWrite();
     for (auto &entry : arpCache) {
         if (entry.getProtocolAddress() == protocolAddress) {
             arpCache.remove(entry);
@@ -132,43 +129,28 @@ void ArpModule::removeEntry(const Util::Network::Ip4::Ip4Address &protocolAddres
         }
     }
 
-    lock.release();
+    lock.releaseWrite();
 }
 
-Util::Network::MacAddress ArpModule::getHardwareAddress(const Util::Network::Ip4::Ip4Address &protocolAddress) {
-    lock.acquire();
+bool ArpModule::lookupHardwareAddress(const Util::Network::Ip4::Ip4Address &protocolAddress, Util::Network::MacAddress &hardwareAddress) {
+    lock.acquireRead();
 
     for (const auto &entry : arpCache) {
         if (entry.getProtocolAddress() == protocolAddress) {
-            return lock.releaseAndReturn(entry.getHardwareAddress());
+            hardwareAddress = entry.getHardwareAddress();
+            return lock.releaseReadAndReturn(true);
         }
     }
 
-    lock.release();
-    Util::Exception::throwException(Util::Exception::INVALID_ARGUMENT, "ArpModule: Protocol address not found!");
-}
-
-bool ArpModule::hasHardwareAddress(const Util::Network::Ip4::Ip4Address &protocolAddress) {
-    lock.acquire();
-
-    for (const auto &entry : arpCache) {
-        if (entry.getProtocolAddress() == protocolAddress) {
-            return lock.releaseAndReturn(true);
-        }
-    }
-
-    return lock.releaseAndReturn(false);
+    return lock.releaseReadAndReturn(false);
 }
 
 void ArpModule::handleRequest(const Util::Network::MacAddress &sourceHardwareAddress, const Util::Network::Ip4::Ip4Address &sourceAddress,
                               const Util::Network::Ip4::Ip4Address &targetProtocolAddress, Device::Network::NetworkDevice &device) {
     setEntry(sourceAddress, sourceHardwareAddress);
 
-    lock.acquire();
-    if (hasHardwareAddress(targetProtocolAddress)) {
-        auto targetHardwareAddress = getHardwareAddress(targetProtocolAddress);
-        lock.release();
-
+    auto targetHardwareAddress = Util::Network::MacAddress();
+    if (lookupHardwareAddress(targetProtocolAddress, targetHardwareAddress)) {
         auto packet = Util::Io::ByteArrayOutputStream();
         writeHeader(packet, ArpHeader::REPLY, device, targetHardwareAddress);
 
@@ -179,8 +161,6 @@ void ArpModule::handleRequest(const Util::Network::MacAddress &sourceHardwareAdd
 
         Ethernet::EthernetModule::finalizePacket(packet);
         device.sendPacket(packet.getBuffer(), packet.getLength());
-    } else {
-        lock.release();
     }
 }
 
@@ -23,7 +23,7 @@
 
 #include <cstdint>
 
-#include "lib/util/async/ReentrantSpinlock.h"
+#include "lib/util/async/ReadWriteLock.h"
 #include "kernel/network/NetworkModule.h"
 #include "ArpHeader.h"
 #include "ArpEntry.h"
@@ -94,15 +94,13 @@ public:
 
 private:
 
-    Util::Network::MacAddress getHardwareAddress(const Util::Network::Ip4::Ip4Address &protocolAddress);
-
-    bool hasHardwareAddress(const Util::Network::Ip4::Ip4Address &protocolAddress);
+    bool lookupHardwareAddress(const Util::Network::Ip4::Ip4Address &protocolAddress, Util::Network::MacAddress &hardwareAddress);
 
     void handleRequest(const Util::Network::MacAddress &sourceHardwareAddress, const Util::Network::Ip4::Ip4Address &sourceAddress, const Util::Network::Ip4::Ip4Address &targetProtocolAddress, Device::Network::NetworkDevice &device);
 
     void handleReply(const Util::Network::MacAddress &sourceHardwareAddress, const Util::Network::Ip4::Ip4Address &sourceAddress, const Util::Network::MacAddress &targetHardwareAddress, const Util::Network::Ip4::Ip4Address &targetProtocolAddress);
 
-    Util::Async::ReentrantSpinlock lock;
+    Util::Async::ReadWriteLock lock;
     Util::ArrayList<ArpEntry> arpCache;
 
     static Kernel::Logger log;
@@ -127,13 +127,13 @@ Ip4Interface Ip4Module::writeHeader(Util::Io::ByteArrayOutputStream &stream, con
 Util::Array<Ip4Interface> Ip4Module::getInterfaces(const Util::String &deviceIdentifier) {
     auto ret = Util::ArrayList<Ip4Interface>();
 
-    lock.acquire();
+    interfaceLock.acquireRead();
     for (auto interface : interfaces) {
         if (interface.getDeviceIdentifier() == deviceIdentifier) {
             ret.add(interface);
         }
     }
-    lock.release();
+    interfaceLock.releaseRead();
 
     return ret.toArray();
 }
@@ -141,27 +141,27 @@ Util::Array<Ip4Interface> Ip4Module::getInterfaces(const Util::String &deviceIde
 Util::Array<Ip4Interface> Ip4Module::getTargetInterfaces(const Util::Network::Ip4::Ip4Address &address) {
     auto ret = Util::ArrayList<Ip4Interface>();
 
-    lock.acquire();
+    interfaceLock.acquireRead();
     for (const auto &interface : interfaces) {
         if (interface.isTargetOf(address)) {
             ret.add(interface);
         }
     }
-    lock.release();
+    interfaceLock.releaseRead();
 
     return ret.toArray();
 }
 
 bool Ip4Module::registerInterface(const Util::Network::Ip4::Ip4SubnetAddress &address, Device::Network::NetworkDevice &device) {
-    lock.acquire();
+    interfaceLock.acquireWrite();
     auto interface = Ip4Interface(address, device);
     if (interfaces.contains(interface) || interface.getIp4Address() == Util::Network::Ip4::Ip4Address::ANY) {
-        lock.release();
+        interfaceLock.releaseWrite();
         return false;
     }
 
     auto ret = interfaces.add(interface);
-    lock.release();
+    interfaceLock.releaseWrite();
 
     if (ret) {
         auto &arpModule = Kernel::System::getService<Kernel::NetworkService>().getNetworkStack().getArpModule();
@@ -172,7 +172,7 @@ bool Ip4Module::registerInterface(const Util::Network::Ip4::Ip4SubnetAddress &ad
 }
 
 bool Ip4Module::removeInterface(const Util::Network::Ip4::Ip4SubnetAddress &address, const Util::String &deviceIdentifier) {
-    lock.acquire();
+    interfaceLock.acquireWrite();
     for (const auto &interface : interfaces) {
         if (interface.getSubnetAddress() == address && interface.getDeviceIdentifier() == deviceIdentifier) {
             auto &arpModule = Kernel::System::getService<Kernel::NetworkService>().getNetworkStack().getArpModule();
@@ -181,12 +181,12 @@ bool Ip4Module::removeInterface(const Util::Network::Ip4::Ip4SubnetAddress &addr
             routingModule.removeRoute(address, deviceIdentifier);
             interfaces.remove(interface);
 
-            lock.release();
+            interfaceLock.releaseWrite();
             return true;
         }
     }
 
-    lock.release();
+    interfaceLock.releaseWrite();
     return false;
 }
 
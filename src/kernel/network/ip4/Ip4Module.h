@@ -30,7 +30,7 @@
 #include "lib/util/collection/ArrayList.h"
 #include "lib/util/base/String.h"
 #include "kernel/network/ip4/Ip4Interface.h"
-#include "lib/util/async/ReentrantSpinlock.h"
+#include "lib/util/async/ReadWriteLock.h"
 
 namespace Device {
 namespace Network {
@@ -99,7 +99,7 @@ private:
 
     Ip4RoutingModule routingModule;
     Util::ArrayList<Ip4Interface> interfaces;
-    Util::Async::ReentrantSpinlock lock;
+    Util::Async::ReadWriteLock interfaceLock; // Interfaces are looked up for every received packet, but rarely changed
 
     static Kernel::Logger log;
 };
@@ -143,7 +143,7 @@ PageDirectory::~PageDirectory() {
     memoryService.freePageTable((void *) pageDirectory);
 }
 
-void PageDirectory::map(uint32_t physicalAddress, uint32_t virtualAddress, uint16_t flags, bool interrupt) {
+bool PageDirectory::map(uint32_t physicalAddress, uint32_t virtualAddress, uint16_t flags, bool interrupt) {
     auto &memoryService = System::getService<Kernel::MemoryService>();
 
     // Calculate indices into page table and directory
@@ -160,7 +160,7 @@ void PageDirectory::map(uint32_t physicalAddress, uint32_t virtualAddress, uint1
             // Abort if the fault handler does not get the lock.
             // The fault will occur again, until we get the lock.
             if (interrupt) {
-                return;
+                return false;
             }
         }
     }
@@ -171,7 +171,13 @@ void PageDirectory::map(uint32_t physicalAddress, uint32_t virtualAddress, uint1
     }
 
     // Check if the requested page is already mapped
+    // The fault handler may race with another CPU, that has mapped the page in the meantime -> The fault handler just retries the access
     if ((*((uint32_t *) virtualTableAddresses[pageDirectoryIndex] + pageTableIndex) & Paging::PRESENT) != 0) {
+        if (interrupt) {
+            lock.set(lockFree);
+            return false;
+        }
+
         Util::Exception::throwException(Util::Exception::PAGING_ERROR, "PageDirectory: Requested page is already mapped!");
     }
 
@@ -179,6 +185,7 @@ void PageDirectory::map(uint32_t physicalAddress, uint32_t virtualAddress, uint1
     *((uint32_t *) virtualTableAddresses[pageDirectoryIndex] + pageTableIndex) = physicalAddress | flags;
 
     lock.set(lockFree);
+    return true;
 }
 
 uint32_t PageDirectory::unmap(uint32_t virtualAddress) {
@@ -259,6 +266,29 @@ void *PageDirectory::getPhysicalAddress(void *virtualAddress) {
     return reinterpret_cast<void*>(physAddress);
 }
 
+uint16_t PageDirectory::getPageFlags(uint32_t virtualAddress) {
+    // Get indices into page table and directory
+    uint32_t pageDirectoryIndex = Paging::GET_PD_IDX(virtualAddress);
+    uint32_t pageTableIndex = Paging::GET_PT_IDX(virtualAddress);
+
+    // Get lock for current CPU
+    auto lock = lockArray.access(pageDirectoryIndex);
+    while (!lock.compareAndSet(lockFree, System::getService<InterruptService>().getCpuId())) {
+        Util::Async::Thread::yield();
+    }
+
+    // Pages of a table, that is not present, have no flags
+    if ((pageDirectory[pageDirectoryIndex] & Paging::PRESENT) == 0) {
+        lock.set(lockFree);
+        return 0;
+    }
+
+    auto flags = static_cast<uint16_t>(*((uint32_t *) virtualTableAddresses[pageDirectoryIndex] + pageTableIndex) & 0x00000FFF);
+
+    lock.set(lockFree);
+    return flags;
+}
+
 void PageDirectory::setPageFlags(uint32_t virtualStartAddress, uint32_t flags) {
     // Align address to 4 KiB
     uint32_t alignedAddress = virtualStartAddress & 0xFFFFF000;
@@ -68,8 +68,11 @@ public:
      * @param physicalAddress Physical address to be mapped
      * @param virtualAddress Virtual address to be mapped
      * @param flags Flags for entry in Page Table
+     * @param interrupt If true, the page is not mapped if the page table is locked by another CPU or the page is already mapped,
+     *                  instead of waiting for the lock or throwing an exception (used by the page fault handler)
+     * @return true, if the page has been mapped
      */
-    void map(uint32_t physicalAddress, uint32_t virtualAddress, uint16_t flags, bool interrupt = false);
+    bool map(uint32_t physicalAddress, uint32_t virtualAddress, uint16_t flags, bool interrupt = false);
 
     /**
      * Unmap a given virtual address from this directory.
@@ -87,6 +90,14 @@ public:
      */
     void *getPhysicalAddress(void *virtualAddress);
 
+    /**
+     * Get the flags of the page table entry, that maps the given virtual address.
+     *
+     * @param virtualAddress Virtual address
+     * @return Flags of the page table entry (0, if the page is not mapped)
+     */
+    uint16_t getPageFlags(uint32_t virtualAddress);
+
     /**
      * Create a new Page Table in this Page Directory
      *
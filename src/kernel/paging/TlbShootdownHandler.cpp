@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "TlbShootdownHandler.h"
+
+#include "device/cpu/Cpu.h"
+#include "device/interrupt/apic/LocalApic.h"
+#include "kernel/interrupt/InterruptVector.h"
+#include "kernel/paging/MemoryLayout.h"
+#include "kernel/paging/Paging.h"
+#include "kernel/service/InterruptService.h"
+#include "kernel/service/MemoryService.h"
+#include "kernel/system/System.h"
+
+namespace Kernel {
+
+void TlbShootdownHandler::plugin() {
+    System::getService<InterruptService>().assignInterrupt(InterruptVector::NON_MASKABLE_INTERRUPT, *this);
+}
+
+void TlbShootdownHandler::trigger(const InterruptFrame &frame) {
+    auto cpuId = System::getService<InterruptService>().getCpuId();
+    if (!pending[cpuId]) {
+        // Not sent by us (e.g. a watchdog or a parity error reported by the chipset) -> Nothing to invalidate
+        return;
+    }
+
+    invalidateLocal(startAddress, endAddress);
+    pending[cpuId] = false;
+}
+
+void TlbShootdownHandler::addCurrentProcessor() {
+    online[System::getService<InterruptService>().getCpuId()] = true;
+}
+
+void TlbShootdownHandler::invalidate(uint32_t virtualStartAddress, uint32_t virtualEndAddress, const VirtualAddressSpace &addressSpace) {
+    // Do not use Device::Cpu::disableInterrupts(), since this may be called with interrupts already disabled by other means
+    auto flags = Device::Cpu::saveAndDisableInterrupts();
+
+    invalidateLocal(virtualStartAddress, virtualEndAddress);
+
+    auto &interruptService = System::getService<InterruptService>();
+    if (!interruptService.usesApic()) {
+        Device::Cpu::restoreInterrupts(flags);
+        return;
+    }
+
+    // Spin without yielding, since interrupts are disabled
+    while (!lock.tryAcquire()) {
+        asm volatile ("pause");
+    }
+
+    startAddress = virtualStartAddress;
+    endAddress = virtualEndAddress;
+
+    auto &memoryService = System::getService<MemoryService>();
+    auto cpuId = interruptService.getCpuId();
+    auto kernelPages = virtualEndAddress >= MemoryLayout::KERNEL_START;
+
+    for (uint32_t i = 0; i < sizeof(online) / sizeof(bool); i++) {
+        // A CPU switching to the address space concurrently reloads CR3 anyway
+        if (i == cpuId || !online[i] || (!kernelPages && &memoryService.getCurrentAddressSpace(i) != &addressSpace)) {
+            continue;
+        }
+
+        pending[i] = true;
+        Device::LocalApic::sendNonMaskableInterProcessorInterrupt(i);
+    }
+
+    for (uint32_t i = 0; i < sizeof(pending) / sizeof(bool); i++) {
+        while (pending[i]) {
+            asm volatile ("pause");
+        }
+    }
+
+    lock.release();
+    Device::Cpu::restoreInterrupts(flags);
+}
+
+void TlbShootdownHandler::invalidateLocal(uint32_t virtualStartAddress, uint32_t virtualEndAddress) {
+    if ((virtualEndAddress - virtualStartAddress) / Paging::PAGESIZE >= FULL_FLUSH_THRESHOLD) {
+        asm volatile (
+                "mov %%cr3, %%eax;"
+                "mov %%eax, %%cr3;"
+                : : :
+                "eax", "memory"
+                );
+
+        return;
+    }
+
+    for (uint32_t address = virtualStartAddress; address <= virtualEndAddress; address += Paging::PAGESIZE) {
+        asm volatile ("invlpg (%0)" : : "r"(address) : "memory");
+
+        if (address + Paging::PAGESIZE < address) {
+            break; // Overflow at the end of the address space
+        }
+    }
+}
+
+}
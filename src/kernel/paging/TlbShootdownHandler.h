@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_TLBSHOOTDOWNHANDLER_H
+#define HHUOS_TLBSHOOTDOWNHANDLER_H
+
+#include <cstdint>
+
+#include "kernel/interrupt/InterruptHandler.h"
+#include "lib/util/async/Spinlock.h"
+
+namespace Kernel {
+class VirtualAddressSpace;
+struct InterruptFrame;
+
+/**
+ * Keeps the TLBs of all running CPUs consistent, when pages are unmapped.
+ * Remote CPUs are notified via NMI, because they may be spinning on a lock with interrupts disabled,
+ * while the initiating CPU waits for their acknowledgement.
+ */
+class TlbShootdownHandler : public InterruptHandler {
+
+public:
+    /**
+     * Default Constructor.
+     */
+    TlbShootdownHandler() = default;
+
+    /**
+     * Copy Constructor.
+     */
+    TlbShootdownHandler(const TlbShootdownHandler &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    TlbShootdownHandler &operator=(const TlbShootdownHandler &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~TlbShootdownHandler() override = default;
+
+    void plugin() override;
+
+    void trigger(const InterruptFrame &frame) override;
+
+    /**
+     * Include the calling CPU in future shootdowns. Must be called by every application processor,
+     * before it accesses memory, that may be unmapped by other CPUs.
+     */
+    void addCurrentProcessor();
+
+    /**
+     * Invalidate a range of pages on all CPUs, that may have cached them.
+     * Pages in kernel space are invalidated everywhere, user pages only on CPUs running in the given address space.
+     *
+     * @param virtualStartAddress Address of the first page
+     * @param virtualEndAddress Address of the last page
+     * @param addressSpace The address space, the pages have been unmapped from
+     */
+    void invalidate(uint32_t virtualStartAddress, uint32_t virtualEndAddress, const VirtualAddressSpace &addressSpace);
+
+    /**
+     * Invalidate a range of pages in the TLB of the calling CPU.
+     */
+    static void invalidateLocal(uint32_t virtualStartAddress, uint32_t virtualEndAddress);
+
+private:
+
+    Util::Async::Spinlock lock = Util::Async::Spinlock("tlb-shootdown");
+    volatile bool online[256]{};
+    volatile bool pending[256]{};
+    volatile uint32_t startAddress = 0;
+    volatile uint32_t endAddress = 0;
+
+    /**
+     * Above this number of pages, it is cheaper to flush the whole TLB by reloading CR3.
+     */
+    static const constexpr uint32_t FULL_FLUSH_THRESHOLD = 32;
+};
+
+}
+
+#endif
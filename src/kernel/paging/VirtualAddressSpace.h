@@ -44,7 +44,7 @@ public:
 
     /**
      * Constructor for user address space.
-     * The heap always starts at 0x2000.
+     * Programs start at 0x3000, after the memory manager (0x1000) and the time page (0x2000).
      */
     explicit VirtualAddressSpace(PageDirectory &basePageDirectory);
 
@@ -20,11 +20,14 @@
 #include <cstdint>
 
 #include "lib/util/io/file/File.h"
-#include "lib/util/io/stream/FileInputStream.h"
 #include "lib/util/io/file/elf/File.h"
 #include "kernel/system/System.h"
 #include "kernel/paging/Paging.h"
 #include "kernel/service/ProcessService.h"
+#include "kernel/service/FilesystemService.h"
+#include "kernel/process/FileBackedRegion.h"
+#include "filesystem/core/Filesystem.h"
+#include "filesystem/core/Node.h"
 #include "kernel/process/Process.h"
 #include "kernel/process/Thread.h"
 #include "kernel/service/SchedulerService.h"
@@ -46,16 +49,49 @@ void BinaryLoader::run() {
         Util::Exception::throwException(Util::Exception::INVALID_ARGUMENT, "BinaryLoader: Not a file!");
     }
 
-    auto *buffer = new uint8_t[file.getLength()];
-    auto binaryStream = Util::Io::FileInputStream(file);
-    binaryStream.read(buffer, 0, file.getLength());
+    auto *node = System::getService<FilesystemService>().getFilesystem().getNode(path);
+    if (node == nullptr) {
+        Util::Exception::throwException(Util::Exception::INVALID_ARGUMENT, "BinaryLoader: File not found!");
+    }
+
+    auto &process = System::getService<ProcessService>().getCurrentProcess();
+    process.setExecutable(node);
+
+    // Only read the headers, the segments are loaded by the page fault handler, once they are accessed
+    Util::Io::Elf::FileHeader fileHeader{};
+    node->readData(reinterpret_cast<uint8_t*>(&fileHeader), 0, sizeof(Util::Io::Elf::FileHeader));
+    if (!fileHeader.isValid() || fileHeader.programHeaderEntrySize != sizeof(Util::Io::Elf::ProgramHeader)) {
+        Util::Exception::throwException(Util::Exception::INVALID_ARGUMENT, "Elf: Invalid file!");
+    }
+
+    auto *programHeaders = new Util::Io::Elf::ProgramHeader[fileHeader.programHeaderEntries];
+    node->readData(reinterpret_cast<uint8_t*>(programHeaders), fileHeader.programHeader, fileHeader.programHeaderEntries * sizeof(Util::Io::Elf::ProgramHeader));
 
-    // buffer is automatically deleted by file destructor
-    auto executable = Util::Io::Elf::File(buffer);
-    executable.loadProgram();
+    uint32_t endAddress = 0;
+    for (uint32_t i = 0; i < fileHeader.programHeaderEntries; i++) {
+        const auto &header = programHeaders[i];
+        if (header.type == Util::Io::Elf::ProgramHeaderType::LOAD) {
+            auto writable = (header.flags & Util::Io::Elf::ProgramHeaderFlag::WRITE) != 0;
+            auto *region = new FileBackedRegion(*node, header.offset, header.fileSize, header.virtualAddress, header.memorySize, writable);
+            process.addFileBackedRegion(region);
+
+            if (region->getEndAddress() > endAddress) {
+                endAddress = region->getEndAddress();
+            }
+        }
+    }
+
+    delete[] programHeaders;
+
+    // Pages are only shared, if the filesystem can tell, whether the file has changed since they have been loaded
+    auto contentStamp = node->getContentStamp();
+    if (contentStamp != 0) {
+        auto &sharedImage = System::getService<ProcessService>().getImageCache().acquireImage(path, contentStamp, node->getLength(), fileHeader.entry);
+        process.setSharedImage(sharedImage);
+    }
 
     uint32_t argc = arguments.length() + 1;
-    char **argv = reinterpret_cast<char**>(executable.getEndAddress() + 1);
+    char **argv = reinterpret_cast<char**>(endAddress + 1);
     auto currentAddress = reinterpret_cast<uint32_t>(argv) + sizeof(char**) * argc;
 
     for (uint32_t i = 0; i < argc; i++) {
@@ -67,13 +103,11 @@ void BinaryLoader::run() {
         currentAddress += targetArgument.stringLength() + 1;
     }
 
-    auto &processService = System::getService<ProcessService>();
     auto &schedulerService = System::getService<SchedulerService>();
-    auto &process = processService.getCurrentProcess();
     auto heapAddress = Util::Address(currentAddress + 1).alignUp(Kernel::Paging::PAGESIZE).get();
-    auto &userThread = Thread::createMainUserThread(file.getName(), process, (uint32_t) executable.getEntryPoint(), argc, argv, nullptr, heapAddress);
+    auto &userThread = Thread::createMainUserThread(file.getName(), process, fileHeader.entry, argc, argv, nullptr, heapAddress);
 
-    processService.getCurrentProcess().setMainThread(userThread);
+    process.setMainThread(userThread);
     schedulerService.ready(userThread);
 }
 
@@ -0,0 +1,37 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "CpuTimeNode.h"
+
+#include "kernel/service/SchedulerService.h"
+#include "kernel/system/System.h"
+
+namespace Kernel {
+
+CpuTimeNode::CpuTimeNode(const Util::String &name) : StringNode(name) {}
+
+Util::String CpuTimeNode::getString() {
+    Util::String result;
+    for (const auto &cpuTime : System::getService<SchedulerService>().getCpuTimes()) {
+        result += Util::String::format("cpu%u: idle=", cpuTime.cpuId) + Util::String::toDecimalString(cpuTime.idleTime)
+                + ", busy=" + Util::String::toDecimalString(cpuTime.busyTime) + "\n";
+    }
+
+    return result;
+}
+
+}
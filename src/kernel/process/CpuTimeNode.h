@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_CPUTIMENODE_H
+#define HHUOS_CPUTIMENODE_H
+
+#include "filesystem/memory/StringNode.h"
+#include "lib/util/base/String.h"
+
+namespace Kernel {
+
+/**
+ * Lists the idle and busy time of each CPU in microseconds, one line per CPU.
+ * The idle ratio of an interval can be calculated by reading the node twice.
+ */
+class CpuTimeNode : public Filesystem::Memory::StringNode {
+
+public:
+    /**
+     * Constructor.
+     */
+    explicit CpuTimeNode(const Util::String &name);
+
+    /**
+     * Copy Constructor.
+     */
+    CpuTimeNode(const CpuTimeNode &copy) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    CpuTimeNode& operator=(const CpuTimeNode &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~CpuTimeNode() override = default;
+
+    /**
+     * Overriding function from StringNode.
+     */
+    Util::String getString() override;
+};
+
+}
+
+#endif
@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "FileBackedRegion.h"
+
+#include "filesystem/core/Node.h"
+#include "kernel/paging/Paging.h"
+#include "lib/util/base/Address.h"
+
+namespace Kernel {
+
+FileBackedRegion::FileBackedRegion(Filesystem::Node &node, uint32_t fileOffset, uint32_t fileSize, uint32_t virtualAddress, uint32_t memorySize, bool writable) :
+        node(node), fileOffset(fileOffset), fileSize(fileSize), virtualAddress(virtualAddress), memorySize(memorySize), writable(writable) {}
+
+bool FileBackedRegion::overlapsPage(uint32_t pageAddress) const {
+    return pageAddress < virtualAddress + memorySize && pageAddress + Paging::PAGESIZE > virtualAddress;
+}
+
+void FileBackedRegion::loadPage(uint32_t pageAddress) const {
+    auto fileEnd = virtualAddress + fileSize;
+    auto copyStart = pageAddress > virtualAddress ? pageAddress : virtualAddress;
+    auto copyEnd = pageAddress + Paging::PAGESIZE < fileEnd ? pageAddress + Paging::PAGESIZE : fileEnd;
+
+    // Pages, that only contain BSS, stay filled with zeros
+    if (copyStart >= copyEnd) {
+        return;
+    }
+
+    node.readData(reinterpret_cast<uint8_t*>(copyStart), fileOffset + (copyStart - virtualAddress), copyEnd - copyStart);
+}
+
+bool FileBackedRegion::hasFileData(uint32_t pageAddress) const {
+    auto fileEnd = virtualAddress + fileSize;
+    return fileSize > 0 && pageAddress < fileEnd && pageAddress + Paging::PAGESIZE > virtualAddress;
+}
+
+uint32_t FileBackedRegion::getEndAddress() const {
+    return virtualAddress + memorySize;
+}
+
+bool FileBackedRegion::isWritable() const {
+    return writable;
+}
+
+}
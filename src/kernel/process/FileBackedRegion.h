@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_FILEBACKEDREGION_H
+#define HHUOS_FILEBACKEDREGION_H
+
+#include <cstdint>
+
+namespace Filesystem {
+class Node;
+}  // namespace Filesystem
+
+namespace Kernel {
+
+/**
+ * Part of a process' address space, whose content is loaded from a file on first access (e.g. a LOAD segment of an executable).
+ * Memory behind the end of the file part (e.g. BSS) is filled with zeros.
+ */
+class FileBackedRegion {
+
+public:
+    /**
+     * Constructor.
+     */
+    FileBackedRegion(Filesystem::Node &node, uint32_t fileOffset, uint32_t fileSize, uint32_t virtualAddress, uint32_t memorySize, bool writable);
+
+    /**
+     * Copy Constructor.
+     */
+    FileBackedRegion(const FileBackedRegion &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    FileBackedRegion &operator=(const FileBackedRegion &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~FileBackedRegion() = default;
+
+    [[nodiscard]] bool overlapsPage(uint32_t pageAddress) const;
+
+    /**
+     * Copy the part of the file, that belongs to the given page, into it.
+     * The page must already be mapped and filled with zeros.
+     */
+    void loadPage(uint32_t pageAddress) const;
+
+    /**
+     * @return true, if a part of the file belongs to the given page (false for pages, that only contain BSS)
+     */
+    [[nodiscard]] bool hasFileData(uint32_t pageAddress) const;
+
+    [[nodiscard]] uint32_t getEndAddress() const;
+
+    [[nodiscard]] bool isWritable() const;
+
+private:
+
+    Filesystem::Node &node;
+    uint32_t fileOffset;
+    uint32_t fileSize;
+    uint32_t virtualAddress;
+    uint32_t memorySize;
+    bool writable;
+};
+
+}
+
+#endif
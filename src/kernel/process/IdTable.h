@@ -0,0 +1,207 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+#ifndef HHUOS_IDTABLE_H
+#define HHUOS_IDTABLE_H
+
+#include <cstdint>
+
+#include "lib/util/async/Spinlock.h"
+
+namespace Kernel {
+
+/**
+ * Maps IDs, as handed out by Util::Async::IdGenerator, to objects (e.g. threads and processes).
+ * The table is a radix tree with 256 entries per node, so a lookup always takes four steps, regardless of how many objects are stored.
+ * Lookups do not take a lock and may run concurrently to insertions and removals, which are serialized by a spinlock.
+ * Nodes are only freed when the table is destroyed, so a concurrent lookup never touches freed memory.
+ * The stored objects however may be freed after their removal, so an object, that is used after the lookup,
+ * must be taken with acquire() (T must derive from ReferenceCounted).
+ */
+template<typename T>
+class IdTable {
+
+public:
+    /**
+     * Default Constructor.
+     */
+    IdTable() = default;
+
+    /**
+     * Copy Constructor.
+     */
+    IdTable(const IdTable &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    IdTable &operator=(const IdTable &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~IdTable();
+
+    /**
+     * Insert an object. An object, that is already stored under the same ID, is replaced.
+     */
+    void put(uint32_t id, T &object);
+
+    /**
+     * Remove the object with the given ID, if it is stored in the table.
+     */
+    void remove(uint32_t id);
+
+    /**
+     * @return The object with the given ID, or nullptr if no such object is stored
+     */
+    [[nodiscard]] T* get(uint32_t id) const;
+
+    /**
+     * Look up an object and take a reference on it, so that it is not freed, until removeReference() is called.
+     * The reference is taken with the lock held, so that it can not race with remove().
+     *
+     * @return The referenced object, or nullptr if no such object is stored
+     */
+    [[nodiscard]] T* acquire(uint32_t id);
+
+    [[nodiscard]] uint32_t size() const;
+
+private:
+
+    struct Node {
+        void *volatile entries[256];
+    };
+
+    static uint32_t getIndex(uint32_t id, uint32_t level);
+
+    static void deleteNode(Node *node, uint32_t level);
+
+    Node root{};
+    uint32_t count = 0;
+    Util::Async::Spinlock lock;
+
+    static const constexpr uint32_t BITS_PER_LEVEL = 8;
+    static const constexpr uint32_t LEVELS = 4;
+};
+
+template<typename T>
+IdTable<T>::~IdTable() {
+    for (auto *entry : root.entries) {
+        deleteNode(reinterpret_cast<Node*>(entry), LEVELS - 2);
+    }
+}
+
+template<typename T>
+void IdTable<T>::put(uint32_t id, T &object) {
+    lock.acquire();
+
+    auto *node = &root;
+    for (uint32_t level = LEVELS - 1; level > 0; level--) {
+        auto index = getIndex(id, level);
+        if (node->entries[index] == nullptr) {
+            auto *child = new Node{};
+            // The new node must be completely initialized, before a concurrent lookup can reach it
+            asm volatile ("" ::: "memory");
+            node->entries[index] = child;
+        }
+
+        node = reinterpret_cast<Node*>(node->entries[index]);
+    }
+
+    auto index = getIndex(id, 0);
+    if (node->entries[index] == nullptr) {
+        count++;
+    }
+
+    node->entries[index] = &object;
+    lock.release();
+}
+
+template<typename T>
+void IdTable<T>::remove(uint32_t id) {
+    lock.acquire();
+
+    auto *node = &root;
+    for (uint32_t level = LEVELS - 1; level > 0 && node != nullptr; level--) {
+        node = reinterpret_cast<Node*>(node->entries[getIndex(id, level)]);
+    }
+
+    if (node != nullptr) {
+        auto index = getIndex(id, 0);
+        if (node->entries[index] != nullptr) {
+            node->entries[index] = nullptr;
+            count--;
+        }
+    }
+
+    lock.release();
+}
+
+template<typename T>
+T* IdTable<T>::get(uint32_t id) const {
+    auto *node = &root;
+    for (uint32_t level = LEVELS - 1; level > 0; level--) {
+        node = reinterpret_cast<const Node*>(node->entries[getIndex(id, level)]);
+        if (node == nullptr) {
+            return nullptr;
+        }
+    }
+
+    return reinterpret_cast<T*>(node->entries[getIndex(id, 0)]);
+}
+
+template<typename T>
+T* IdTable<T>::acquire(uint32_t id) {
+    lock.acquire();
+
+    auto *object = get(id);
+    if (object != nullptr) {
+        object->addReference();
+    }
+
+    lock.release();
+    return object;
+}
+
+template<typename T>
+uint32_t IdTable<T>::size() const {
+    return count;
+}
+
+template<typename T>
+uint32_t IdTable<T>::getIndex(uint32_t id, uint32_t level) {
+    return (id >> (level * BITS_PER_LEVEL)) & ((1 << BITS_PER_LEVEL) - 1);
+}
+
+template<typename T>
+void IdTable<T>::deleteNode(Node *node, uint32_t level) {
+    if (node == nullptr) {
+        return;
+    }
+
+    if (level > 0) {
+        for (auto *entry : node->entries) {
+            deleteNode(reinterpret_cast<Node*>(entry), level - 1);
+        }
+    }
+
+    delete node;
+}
+
+}
+
+#endif
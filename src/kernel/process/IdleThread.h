@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_IDLETHREAD_H
+#define HHUOS_IDLETHREAD_H
+
+#include "lib/util/async/Runnable.h"
+
+namespace Kernel {
+
+/**
+ * Runs on a CPU, whenever its run queue is empty and no thread can be taken from another CPU.
+ * Every CPU has its own idle thread, which is never part of a run queue.
+ * Instead of spinning, the idle thread halts the CPU, so that an idle CPU (or virtual CPU) does not consume any cycles.
+ */
+class IdleThread : public Util::Async::Runnable {
+
+public:
+    /**
+     * Default Constructor.
+     */
+    IdleThread() = default;
+
+    /**
+     * Copy Constructor.
+     */
+    IdleThread(const IdleThread &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    IdleThread &operator=(const IdleThread &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~IdleThread() override = default;
+
+    void run() override;
+
+};
+
+}
+
+#endif
@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "ImageCache.h"
+
+#include "kernel/service/MemoryService.h"
+#include "kernel/system/System.h"
+#include "lib/util/collection/Array.h"
+#include "lib/util/io/file/File.h"
+
+namespace Kernel {
+
+SharedImage::SharedImage(const Util::String &path, uint64_t contentStamp, uint64_t length, uint32_t entryPoint) :
+        path(path), contentStamp(contentStamp), length(length), entryPoint(entryPoint) {}
+
+SharedImage::~SharedImage() {
+    auto &memoryService = System::getService<MemoryService>();
+    for (auto physicalAddress : frames.values()) {
+        memoryService.releasePageFrame(physicalAddress);
+    }
+}
+
+bool SharedImage::matches(const Util::String &path, uint64_t contentStamp, uint64_t length, uint32_t entryPoint) const {
+    return SharedImage::path == path && SharedImage::contentStamp == contentStamp && SharedImage::length == length && SharedImage::entryPoint == entryPoint;
+}
+
+uint32_t SharedImage::getFrame(uint32_t pageAddress) {
+    lock.acquire();
+    auto physicalAddress = frames.containsKey(pageAddress) ? frames.get(pageAddress) : 0;
+    lock.release();
+
+    return physicalAddress;
+}
+
+void SharedImage::addFrame(uint32_t pageAddress, uint32_t physicalAddress) {
+    lock.acquire();
+    if (!frames.containsKey(pageAddress)) {
+        System::getService<MemoryService>().referencePageFrame(physicalAddress);
+        frames.put(pageAddress, physicalAddress);
+    }
+
+    lock.release();
+}
+
+ImageCache::~ImageCache() {
+    for (auto *image : images) {
+        delete image;
+    }
+}
+
+SharedImage& ImageCache::acquireImage(const Util::String &path, uint64_t contentStamp, uint64_t length, uint32_t entryPoint) {
+    // The same file may be reached through different paths (e.g. containing "." or "..")
+    auto canonicalPath = Util::Io::File::getCanonicalPath(path);
+    lock.acquire();
+
+    SharedImage *result = nullptr;
+    for (uint32_t i = 0; i < images.size(); i++) {
+        auto *image = images.get(i);
+        if (image->path != canonicalPath) {
+            continue;
+        }
+
+        if (image->matches(canonicalPath, contentStamp, length, entryPoint)) {
+            result = image;
+        } else {
+            // The file has changed -> Its pages must not be shared anymore
+            images.removeIndex(i);
+            if (image->userCount == 0) {
+                delete image;
+            } else {
+                image->stale = true;
+            }
+        }
+
+        break;
+    }
+
+    if (result == nullptr) {
+        if (images.size() >= MAX_IMAGES) {
+            evictUnusedImage();
+        }
+
+        result = new SharedImage(canonicalPath, contentStamp, length, entryPoint);
+        images.add(result);
+    }
+
+    result->userCount++;
+    lock.release();
+
+    return *result;
+}
+
+void ImageCache::releaseImage(SharedImage &image) {
+    lock.acquire();
+    image.userCount--;
+    if (image.stale && image.userCount == 0) {
+        delete &image;
+    }
+
+    lock.release();
+}
+
+void ImageCache::evictUnusedImage() {
+    // Images are appended on creation, so the first unused image is the oldest one
+    for (uint32_t i = 0; i < images.size(); i++) {
+        auto *image = images.get(i);
+        if (image->userCount == 0) {
+            images.removeIndex(i);
+            delete image;
+            return;
+        }
+    }
+}
+
+}
@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_IMAGECACHE_H
+#define HHUOS_IMAGECACHE_H
+
+#include <cstdint>
+
+#include "lib/util/async/Spinlock.h"
+#include "lib/util/base/String.h"
+#include "lib/util/collection/ArrayList.h"
+#include "lib/util/collection/HashMap.h"
+
+namespace Kernel {
+
+/**
+ * Page frames holding the read-only pages (text and rodata) of an executable.
+ * Processes running the same executable map these frames instead of loading private copies.
+ * The image holds a reference to each frame, so that they are kept, even if no process is using them.
+ */
+class SharedImage {
+
+public:
+    /**
+     * Constructor.
+     */
+    SharedImage(const Util::String &path, uint64_t contentStamp, uint64_t length, uint32_t entryPoint);
+
+    /**
+     * Copy Constructor.
+     */
+    SharedImage(const SharedImage &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    SharedImage &operator=(const SharedImage &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~SharedImage();
+
+    [[nodiscard]] bool matches(const Util::String &path, uint64_t contentStamp, uint64_t length, uint32_t entryPoint) const;
+
+    /**
+     * @return The physical address of the frame holding the given page, or 0 if it has not been loaded yet
+     */
+    [[nodiscard]] uint32_t getFrame(uint32_t pageAddress);
+
+    /**
+     * Share a loaded page frame with other processes. If another process has added the page in the meantime, nothing happens.
+     */
+    void addFrame(uint32_t pageAddress, uint32_t physicalAddress);
+
+private:
+
+    friend class ImageCache;
+
+    Util::String path;
+    uint64_t contentStamp;
+    uint64_t length;
+    uint32_t entryPoint;
+
+    Util::HashMap<uint32_t, uint32_t> frames;
+    Util::Async::Spinlock lock;
+
+    uint32_t userCount = 0;
+    bool stale = false;
+};
+
+/**
+ * Keeps the shared images of recently executed binaries, keyed by their canonical path and file identity
+ * (the filesystem's content stamp, length and entry point). An image is replaced, once its file has changed.
+ */
+class ImageCache {
+
+public:
+    /**
+     * Default Constructor.
+     */
+    ImageCache() = default;
+
+    /**
+     * Copy Constructor.
+     */
+    ImageCache(const ImageCache &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    ImageCache &operator=(const ImageCache &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~ImageCache();
+
+    /**
+     * Get the shared image of a binary, creating it if necessary. Must be released by the process, once it has finished.
+     *
+     * @param contentStamp The content stamp of the binary's filesystem node (must not be 0, see Filesystem::Node::getContentStamp())
+     */
+    [[nodiscard]] SharedImage& acquireImage(const Util::String &path, uint64_t contentStamp, uint64_t length, uint32_t entryPoint);
+
+    void releaseImage(SharedImage &image);
+
+    static const constexpr uint32_t MAX_IMAGES = 16;
+
+private:
+
+    void evictUnusedImage();
+
+    Util::ArrayList<SharedImage*> images;
+    Util::Async::Spinlock lock;
+};
+
+}
+
+#endif
@@ -0,0 +1,206 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "IoRing.h"
+
+#include "kernel/process/Process.h"
+#include "kernel/process/Thread.h"
+#include "kernel/service/MemoryService.h"
+#include "kernel/service/NetworkService.h"
+#include "kernel/service/SchedulerService.h"
+#include "kernel/system/System.h"
+#include "device/cpu/Cpu.h"
+#include "filesystem/core/Node.h"
+#include "lib/util/async/Atomic.h"
+#include "lib/util/network/Datagram.h"
+
+namespace Kernel {
+
+IoRing::IoRing(Process &process, Util::Io::IoRing::Rings &rings) : process(process), rings(rings) {}
+
+void IoRing::start() {
+    auto &schedulerService = System::getService<SchedulerService>();
+    for (uint32_t i = 0; i < WORKER_COUNT; i++) {
+        auto flags = acquireLock();
+        runningWorkers++;
+        releaseLock(flags);
+
+        auto &thread = Thread::createKernelThread("Io-Ring-Worker", process, new Worker(*this));
+        schedulerService.ready(thread);
+    }
+}
+
+uint32_t IoRing::enter(uint32_t minCompletions) {
+    if (minCompletions > rings.capacity) {
+        minCompletions = rings.capacity;
+    }
+
+    submissionQueue.notifyAll();
+
+    uint32_t availableCompletions = 0;
+    completionQueue.waitUntil([this, minCompletions, &availableCompletions]{
+        auto flags = acquireLock();
+        availableCompletions = getAvailableCompletions();
+        auto pendingSubmissions = Util::Async::Atomic<uint32_t>(rings.submissionTail).get() - rings.submissionHead;
+        auto done = availableCompletions >= minCompletions || (operationsInFlight == 0 && pendingSubmissions == 0) || runningWorkers == 0;
+        releaseLock(flags);
+
+        return done;
+    });
+
+    return availableCompletions;
+}
+
+void IoRing::stop() {
+    auto flags = acquireLock();
+    stopping = true;
+    releaseLock(flags);
+
+    submissionQueue.notifyAll();
+    completionQueue.waitUntil([this]{
+        auto flags = acquireLock();
+        auto done = runningWorkers == 0;
+        releaseLock(flags);
+
+        return done;
+    });
+}
+
+bool IoRing::uses(const Util::Io::IoRing::Rings &otherRings) const {
+    return &rings == &otherRings;
+}
+
+IoRing::Worker::Worker(IoRing &ring) : ring(ring) {}
+
+void IoRing::Worker::run() {
+    ring.work();
+}
+
+void IoRing::work() {
+    while (true) {
+        Util::Io::IoRing::Submission submission{};
+        bool exit = false;
+
+        submissionQueue.waitUntil([this, &submission, &exit]{
+            auto flags = acquireLock();
+            exit = stopping;
+            auto claimed = !exit && claimSubmission(submission);
+            releaseLock(flags);
+
+            return exit || claimed;
+        });
+
+        if (exit) {
+            break;
+        }
+
+        auto result = execute(submission);
+        postCompletion(submission.userData, result);
+        completionQueue.notifyAll();
+    }
+
+    // The ring may be deleted, as soon as stop() sees the last worker exit. It evaluates its condition with the
+    // completion queue's lock held, so releasing that lock is the last access to the ring by this worker.
+    completionQueue.notifyAll([this]{
+        auto flags = acquireLock();
+        runningWorkers--;
+        releaseLock(flags);
+    });
+}
+
+bool IoRing::claimSubmission(Util::Io::IoRing::Submission &submission) {
+    auto head = rings.submissionHead;
+    if (head == Util::Async::Atomic<uint32_t>(rings.submissionTail).get()) {
+        return false;
+    }
+
+    // Every submission, that has been claimed, needs a free completion slot
+    if (getAvailableCompletions() + operationsInFlight >= rings.capacity) {
+        return false;
+    }
+
+    submission = rings.submissions[head & (rings.capacity - 1)];
+    Util::Async::Atomic<uint32_t>(rings.submissionHead).set(head + 1);
+    operationsInFlight++;
+
+    return true;
+}
+
+void IoRing::postCompletion(uint32_t userData, int32_t result) {
+    auto flags = acquireLock();
+
+    auto tail = rings.completionTail;
+    rings.completions[tail & (rings.capacity - 1)] = { userData, result };
+    Util::Async::Atomic<uint32_t>(rings.completionTail).set(tail + 1);
+    operationsInFlight--;
+
+    releaseLock(flags);
+}
+
+uint32_t IoRing::acquireLock() {
+    // The lock is also taken while evaluating wait conditions with interrupts disabled, so it must never be held by a preempted thread
+    auto flags = Device::Cpu::saveAndDisableInterrupts();
+    while (!lock.tryAcquire()) {
+        asm volatile ("pause");
+    }
+
+    return flags;
+}
+
+void IoRing::releaseLock(uint32_t flags) {
+    lock.release();
+    Device::Cpu::restoreInterrupts(flags);
+}
+
+uint32_t IoRing::getAvailableCompletions() const {
+    auto head = Util::Async::Atomic<uint32_t>(const_cast<uint32_t&>(rings.completionHead)).get();
+    return rings.completionTail - head;
+}
+
+int32_t IoRing::execute(const Util::Io::IoRing::Submission &submission) {
+    // Invalid descriptors fail the operation, instead of raising a kernel exception like the corresponding system calls
+    auto &fileDescriptorManager = process.getFileDescriptorManager();
+    if (!fileDescriptorManager.isValid(submission.fileDescriptor)) {
+        return -1;
+    }
+
+    // Operations are executed by the ring's worker, so their buffers do not pass the system call boundary (see SystemCall::loadUserBuffers())
+    System::getService<MemoryService>().loadFileBackedPages(submission.buffer, submission.length);
+
+    switch (submission.operation) {
+        case Util::Io::IoRing::READ_FILE: {
+            auto &node = fileDescriptorManager.getNode(submission.fileDescriptor);
+            return static_cast<int32_t>(node.readData(static_cast<uint8_t*>(submission.buffer), submission.offset, submission.length));
+        }
+        case Util::Io::IoRing::WRITE_FILE: {
+            auto &node = fileDescriptorManager.getNode(submission.fileDescriptor);
+            return static_cast<int32_t>(node.writeData(static_cast<const uint8_t*>(submission.buffer), submission.offset, submission.length));
+        }
+        case Util::Io::IoRing::SEND_DATAGRAM: {
+            auto &datagram = *static_cast<Util::Network::Datagram*>(submission.buffer);
+            return System::getService<NetworkService>().sendDatagram(submission.fileDescriptor, datagram) ? static_cast<int32_t>(datagram.getLength()) : -1;
+        }
+        case Util::Io::IoRing::RECEIVE_DATAGRAM: {
+            auto &datagram = *static_cast<Util::Network::Datagram*>(submission.buffer);
+            return System::getService<NetworkService>().receiveDatagram(submission.fileDescriptor, datagram) ? static_cast<int32_t>(datagram.getLength()) : -1;
+        }
+        default:
+            return -1;
+    }
+}
+
+}
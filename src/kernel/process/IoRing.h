@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_IORING_H
+#define HHUOS_IORING_H
+
+#include <cstdint>
+
+#include "kernel/process/WaitQueue.h"
+#include "lib/util/async/Runnable.h"
+#include "lib/util/async/Spinlock.h"
+#include "lib/util/io/ring/IoRing.h"
+
+namespace Kernel {
+class Process;
+
+/**
+ * Kernel side of a submission/completion ring pair (see Util::Io::IoRing).
+ * Submissions are processed by worker threads, which belong to the ring's process, so that they can access its memory
+ * and file descriptors. A submission is only taken from the ring, if there is a free slot for its completion,
+ * so completions never overflow.
+ */
+class IoRing {
+
+public:
+    /**
+     * Constructor.
+     */
+    IoRing(Process &process, Util::Io::IoRing::Rings &rings);
+
+    /**
+     * Copy Constructor.
+     */
+    IoRing(const IoRing &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    IoRing &operator=(const IoRing &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~IoRing() = default;
+
+    /**
+     * Create the worker threads.
+     */
+    void start();
+
+    /**
+     * Wake up the workers to process new submissions and wait, until at least the given number of completions is available.
+     * Returns early, if there are not enough operations left to satisfy the request.
+     *
+     * @return The number of available completions
+     */
+    uint32_t enter(uint32_t minCompletions);
+
+    /**
+     * Let the workers finish their current operations and wait for them to exit.
+     * Submissions, that have not been started yet, are discarded.
+     */
+    void stop();
+
+    [[nodiscard]] bool uses(const Util::Io::IoRing::Rings &rings) const;
+
+    static const constexpr uint32_t WORKER_COUNT = 2;
+
+private:
+
+    class Worker : public Util::Async::Runnable {
+
+    public:
+
+        explicit Worker(IoRing &ring);
+
+        Worker(const Worker &other) = delete;
+
+        Worker &operator=(const Worker &other) = delete;
+
+        ~Worker() override = default;
+
+        void run() override;
+
+    private:
+
+        IoRing &ring;
+    };
+
+    void work();
+
+    /**
+     * Take the next submission from the ring and reserve a slot for its completion. Must be called with the lock held.
+     */
+    bool claimSubmission(Util::Io::IoRing::Submission &submission);
+
+    void postCompletion(uint32_t userData, int32_t result);
+
+    uint32_t acquireLock();
+
+    void releaseLock(uint32_t flags);
+
+    [[nodiscard]] uint32_t getAvailableCompletions() const;
+
+    int32_t execute(const Util::Io::IoRing::Submission &submission);
+
+    Process &process;
+    Util::Io::IoRing::Rings &rings;
+
+    Util::Async::Spinlock lock = Util::Async::Spinlock("io-ring");
+    WaitQueue submissionQueue;
+    WaitQueue completionQueue;
+    uint32_t operationsInFlight = 0;
+    uint32_t runningWorkers = 0;
+    bool stopping = false;
+};
+
+}
+
+#endif
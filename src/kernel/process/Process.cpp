@@ -19,6 +19,12 @@
 #include "Process.h"
 #include "kernel/paging/VirtualAddressSpace.h"
 #include "kernel/process/Thread.h"
+#include "kernel/process/FileBackedRegion.h"
+#include "kernel/process/ImageCache.h"
+#include "kernel/process/IoRing.h"
+#include "kernel/process/SystemCallTrace.h"
+#include "kernel/service/ProcessService.h"
+#include "filesystem/core/Node.h"
 #include "kernel/service/MemoryService.h"
 #include "kernel/service/SchedulerService.h"
 #include "lib/util/async/IdGenerator.h"
@@ -33,6 +39,31 @@ Process::Process(VirtualAddressSpace &addressSpace, const Util::String &name, co
 
 Process::~Process() {
     Kernel::System::getService<Kernel::MemoryService>().removeAddressSpace(addressSpace);
+
+    for (auto *region : fileBackedRegions) {
+        delete region;
+    }
+
+    delete executable;
+
+    if (sharedImage != nullptr) {
+        Kernel::System::getService<Kernel::ProcessService>().getImageCache().releaseImage(*sharedImage);
+    }
+
+    // All threads (including ring workers) have terminated at this point
+    for (auto *ring : ioRings) {
+        delete ring;
+    }
+
+    if (systemCallTrace != nullptr && systemCallTrace->detachTracedProcess()) {
+        delete systemCallTrace;
+    }
+
+    for (auto *trace : tracedProcesses) {
+        if (trace->detachTracer()) {
+            delete trace;
+        }
+    }
 }
 
 bool Process::operator==(const Process &other) const {
@@ -115,27 +146,185 @@ Util::String Process::getName() const {
     return name;
 }
 
-Util::Array<Thread*> Process::getThreads() const {
-    return threads.toArray();
+Util::Array<Thread*> Process::getThreads() {
+    threadLock.acquire();
+    auto result = threads.toArray();
+    threadLock.release();
+
+    return result;
 }
 
 void Process::addThread(Thread &thread) {
+    threadLock.acquire();
     threads.add(&thread);
+    threadLock.release();
 }
 
 void Process::removeThread(Thread &thread) {
-    threads.remove(&thread);
+    threadLock.acquire();
+    if (threads.remove(&thread)) {
+        terminatedThreadStatistics += thread.getStatistics();
+    }
+
+    threadLock.release();
+}
+
+Thread::Statistics Process::getStatistics() {
+    threadLock.acquire();
+    auto statistics = terminatedThreadStatistics;
+    for (const auto *thread : threads) {
+        statistics += thread->getStatistics();
+    }
+
+    threadLock.release();
+    return statistics;
 }
 
 void Process::killAllThreadsButCurrent() {
     auto &schedulerService = System::getService<SchedulerService>();
     auto currentThreadId = schedulerService.getCurrentThread().getId();
 
-    for (auto *thread : threads) {
+    // Iterate over a copy, since killed threads are removed from the list
+    for (auto *thread : getThreads()) {
         if (thread->getId() != currentThreadId) {
-            schedulerService.killWithoutLock(*thread);
+            schedulerService.kill(*thread);
         }
     }
 }
 
-}
\ No newline at end of file
+void Process::setExecutable(Filesystem::Node *node) {
+    delete executable;
+    executable = node;
+}
+
+void Process::addFileBackedRegion(FileBackedRegion *region) {
+    fileBackedRegions.add(region);
+}
+
+bool Process::isFileBacked(uint32_t address) {
+    auto pageAddress = address & 0xfffff000;
+    for (const auto *region : fileBackedRegions) {
+        if (region->overlapsPage(pageAddress)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void Process::loadFileBackedPage(uint32_t pageAddress) {
+    for (const auto *region : fileBackedRegions) {
+        if (region->overlapsPage(pageAddress)) {
+            region->loadPage(pageAddress);
+        }
+    }
+}
+
+bool Process::isFileBackedPageReadOnly(uint32_t pageAddress) {
+    for (const auto *region : fileBackedRegions) {
+        if (region->overlapsPage(pageAddress) && region->isWritable()) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool Process::isFileBackedPageZeroFilled(uint32_t pageAddress) {
+    for (const auto *region : fileBackedRegions) {
+        if (region->overlapsPage(pageAddress) && region->hasFileData(pageAddress)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void Process::setSharedImage(SharedImage &image) {
+    sharedImage = &image;
+}
+
+SharedImage* Process::getSharedImage() {
+    return sharedImage;
+}
+
+Util::Async::Mutex& Process::getFileBackedRegionLock() {
+    return fileBackedRegionLock;
+}
+
+void Process::addIoRing(IoRing &ring) {
+    ioRingLock.acquire();
+    ioRings.add(&ring);
+    ioRingLock.release();
+}
+
+IoRing* Process::getIoRing(const Util::Io::IoRing::Rings &rings) {
+    ioRingLock.acquire();
+
+    IoRing *result = nullptr;
+    for (auto *ring : ioRings) {
+        if (ring->uses(rings)) {
+            result = ring;
+            break;
+        }
+    }
+
+    ioRingLock.release();
+    return result;
+}
+
+IoRing* Process::removeIoRing(const Util::Io::IoRing::Rings &rings) {
+    ioRingLock.acquire();
+
+    IoRing *result = nullptr;
+    for (auto *ring : ioRings) {
+        if (ring->uses(rings)) {
+            result = ring;
+            break;
+        }
+    }
+
+    if (result != nullptr) {
+        ioRings.remove(result);
+    }
+
+    ioRingLock.release();
+    return result;
+}
+
+void Process::setSystemCallTrace(SystemCallTrace &trace) {
+    systemCallTrace = &trace;
+}
+
+SystemCallTrace* Process::getSystemCallTrace() const {
+    return systemCallTrace;
+}
+
+void Process::addTracedProcess(SystemCallTrace &trace) {
+    tracedProcessLock.acquire();
+    tracedProcesses.add(&trace);
+    tracedProcessLock.release();
+}
+
+SystemCallTrace* Process::getTracedProcess(uint32_t processId) {
+    tracedProcessLock.acquire();
+
+    SystemCallTrace *result = nullptr;
+    for (auto *trace : tracedProcesses) {
+        if (trace->getProcessId() == processId) {
+            result = trace;
+            break;
+        }
+    }
+
+    tracedProcessLock.release();
+    return result;
+}
+
+void Process::removeTracedProcess(SystemCallTrace &trace) {
+    tracedProcessLock.acquire();
+    tracedProcesses.remove(&trace);
+    tracedProcessLock.release();
+}
+
+}
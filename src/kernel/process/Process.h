@@ -25,7 +25,11 @@
 #include "lib/util/collection/Array.h"
 #include "lib/util/collection/ArrayList.h"
 #include "lib/util/base/String.h"
+#include "lib/util/async/Spinlock.h"
+#include "lib/util/async/Mutex.h"
+#include "lib/util/io/ring/IoRing.h"
 #include "kernel/process/Thread.h"
+#include "kernel/process/ReferenceCounted.h"
 
 namespace Util {
 namespace Async {
@@ -33,10 +37,18 @@ template <typename T> class IdGenerator;
 }  // namespace Async
 }  // namespace Util
 
+namespace Filesystem {
+class Node;
+}  // namespace Filesystem
+
 namespace Kernel {
+class FileBackedRegion;
+class IoRing;
+class SharedImage;
+class SystemCallTrace;
 class VirtualAddressSpace;
 
-class Process {
+class Process : public ReferenceCounted {
 
 public:
     /**
@@ -87,7 +99,12 @@ public:
 
     [[nodiscard]] Util::String getName() const;
 
-    [[nodiscard]] Util::Array<Thread*> getThreads() const;
+    [[nodiscard]] Util::Array<Thread*> getThreads();
+
+    /**
+     * @return The summed up statistics of all threads, including those that have already terminated
+     */
+    [[nodiscard]] Thread::Statistics getStatistics();
 
     void addThread(Thread &thread);
 
@@ -95,6 +112,81 @@ public:
 
     void killAllThreadsButCurrent();
 
+    /**
+     * Set the executable, whose segments are loaded on demand. The process takes ownership of the node.
+     */
+    void setExecutable(Filesystem::Node *node);
+
+    /**
+     * Register a region, whose pages are loaded from the executable on first access. The process takes ownership of the region.
+     */
+    void addFileBackedRegion(FileBackedRegion *region);
+
+    [[nodiscard]] bool isFileBacked(uint32_t address);
+
+    /**
+     * @return true, if no region overlapping the page is writable, so that the page may be shared with other processes
+     */
+    [[nodiscard]] bool isFileBackedPageReadOnly(uint32_t pageAddress);
+
+    /**
+     * @return true, if no region overlapping the page has file data in it, so that the page is just filled with zeros (e.g. BSS)
+     */
+    [[nodiscard]] bool isFileBackedPageZeroFilled(uint32_t pageAddress);
+
+    /**
+     * Set the image, whose read-only pages are shared with other processes running the same executable.
+     * The image is released, once the process is destroyed.
+     */
+    void setSharedImage(SharedImage &image);
+
+    [[nodiscard]] SharedImage* getSharedImage();
+
+    /**
+     * Fill a mapped page, which must be filled with zeros, with the content of all file backed regions overlapping it.
+     */
+    void loadFileBackedPage(uint32_t pageAddress);
+
+    /**
+     * Serializes loading file backed pages, so that no thread sees a page, before it has been filled completely.
+     */
+    [[nodiscard]] Util::Async::Mutex& getFileBackedRegionLock();
+
+    /**
+     * Register an I/O ring. The process owns the ring and deletes it, if it is still registered when the process is destroyed.
+     */
+    void addIoRing(IoRing &ring);
+
+    [[nodiscard]] IoRing* getIoRing(const Util::Io::IoRing::Rings &rings);
+
+    /**
+     * Unregister an I/O ring, without deleting it.
+     *
+     * @return The ring or nullptr, if no ring uses the given rings
+     */
+    IoRing* removeIoRing(const Util::Io::IoRing::Rings &rings);
+
+    /**
+     * Record all system calls of this process in the given trace. Must be set, before the process starts running.
+     * The process detaches from the trace, once it is destroyed.
+     */
+    void setSystemCallTrace(SystemCallTrace &trace);
+
+    /**
+     * @return The trace, the system calls of this process are recorded in, or nullptr, if the process is not traced
+     */
+    [[nodiscard]] SystemCallTrace* getSystemCallTrace() const;
+
+    /**
+     * Register the trace of a process, that has been started by this process. This process detaches from all
+     * remaining traces, once it is destroyed.
+     */
+    void addTracedProcess(SystemCallTrace &trace);
+
+    [[nodiscard]] SystemCallTrace* getTracedProcess(uint32_t processId);
+
+    void removeTracedProcess(SystemCallTrace &trace);
+
 private:
 
     [[nodiscard]] Util::Io::File getFileFromPath(const Util::String &path);
@@ -105,7 +197,21 @@ private:
     FileDescriptorManager fileDescriptorManager;
     Util::Io::File workingDirectory;
     Util::ArrayList<Thread*> threads;
+    Util::Async::Spinlock threadLock; // Threads of the same process may be added and removed by different CPUs
     Thread *mainThread = nullptr;
+    Thread::Statistics terminatedThreadStatistics;
+
+    Filesystem::Node *executable = nullptr;
+    Util::ArrayList<FileBackedRegion*> fileBackedRegions;
+    SharedImage *sharedImage = nullptr;
+    Util::Async::Mutex fileBackedRegionLock;
+
+    Util::ArrayList<IoRing*> ioRings;
+    Util::Async::Spinlock ioRingLock = Util::Async::Spinlock("io-ring-list");
+
+    SystemCallTrace *systemCallTrace = nullptr;
+    Util::ArrayList<SystemCallTrace*> tracedProcesses;
+    Util::Async::Spinlock tracedProcessLock = Util::Async::Spinlock("traced-process-list");
 
     bool finished = false;
     int32_t exitCode = -1;
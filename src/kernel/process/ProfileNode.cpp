@@ -0,0 +1,51 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "ProfileNode.h"
+
+#include "kernel/process/SamplingProfiler.h"
+#include "kernel/service/SchedulerService.h"
+#include "kernel/system/System.h"
+
+namespace Kernel {
+
+ProfileNode::ProfileNode(const Util::String &name) : MemoryNode(name) {}
+
+Util::Io::File::Type ProfileNode::getType() {
+    return Util::Io::File::CHARACTER;
+}
+
+uint64_t ProfileNode::readData(uint8_t *targetBuffer, uint64_t pos, uint64_t numBytes) {
+    auto &profiler = System::getService<SchedulerService>().getProfiler();
+    auto count = profiler.readSamples(reinterpret_cast<SamplingProfiler::Sample*>(targetBuffer), numBytes / sizeof(SamplingProfiler::Sample));
+
+    return count * sizeof(SamplingProfiler::Sample);
+}
+
+uint64_t ProfileNode::writeData(const uint8_t *sourceBuffer, uint64_t pos, uint64_t numBytes) {
+    auto &profiler = System::getService<SchedulerService>().getProfiler();
+    auto frequency = Util::String::parseInt(Util::String(sourceBuffer, numBytes).strip());
+    if (frequency <= 0) {
+        profiler.stop();
+    } else {
+        profiler.start(frequency > static_cast<int32_t>(SamplingProfiler::MAX_FREQUENCY) ? SamplingProfiler::MAX_FREQUENCY : frequency);
+    }
+
+    return numBytes;
+}
+
+}
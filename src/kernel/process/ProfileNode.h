@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_PROFILENODE_H
+#define HHUOS_PROFILENODE_H
+
+#include <cstdint>
+
+#include "filesystem/memory/MemoryNode.h"
+#include "lib/util/base/String.h"
+#include "lib/util/io/file/File.h"
+
+namespace Kernel {
+
+/**
+ * Interface to the sampling profiler.
+ * Writing a decimal frequency in Hz starts sampling (discarding old samples), writing 0 stops it.
+ * Reading removes recorded samples and returns them as an array of SamplingProfiler::Sample structures.
+ */
+class ProfileNode : public Filesystem::Memory::MemoryNode {
+
+public:
+    /**
+     * Constructor.
+     */
+    explicit ProfileNode(const Util::String &name = "profile");
+
+    /**
+     * Copy Constructor.
+     */
+    ProfileNode(const ProfileNode &copy) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    ProfileNode &operator=(const ProfileNode &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~ProfileNode() override = default;
+
+    /**
+     * Overriding function from Node.
+     */
+    Util::Io::File::Type getType() override;
+
+    /**
+     * Overriding function from Node.
+     */
+    uint64_t readData(uint8_t *targetBuffer, uint64_t pos, uint64_t numBytes) override;
+
+    /**
+     * Overriding function from Node.
+     */
+    uint64_t writeData(const uint8_t *sourceBuffer, uint64_t pos, uint64_t numBytes) override;
+};
+
+}
+
+#endif
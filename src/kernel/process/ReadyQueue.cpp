@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+#include "ReadyQueue.h"
+
+#include "lib/util/base/Exception.h"
+
+namespace Kernel {
+
+void ReadyQueue::enqueue(Thread &thread) {
+    if (thread.readyQueue != nullptr) {
+        Util::Exception::throwException(Util::Exception::INVALID_ARGUMENT, "ReadyQueue: Thread is already queued!");
+    }
+
+    auto priority = thread.priority;
+    thread.readyQueue = this;
+    thread.queueNext = nullptr;
+    thread.queuePrevious = tails[priority];
+
+    if (tails[priority] == nullptr) {
+        heads[priority] = &thread;
+        bitmap |= 1u << priority;
+    } else {
+        tails[priority]->queueNext = &thread;
+    }
+
+    tails[priority] = &thread;
+    count++;
+}
+
+Thread* ReadyQueue::dequeue() {
+    if (bitmap == 0) {
+        return nullptr;
+    }
+
+    auto *thread = heads[getHighestPriority()];
+    remove(*thread);
+
+    return thread;
+}
+
+void ReadyQueue::remove(Thread &thread) {
+    if (thread.readyQueue != this) {
+        return;
+    }
+
+    auto priority = thread.priority;
+    if (thread.queuePrevious == nullptr) {
+        heads[priority] = thread.queueNext;
+    } else {
+        thread.queuePrevious->queueNext = thread.queueNext;
+    }
+
+    if (thread.queueNext == nullptr) {
+        tails[priority] = thread.queuePrevious;
+    } else {
+        thread.queueNext->queuePrevious = thread.queuePrevious;
+    }
+
+    if (heads[priority] == nullptr) {
+        bitmap &= ~(1u << priority);
+    }
+
+    thread.readyQueue = nullptr;
+    thread.queueNext = nullptr;
+    thread.queuePrevious = nullptr;
+    count--;
+}
+
+bool ReadyQueue::contains(const Thread &thread) const {
+    return thread.readyQueue == this;
+}
+
+bool ReadyQueue::isEmpty() const {
+    return count == 0;
+}
+
+uint32_t ReadyQueue::size() const {
+    return count;
+}
+
+int32_t ReadyQueue::getHighestPriority() const {
+    if (bitmap == 0) {
+        return -1;
+    }
+
+    uint32_t index;
+    asm volatile ("bsr %1, %0" : "=r"(index) : "rm"(bitmap));
+    return static_cast<int32_t>(index);
+}
+
+}
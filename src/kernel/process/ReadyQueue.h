@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+#ifndef HHUOS_READYQUEUE_H
+#define HHUOS_READYQUEUE_H
+
+#include <cstdint>
+
+#include "kernel/process/Thread.h"
+
+namespace Kernel {
+
+/**
+ * Holds the ready threads of a run queue, with one FIFO list per priority level.
+ * Threads are linked through pointers inside the threads themselves and a bitmap marks non-empty levels,
+ * so that enqueuing, dequeuing the highest priority thread and removing an arbitrary thread are O(1).
+ */
+class ReadyQueue {
+
+public:
+    /**
+     * Default Constructor.
+     */
+    ReadyQueue() = default;
+
+    /**
+     * Copy Constructor.
+     */
+    ReadyQueue(const ReadyQueue &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    ReadyQueue &operator=(const ReadyQueue &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~ReadyQueue() = default;
+
+    /**
+     * Append a thread to the list of its priority level.
+     * A thread can only be part of a single ready queue at a time.
+     */
+    void enqueue(Thread &thread);
+
+    /**
+     * Remove the first thread from the highest non-empty priority level.
+     *
+     * @return The removed thread, or nullptr if the queue is empty
+     */
+    Thread* dequeue();
+
+    void remove(Thread &thread);
+
+    [[nodiscard]] bool contains(const Thread &thread) const;
+
+    [[nodiscard]] bool isEmpty() const;
+
+    [[nodiscard]] uint32_t size() const;
+
+    /**
+     * @return The highest priority of all queued threads, or -1 if the queue is empty
+     */
+    [[nodiscard]] int32_t getHighestPriority() const;
+
+    /**
+     * Search the queue in dequeue order (highest priority first).
+     *
+     * @return The first thread matching the predicate, or nullptr if no thread matches
+     */
+    template<typename Predicate>
+    Thread* find(Predicate predicate) const {
+        for (int32_t priority = getHighestPriority(); priority >= 0; priority--) {
+            for (auto *thread = heads[priority]; thread != nullptr; thread = thread->queueNext) {
+                if (predicate(*thread)) {
+                    return thread;
+                }
+            }
+        }
+
+        return nullptr;
+    }
+
+private:
+
+    static_assert(Thread::PRIORITY_LEVELS <= 32, "ReadyQueue: The bitmap supports at most 32 priority levels!");
+
+    Thread *heads[Thread::PRIORITY_LEVELS]{};
+    Thread *tails[Thread::PRIORITY_LEVELS]{};
+    uint32_t bitmap = 0;
+    uint32_t count = 0;
+};
+
+}
+
+#endif
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_REFERENCECOUNTED_H
+#define HHUOS_REFERENCECOUNTED_H
+
+#include <cstdint>
+
+#include "lib/util/async/Atomic.h"
+
+namespace Kernel {
+
+/**
+ * Base class for objects, that are looked up by ID (see IdTable) and used without holding the table's lock.
+ * A reference keeps the object alive, after it has been removed from its table.
+ * The owner must not free the object, while it is still referenced (see SchedulerCleaner).
+ */
+class ReferenceCounted {
+
+public:
+    /**
+     * Default Constructor.
+     */
+    ReferenceCounted() = default;
+
+    /**
+     * Copy Constructor.
+     */
+    ReferenceCounted(const ReferenceCounted &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    ReferenceCounted &operator=(const ReferenceCounted &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~ReferenceCounted() = default;
+
+    void addReference() {
+        Util::Async::Atomic<uint32_t>(references).inc();
+    }
+
+    void removeReference() {
+        Util::Async::Atomic<uint32_t>(references).dec();
+    }
+
+    [[nodiscard]] bool isReferenced() {
+        return Util::Async::Atomic<uint32_t>(references).get() != 0;
+    }
+
+private:
+
+    uint32_t references = 0;
+};
+
+}
+
+#endif
@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "SamplingProfiler.h"
+
+#include "kernel/process/Process.h"
+#include "kernel/process/Thread.h"
+#include "kernel/process/ThreadState.h"
+#include "kernel/system/PerCpu.h"
+#include "kernel/system/System.h"
+#include "lib/util/async/Atomic.h"
+#include "lib/util/base/Exception.h"
+
+namespace Kernel {
+
+void SamplingProfiler::start(uint32_t frequency) {
+    if (frequency == 0 || frequency > MAX_FREQUENCY) {
+        Util::Exception::throwException(Util::Exception::INVALID_ARGUMENT, "SamplingProfiler: Invalid frequency!");
+    }
+
+    stop();
+    readLock.acquire();
+
+    samplingPeriod = 1000000000 / frequency;
+    for (uint32_t i = 0; i < 256; i++) {
+        if (System::getPerCpuData(i) == nullptr) {
+            continue;
+        }
+
+        if (buffers[i] == nullptr) {
+            buffers[i] = new CpuBuffer();
+        }
+
+        buffers[i]->readIndex = 0;
+        buffers[i]->writeIndex = 0;
+        buffers[i]->remainingNanoseconds = static_cast<int32_t>(samplingPeriod);
+    }
+
+    this->frequency = frequency;
+    lostSamples = 0;
+    readLock.release();
+
+    running = true;
+}
+
+void SamplingProfiler::stop() {
+    running = false;
+}
+
+bool SamplingProfiler::isRunning() const {
+    return running;
+}
+
+uint32_t SamplingProfiler::getFrequency() const {
+    return frequency;
+}
+
+uint32_t SamplingProfiler::getLostSamples() const {
+    return lostSamples;
+}
+
+void SamplingProfiler::tick(const InterruptFrame &frame, uint32_t elapsedNanoseconds) {
+    if (!running) {
+        return;
+    }
+
+    auto cpuId = CpuLocal::cpuId.get();
+    auto *buffer = buffers[cpuId];
+    if (buffer == nullptr) {
+        // CPU has been started after the profiler
+        return;
+    }
+
+    buffer->remainingNanoseconds -= static_cast<int32_t>(elapsedNanoseconds);
+    if (buffer->remainingNanoseconds > 0) {
+        return;
+    }
+
+    buffer->remainingNanoseconds += static_cast<int32_t>(samplingPeriod);
+    if (buffer->remainingNanoseconds <= 0) {
+        // The timer is slower than the sampling frequency
+        buffer->remainingNanoseconds = static_cast<int32_t>(samplingPeriod);
+    }
+
+    auto readIndex = Util::Async::Atomic<uint32_t>(buffer->readIndex).get();
+    if (buffer->writeIndex - readIndex == BUFFER_CAPACITY) {
+        Util::Async::Atomic<uint32_t>(lostSamples).inc();
+        return;
+    }
+
+    auto *thread = CpuLocal::currentThread.get();
+    auto &sample = buffer->samples[buffer->writeIndex % BUFFER_CAPACITY];
+    sample.address = frame.eip;
+    sample.processId = thread == nullptr ? 0 : thread->getParent().getId();
+    sample.threadId = thread == nullptr ? 0 : thread->getId();
+    sample.cpuId = cpuId;
+    sample.privilegeLevel = frame.cs & 0x03;
+
+    // Publish the sample, after it has been written completely
+    Util::Async::Atomic<uint32_t>(buffer->writeIndex).inc();
+}
+
+uint32_t SamplingProfiler::readSamples(Sample *target, uint32_t count) {
+    uint32_t copied = 0;
+    readLock.acquire();
+
+    for (uint32_t i = 0; i < 256 && copied < count; i++) {
+        auto *buffer = buffers[i];
+        if (buffer == nullptr) {
+            continue;
+        }
+
+        auto writeIndex = Util::Async::Atomic<uint32_t>(buffer->writeIndex).get();
+        while (buffer->readIndex != writeIndex && copied < count) {
+            target[copied++] = buffer->samples[buffer->readIndex % BUFFER_CAPACITY];
+            Util::Async::Atomic<uint32_t>(buffer->readIndex).inc();
+        }
+    }
+
+    return readLock.releaseAndReturn(copied);
+}
+
+}
@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_SAMPLINGPROFILER_H
+#define HHUOS_SAMPLINGPROFILER_H
+
+#include <cstdint>
+
+#include "lib/util/async/Spinlock.h"
+
+namespace Kernel {
+struct InterruptFrame;
+
+/**
+ * Records the interrupted instruction pointer on timer interrupts, so that user space tools can find out,
+ * where the CPU time goes. Each CPU writes into its own ring buffer, which is drained by reading /device/profile.
+ * The effective sampling frequency is limited by the timer frequency. If the APIC timer runs in one-shot mode,
+ * samples are only taken when the scheduler's deadline expires.
+ */
+class SamplingProfiler {
+
+public:
+
+    struct Sample {
+        uint32_t address;
+        uint32_t processId;
+        uint32_t threadId;
+        uint8_t cpuId;
+        uint8_t privilegeLevel;
+        uint16_t reserved;
+    } __attribute__((packed));
+
+    /**
+     * Default Constructor.
+     */
+    SamplingProfiler() = default;
+
+    /**
+     * Copy Constructor.
+     */
+    SamplingProfiler(const SamplingProfiler &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    SamplingProfiler &operator=(const SamplingProfiler &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~SamplingProfiler() = default;
+
+    /**
+     * Discard all recorded samples and start sampling on all CPUs.
+     *
+     * @param frequency The sampling frequency in Hz
+     */
+    void start(uint32_t frequency);
+
+    void stop();
+
+    [[nodiscard]] bool isRunning() const;
+
+    [[nodiscard]] uint32_t getFrequency() const;
+
+    [[nodiscard]] uint32_t getLostSamples() const;
+
+    /**
+     * Called by the timer interrupt handler of the current CPU.
+     *
+     * @param frame The interrupt frame, holding the interrupted instruction pointer
+     * @param elapsedNanoseconds The time since the last timer interrupt on this CPU
+     */
+    void tick(const InterruptFrame &frame, uint32_t elapsedNanoseconds);
+
+    /**
+     * Remove recorded samples from the CPUs' buffers.
+     *
+     * @return The number of samples, copied into the target buffer
+     */
+    uint32_t readSamples(Sample *target, uint32_t count);
+
+    static const constexpr uint32_t BUFFER_CAPACITY = 4096;
+    static const constexpr uint32_t MAX_FREQUENCY = 10000;
+
+private:
+    /**
+     * Written by the timer interrupt of the owning CPU and read by readSamples().
+     * The indices only ever increase, so that a full buffer can be told apart from an empty one.
+     */
+    struct CpuBuffer {
+        Sample samples[BUFFER_CAPACITY];
+        uint32_t readIndex;
+        uint32_t writeIndex;
+        int32_t remainingNanoseconds;
+    };
+
+    CpuBuffer *buffers[256]{};
+    uint32_t frequency = 0;
+    uint32_t samplingPeriod = 0;
+    uint32_t lostSamples = 0;
+    bool running = false;
+    Util::Async::Spinlock readLock;
+};
+
+}
+
+#endif
@@ -19,89 +19,184 @@
 
 #include "kernel/system/System.h"
 #include "kernel/service/TimeService.h"
+#include "kernel/service/InterruptService.h"
+#include "device/interrupt/apic/Apic.h"
+#include "device/interrupt/apic/LocalApic.h"
+#include "device/time/ApicTimer.h"
 #include "asm_interface.h"
+#include "device/cpu/Cpu.h"
 #include "device/cpu/Fpu.h"
+#include "kernel/log/Trace.h"
+#include "kernel/interrupt/InterruptVector.h"
+#include "kernel/process/IdleThread.h"
 #include "kernel/process/Process.h"
 #include "kernel/process/Thread.h"
+#include "kernel/process/WaitQueue.h"
 #include "kernel/service/MemoryService.h"
+#include "kernel/service/ProcessService.h"
 #include "kernel/service/SchedulerService.h"
+#include "kernel/system/PerCpu.h"
 #include "lib/util/base/Exception.h"
 #include "lib/util/time/Timestamp.h"
 #include "lib/util/collection/Iterator.h"
+#include "lib/util/collection/ArrayList.h"
+#include "lib/util/hardware/CpuId.h"
 
 extern uint32_t scheduler_initialized;
 
 namespace Kernel {
 
 bool Scheduler::fpuAvailable = Device::Fpu::isAvailable();
+bool Scheduler::mwaitAvailable = Util::Hardware::CpuId::isAvailable() && (Util::Hardware::CpuId::getCpuFeatureBits() & Util::Hardware::CpuId::MONITOR) != 0;
+
+Scheduler::Scheduler() {
+    // The run queue of the bootstrap processor is needed before the scheduler is started,
+    // because threads are readied during system initialization.
+    auto *runQueue = new RunQueue();
+    runQueue->cpuData = &CpuLocal::getData();
+    runQueues[getCpuId()] = runQueue;
+}
 
 Scheduler::~Scheduler() {
-    while (!threadQueue.isEmpty()) {
-        delete threadQueue.poll();
+    for (auto *runQueue : runQueues) {
+        if (runQueue == nullptr) {
+            continue;
+        }
+
+        for (auto &readyQueue : runQueue->readyQueues) {
+            while (!readyQueue.isEmpty()) {
+                delete readyQueue.dequeue();
+            }
+        }
+
+        delete runQueue;
     }
 }
 
 void Scheduler::start() {
-    lock.acquire();
-    currentThread = &getNextThread();
-    start_first_thread(currentThread->getContext());
+    auto &idleThread = createIdleThread();
+    Device::Cpu::saveAndDisableInterrupts();
+
+    uint8_t cpuId;
+    auto &runQueue = lockCurrentRunQueue(cpuId);
+    idleThread.cpuId = cpuId;
+    runQueue.idleThread = &idleThread;
+    auto *firstThread = pollReadyThread(runQueue);
+    runQueue.cpuData->currentThread = firstThread == nullptr ? &idleThread : firstThread;
+    runQueue.cpuData->currentThread->state = Thread::RUNNING;
+    runQueue.started = true;
+
+    auto now = getSystemTime();
+    runQueue.oneShotTimer = getOneShotTimer();
+    runQueue.accountingTime = now;
+    runQueue.accountingCycles = Device::Cpu::readTimestampCounter();
+    runQueue.startTime = now;
+    armTimer(runQueue, *runQueue.cpuData->currentThread, now);
+
+    start_first_thread(runQueue.cpuData->currentThread->getContext());
+}
+
+void Scheduler::startApplicationProcessor() {
+    auto &idleThread = createIdleThread();
+    Device::Cpu::saveAndDisableInterrupts();
+
+    auto cpuId = getCpuId();
+    auto *runQueue = new RunQueue();
+    runQueue->cpuData = &CpuLocal::getData();
+    idleThread.cpuId = cpuId;
+    idleThread.state = Thread::RUNNING;
+    runQueue->idleThread = &idleThread;
+    runQueue->cpuData->currentThread = &idleThread;
+    runQueue->started = true;
+    runQueue->oneShotTimer = getOneShotTimer();
+    runQueue->accountingTime = getSystemTime();
+    runQueue->accountingCycles = Device::Cpu::readTimestampCounter();
+    runQueue->startTime = runQueue->accountingTime;
+
+    // Publish the run queue with its lock held, it is released by the first thread.
+    // The idle thread immediately looks for work on the other CPUs' run queues.
+    runQueue->lock.acquire();
+    runQueues[cpuId] = runQueue;
+
+    start_application_processor_thread(idleThread.getContext());
 }
 
 void Scheduler::ready(Thread &thread) {
-    if (currentThread == nullptr) {
-        currentThread = &thread;
+    if (CpuLocal::currentThread.get() == nullptr) {
+        CpuLocal::currentThread.set(&thread);
     }
 
-    if (threadQueue.contains(&thread)) {
+    thread.getParent().addThread(thread);
+    threadTable.put(thread.getId(), thread);
+
+    auto flags = Device::Cpu::saveAndDisableInterrupts();
+    auto cpuId = getLeastLoadedCpu();
+    auto &runQueue = *runQueues[cpuId];
+    runQueue.lock.acquire();
+
+    if (thread.readyQueue != nullptr) {
+        runQueue.lock.release();
+        Device::Cpu::restoreInterrupts(flags);
         Util::Exception::throwException(Util::Exception::INVALID_ARGUMENT, "Scheduler: Thread is already running!");
     }
 
-    lock.acquire();
-    threadQueue.offer(&thread);
-    thread.getParent().addThread(thread);
-    lock.release();
+    thread.cpuId = cpuId;
+    thread.state = Thread::READY;
+    thread.timeSlice = getTimeSlice(thread.priority);
+    runQueue.activeQueue->enqueue(thread);
+    wakeUp(runQueue, cpuId);
+
+    runQueue.lock.release();
+    Device::Cpu::restoreInterrupts(flags);
 }
 
 void Scheduler::exit() {
-    lock.acquire();
-    threadQueue.remove(currentThread);
-    currentThread->getParent().removeThread(*currentThread);
-    lock.release();
-
-    currentThread->unblockJoinList();
-
-    System::getService<SchedulerService>().cleanup(currentThread);
-    yield(true);
+    auto &currentThread = getCurrentThread();
+    threadTable.remove(currentThread.getId());
+    currentThread.getParent().removeThread(currentThread);
+    currentThread.unblockJoinList();
+
+    System::getService<SchedulerService>().cleanup(&currentThread);
+
+    Device::Cpu::saveAndDisableInterrupts();
+    uint8_t cpuId;
+    auto &runQueue = lockCurrentRunQueue(cpuId);
+    currentThread.state = Thread::TERMINATED;
+    reschedule(runQueue, cpuId, false);
 }
 
 void Scheduler::kill(Thread &thread) {
-    if (thread.getId() == currentThread->getId()) {
+    if (thread.getId() == getCurrentThread().getId()) {
         Util::Exception::throwException(Util::Exception::INVALID_ARGUMENT,"Scheduler: A thread cannot kill itself!");
     }
 
-    sleepLock.acquire();
-    sleepList.remove(SleepEntry{&thread, 0});
-    sleepLock.release();
+    auto flags = Device::Cpu::saveAndDisableInterrupts();
+    auto &runQueue = lockRunQueue(thread);
+    auto alreadyTerminated = thread.state == Thread::TERMINATED;
 
-    lock.acquire();
-    threadQueue.remove(&thread);
-    thread.getParent().removeThread(thread);
-    thread.unblockJoinList();
-    lock.release();
+    if (thread.state == Thread::READY && thread.readyQueue != nullptr) {
+        thread.readyQueue->remove(thread);
+    }
 
-    System::getService<SchedulerService>().cleanup(&thread);
-}
+    // Sleeping threads and blocked threads with a timeout
+    runQueue.timeoutQueue.remove(thread);
 
-void Scheduler::killWithoutLock(Thread &thread) {
-    if (thread.getId() == currentThread->getId()) {
-        Util::Exception::throwException(Util::Exception::INVALID_ARGUMENT,"Scheduler: A thread cannot kill itself!");
+    // A thread, that is currently running on another CPU, is not put back into its run queue at the next reschedule
+    thread.state = Thread::TERMINATED;
+    runQueue.lock.release();
+    Device::Cpu::restoreInterrupts(flags);
+
+    if (alreadyTerminated) {
+        return;
     }
 
-    sleepLock.acquire();
-    sleepList.remove(SleepEntry{&thread, 0});
-    sleepLock.release();
+    // A blocked thread may still be parked on a wait queue, which would unblock it after it has been freed
+    auto *waitQueue = thread.waitQueue;
+    if (waitQueue != nullptr) {
+        waitQueue->remove(thread);
+    }
 
-    threadQueue.remove(&thread);
+    threadTable.remove(thread.getId());
     thread.getParent().removeThread(thread);
     thread.unblockJoinList();
 
@@ -109,40 +204,239 @@ void Scheduler::killWithoutLock(Thread &thread) {
 }
 
 Thread& Scheduler::getCurrentThread() {
-    return *currentThread;
+    // A thread may be migrated at any time, but it is always the current thread of the CPU it is running on
+    return *CpuLocal::currentThread.get();
 }
 
-Thread& Scheduler::getNextThread() {
-    Thread *thread = threadQueue.poll();
-    threadQueue.offer(thread);
+void Scheduler::yield(bool force) {
+    if (!scheduler_initialized) {
+        return;
+    }
+
+    auto flags = Device::Cpu::saveAndDisableInterrupts();
+    auto cpuId = getCpuId();
+    auto *runQueue = runQueues[cpuId];
+    if (runQueue == nullptr || !runQueue->started) {
+        // This CPU does not participate in scheduling (yet)
+        Device::Cpu::restoreInterrupts(flags);
+        return;
+    }
 
-    return *thread;
+    if (force) {
+        runQueue->lock.acquire();
+    } else if (!runQueue->lock.tryAcquire()) {
+        Device::Cpu::restoreInterrupts(flags);
+        return;
+    }
+
+    reschedule(*runQueue, cpuId, true);
+    Device::Cpu::restoreInterrupts(flags);
 }
 
-void Scheduler::yield(bool force) {
+void Scheduler::idle() {
+    auto flags = Device::Cpu::saveAndDisableInterrupts();
+    auto &runQueue = getCurrentRunQueue();
+    if (mwaitAvailable) {
+        runQueue.wakeupRequested = 0;
+        Device::Cpu::monitor(&runQueue.wakeupRequested);
+    }
+
+    // Checking without the lock is sufficient: Other CPUs call wakeUp() after adding a thread to this run queue,
+    // which either writes to the monitored address or raises an interrupt, that stays pending until the halt.
+    if (runQueue.getReadyCount() > 0 || runQueue.wakeupRequested != 0) {
+        Device::Cpu::restoreInterrupts(flags);
+        return;
+    }
+
+    if (mwaitAvailable) {
+        Device::Cpu::enableInterruptsAndWait();
+    } else {
+        Device::Cpu::enableInterruptsAndHalt();
+    }
+}
+
+void Scheduler::tick() {
     if (!scheduler_initialized) {
         return;
     }
 
-    if (force) {
-        lock.acquire();
-    } else if (!lock.tryAcquire()) {
+    auto flags = Device::Cpu::saveAndDisableInterrupts();
+    auto cpuId = getCpuId();
+    auto *runQueue = runQueues[cpuId];
+    if (runQueue == nullptr || !runQueue->started) {
+        Device::Cpu::restoreInterrupts(flags);
+        return;
+    }
+
+    // Run queue locks are only held with interrupts disabled, so the lock cannot be held by the interrupted thread.
+    // Waiting for it is necessary in tickless mode, because the timer would not be armed again otherwise.
+    runQueue->lock.acquire();
+
+    auto now = getSystemTime();
+    checkTimeouts(*runQueue, now);
+    account(*runQueue, now);
+
+    auto &currentThread = *runQueue->cpuData->currentThread;
+    auto expired = false;
+    auto preempt = false;
+
+    if (&currentThread == runQueue->idleThread) {
+        preempt = runQueue->getReadyCount() > 0;
+    } else {
+        expired = currentThread.timeSlice == 0;
+        preempt = runQueue->activeQueue->getHighestPriority() > currentThread.priority;
+    }
+
+    if (expired || preempt) {
+        reschedule(*runQueue, cpuId, expired, true);
+    } else {
+        armTimer(*runQueue, currentThread, now);
+        runQueue->lock.release();
+    }
+
+    Device::Cpu::restoreInterrupts(flags);
+}
+
+void Scheduler::setPriority(Thread &thread, uint8_t priority) {
+    if (priority >= Thread::PRIORITY_LEVELS) {
+        Util::Exception::throwException(Util::Exception::INVALID_ARGUMENT, "Scheduler: Invalid priority!");
+    }
+
+    auto flags = Device::Cpu::saveAndDisableInterrupts();
+    auto &runQueue = lockRunQueue(thread);
+
+    auto *readyQueue = thread.readyQueue;
+    if (readyQueue != nullptr) {
+        readyQueue->remove(thread);
+    }
+
+    thread.priority = priority;
+    if (readyQueue != nullptr) {
+        readyQueue->enqueue(thread);
+    }
+
+    runQueue.lock.release();
+    Device::Cpu::restoreInterrupts(flags);
+}
+
+void Scheduler::reschedule(RunQueue &runQueue, uint8_t cpuId, bool expire, bool preempt) {
+    auto now = getSystemTime();
+    checkTimeouts(runQueue, now);
+    account(runQueue, now);
+
+    auto &currentThread = *runQueue.cpuData->currentThread;
+    auto isIdle = &currentThread == runQueue.idleThread;
+    if (expire && !isIdle) {
+        currentThread.timeSlice = getTimeSlice(currentThread.priority);
+    }
+
+    auto *nextThread = pollReadyThread(runQueue);
+    if (nextThread == nullptr) {
+        nextThread = stealThread(cpuId);
+    }
+
+    if (nextThread == nullptr) {
+        if (currentThread.state == Thread::RUNNING) {
+            // No other thread is runnable -> Continue with the current one
+            armTimer(runQueue, currentThread, now);
+            runQueue.lock.release();
+            return;
+        }
+
+        nextThread = runQueue.idleThread;
+    }
+
+    if (preempt) {
+        currentThread.statistics.involuntaryContextSwitches++;
+    } else {
+        currentThread.statistics.voluntaryContextSwitches++;
+    }
+
+    if (currentThread.state == Thread::RUNNING) {
+        currentThread.state = Thread::READY;
+        if (!isIdle) {
+            (expire ? runQueue.expiredQueue : runQueue.activeQueue)->enqueue(currentThread);
+        }
+    }
+
+    nextThread->state = Thread::RUNNING;
+    armTimer(runQueue, *nextThread, now);
+    CpuLocal::memoryService.get()->switchAddressSpace(nextThread->getParent().getAddressSpace());
+    dispatch(runQueue, *nextThread);
+}
+
+Thread* Scheduler::stealThread(uint8_t cpuId) {
+    auto &schedulerService = *CpuLocal::schedulerService.get();
+
+    for (uint32_t i = 0; i < sizeof(runQueues) / sizeof(RunQueue*); i++) {
+        auto *victim = runQueues[i];
+        if (i == cpuId || victim == nullptr || !victim->started || victim->getReadyCount() == 0) {
+            continue;
+        }
+
+        // Never wait for another CPU's lock, while holding our own (the other CPU may try to steal from us)
+        if (!victim->lock.tryAcquire()) {
+            continue;
+        }
+
+        // The FPU state of a thread may still be loaded in the other CPU's registers (lazy switching)
+        auto isMigratable = [&schedulerService, i](const Thread &thread) {
+            return !schedulerService.isFpuContextLoaded(thread, i);
+        };
+
+        auto *stolenThread = victim->activeQueue->find(isMigratable);
+        if (stolenThread == nullptr) {
+            stolenThread = victim->expiredQueue->find(isMigratable);
+        }
+
+        if (stolenThread != nullptr) {
+            stolenThread->readyQueue->remove(*stolenThread);
+            stolenThread->cpuId = cpuId;
+        }
+
+        victim->lock.release();
+
+        if (stolenThread != nullptr) {
+            return stolenThread;
+        }
+    }
+
+    return nullptr;
+}
+
+void Scheduler::wakeUp(RunQueue &runQueue, uint8_t cpuId) {
+    if (!runQueue.started || cpuId == getCpuId() || runQueue.cpuData->currentThread != runQueue.idleThread) {
         return;
     }
 
-    do {
-        checkSleepList();
-    } while (threadQueue.isEmpty());
+    if (mwaitAvailable) {
+        // Writing to the monitored address ends mwait
+        runQueue.wakeupRequested = 1;
+    } else {
+        Device::LocalApic::sendInterProcessorInterrupt(cpuId, InterruptVector::WAKEUP);
+    }
+}
 
-    Thread &nextThread = getNextThread();
+void Scheduler::wakeUpIdleCpu(uint8_t busyCpuId) {
+    for (uint32_t i = 0; i < sizeof(runQueues) / sizeof(RunQueue*); i++) {
+        auto *runQueue = runQueues[i];
+        if (i == busyCpuId || runQueue == nullptr || !runQueue->started) {
+            continue;
+        }
 
-    System::getService<Kernel::MemoryService>().switchAddressSpace(nextThread.getParent().getAddressSpace());
-    dispatch(nextThread);
+        // Without holding the other CPU's lock, this is only a hint -> At worst, the woken up CPU finds nothing to steal
+        if (runQueue->cpuData->currentThread == runQueue->idleThread) {
+            wakeUp(*runQueue, i);
+            return;
+        }
+    }
 }
 
-void Scheduler::dispatch(Thread &nextThread) {
-    auto &oldThread = *currentThread;
-    currentThread = &nextThread;
+void Scheduler::dispatch(RunQueue &runQueue, Thread &nextThread) {
+    auto &oldThread = *runQueue.cpuData->currentThread;
+    runQueue.cpuData->currentThread = &nextThread;
+    runQueue.cpuData->contextSwitches++;
+    Trace::tracepoint(Trace::THREAD_SWITCH, oldThread.getId(), nextThread.getId());
     if (fpuAvailable) {
         Device::Fpu::armFpuMonitor();
     }
@@ -151,74 +445,305 @@ void Scheduler::dispatch(Thread &nextThread) {
 }
 
 uint32_t Scheduler::getThreadCount() const {
-    return threadQueue.size();
+    return threadTable.size();
+}
+
+Util::Array<Scheduler::CpuTime> Scheduler::getCpuTimes() {
+    auto cpuTimes = Util::ArrayList<CpuTime>();
+    auto now = getSystemTime();
+
+    for (uint32_t i = 0; i < sizeof(runQueues) / sizeof(RunQueue*); i++) {
+        auto *runQueue = runQueues[i];
+        if (runQueue == nullptr || !runQueue->started) {
+            continue;
+        }
+
+        auto flags = Device::Cpu::saveAndDisableInterrupts();
+        runQueue->lock.acquire();
+
+        // Time since the last accounting has not been charged yet (e.g. while the CPU is halted)
+        auto idleTime = runQueue->idleTime;
+        if (runQueue->cpuData->currentThread == runQueue->idleThread && now > runQueue->accountingTime) {
+            idleTime += now - runQueue->accountingTime;
+        }
+
+        auto totalTime = now > runQueue->startTime ? now - runQueue->startTime : 0;
+        runQueue->lock.release();
+        Device::Cpu::restoreInterrupts(flags);
+
+        cpuTimes.add(CpuTime{static_cast<uint8_t>(i), idleTime, totalTime > idleTime ? totalTime - idleTime : 0});
+    }
+
+    return cpuTimes.toArray();
 }
 
 void Scheduler::block() {
-    lock.acquire();
-    threadQueue.remove(currentThread);
-    lock.release();
+    blockCurrentThread(0);
+}
 
-    yield(true);
+bool Scheduler::block(const Util::Time::Timestamp &timeout) {
+    auto microseconds = toMicroseconds(timeout);
+    return blockCurrentThread(microseconds > 0 ? microseconds : 1);
+}
+
+bool Scheduler::blockCurrentThread(uint64_t timeout) {
+    auto wakeupTime = timeout > 0 ? getSystemTime() + timeout : 0;
+
+    auto flags = Device::Cpu::saveAndDisableInterrupts();
+    uint8_t cpuId;
+    auto &runQueue = lockCurrentRunQueue(cpuId);
+    auto &currentThread = *runQueue.cpuData->currentThread;
+
+    if (currentThread.wakeupPending) {
+        // The thread has already been unblocked, before it was able to block itself
+        currentThread.wakeupPending = false;
+        runQueue.lock.release();
+        Device::Cpu::restoreInterrupts(flags);
+        return true;
+    }
+
+    currentThread.timedOut = false;
+    if (currentThread.state == Thread::RUNNING) {
+        currentThread.state = Thread::BLOCKED;
+        if (timeout > 0) {
+            runQueue.timeoutQueue.add(currentThread, wakeupTime);
+        }
+    }
+
+    reschedule(runQueue, cpuId, false);
+    Device::Cpu::restoreInterrupts(flags);
+
+    // Only written by the CPU, that held the run queue's lock when waking this thread up
+    return !currentThread.timedOut;
 }
 
 void Scheduler::unblock(Thread &thread) {
-    lock.acquire();
-    threadQueue.offer(&thread);
-    lock.release();
+    auto flags = Device::Cpu::saveAndDisableInterrupts();
+    auto &runQueue = lockRunQueue(thread);
+
+    if (thread.state == Thread::BLOCKED) {
+        // A thread, that has been waiting, keeps the rest of its time slice and is put into the active array
+        runQueue.timeoutQueue.remove(thread);
+        thread.state = Thread::READY;
+        runQueue.activeQueue->enqueue(thread);
+
+        if (runQueue.cpuData->currentThread == runQueue.idleThread) {
+            wakeUp(runQueue, thread.cpuId);
+        } else {
+            wakeUpIdleCpu(thread.cpuId);
+        }
+    } else if (thread.state != Thread::TERMINATED) {
+        thread.wakeupPending = true;
+    }
+
+    runQueue.lock.release();
+    Device::Cpu::restoreInterrupts(flags);
 }
 
 void Scheduler::sleep(const Util::Time::Timestamp &time) {
-    auto systemTime = System::getService<TimeService>().getSystemTime().toMilliseconds();
+    auto wakeupTime = getSystemTime() + toMicroseconds(time);
 
-    sleepLock.acquire();
-    sleepList.add(SleepEntry{currentThread, systemTime + time.toMilliseconds()});
-    sleepLock.release();
+    auto flags = Device::Cpu::saveAndDisableInterrupts();
+    uint8_t cpuId;
+    auto &runQueue = lockCurrentRunQueue(cpuId);
+    auto &currentThread = *runQueue.cpuData->currentThread;
 
-    block();
+    if (currentThread.state == Thread::RUNNING) {
+        currentThread.state = Thread::SLEEPING;
+        runQueue.timeoutQueue.add(currentThread, wakeupTime);
+    }
+
+    reschedule(runQueue, cpuId, false);
+    Device::Cpu::restoreInterrupts(flags);
 }
 
-void Scheduler::checkSleepList() {
-    if (sleepLock.tryAcquire()) {
-        auto systemTime = System::getService<TimeService>().getSystemTime().toMilliseconds();
-        for (uint32_t i = 0; i < sleepList.size(); i++) {
-            const auto &entry = sleepList.get(i);
-            if (systemTime >= entry.wakeupTime) {
-                threadQueue.offer(entry.thread);
-                sleepList.remove(entry);
-            }
+void Scheduler::checkTimeouts(RunQueue &runQueue, uint64_t systemTime) {
+    Thread *thread;
+    while ((thread = runQueue.timeoutQueue.pollExpired(systemTime)) != nullptr) {
+        if (thread->state == Thread::BLOCKED) {
+            thread->timedOut = true;
         }
-        sleepLock.release();
+
+        thread->state = Thread::READY;
+        runQueue.activeQueue->enqueue(*thread);
     }
 }
 
-Thread* Scheduler::getThread(uint32_t id) {
-    lock.acquire();
-    sleepLock.acquire();
+Thread* Scheduler::acquireThread(uint32_t id) {
+    return threadTable.acquire(id);
+}
+
+bool Scheduler::isRunning(const Thread &thread) {
+    auto flags = Device::Cpu::saveAndDisableInterrupts();
+    auto running = false;
 
-    for (auto *thread : threadQueue) {
-        if (thread->getId() == id) {
-            sleepLock.release();
-            lock.release();
-            return thread;
+    for (auto *runQueue : runQueues) {
+        if (runQueue == nullptr) {
+            continue;
+        }
+
+        // The current thread pointer is updated before the switch, but the lock is held until the old context is saved
+        runQueue->lock.acquire();
+        running = runQueue->cpuData->currentThread == &thread;
+        runQueue->lock.release();
+
+        if (running) {
+            break;
         }
     }
 
-    for (auto &sleepEntry : sleepList) {
-        if (sleepEntry.thread->getId() == id) {
-            sleepLock.release();
-            lock.release();
-            return sleepEntry.thread;
+    Device::Cpu::restoreInterrupts(flags);
+    return running;
+}
+
+Scheduler::RunQueue& Scheduler::lockCurrentRunQueue(uint8_t &cpuId) {
+    // Interrupts are disabled by the caller, so the calling thread cannot be migrated in between
+    cpuId = getCpuId();
+    auto &runQueue = *runQueues[cpuId];
+    runQueue.lock.acquire();
+
+    return runQueue;
+}
+
+Scheduler::RunQueue& Scheduler::lockRunQueue(Thread &thread) {
+    while (true) {
+        auto cpuId = thread.cpuId;
+        auto &runQueue = *runQueues[cpuId];
+        runQueue.lock.acquire();
+
+        // The thread may have been migrated by another CPU, while we were waiting for the lock
+        if (thread.cpuId == cpuId) {
+            return runQueue;
         }
+
+        runQueue.lock.release();
     }
+}
 
-    sleepLock.release();
-    lock.release();
-    return nullptr;
+Scheduler::RunQueue& Scheduler::getCurrentRunQueue() {
+    return *runQueues[getCpuId()];
+}
+
+uint8_t Scheduler::getLeastLoadedCpu() {
+    uint8_t cpuId = getCpuId();
+    uint32_t minimumLoad = UINT32_MAX;
+
+    for (uint32_t i = 0; i < sizeof(runQueues) / sizeof(RunQueue*); i++) {
+        const auto *runQueue = runQueues[i];
+        if (runQueue == nullptr) {
+            continue;
+        }
+
+        auto load = runQueue->getReadyCount();
+        const auto *currentThread = runQueue->cpuData->currentThread;
+        if (currentThread != nullptr && currentThread != runQueue->idleThread) {
+            load++;
+        }
+
+        if (load < minimumLoad) {
+            minimumLoad = load;
+            cpuId = i;
+        }
+    }
+
+    return cpuId;
+}
+
+Thread& Scheduler::createIdleThread() {
+    auto &kernelProcess = System::getService<ProcessService>().getKernelProcess();
+    return Thread::createKernelThread("Idle", kernelProcess, new IdleThread());
+}
+
+uint32_t Scheduler::getTimeSlice(uint8_t priority) {
+    return (MINIMUM_TIME_SLICE + priority * TIME_SLICE_PER_PRIORITY) * 1000;
+}
+
+void Scheduler::account(RunQueue &runQueue, uint64_t now) {
+    auto elapsedTime = now - runQueue.accountingTime;
+    runQueue.accountingTime = now;
+
+    auto cycles = Device::Cpu::readTimestampCounter();
+    auto &currentThread = *runQueue.cpuData->currentThread;
+    currentThread.statistics.cpuCycles += cycles - runQueue.accountingCycles;
+    runQueue.accountingCycles = cycles;
+
+    if (&currentThread == runQueue.idleThread) {
+        runQueue.idleTime += elapsedTime;
+    } else {
+        currentThread.timeSlice = currentThread.timeSlice > elapsedTime ? currentThread.timeSlice - elapsedTime : 0;
+    }
+}
+
+void Scheduler::armTimer(RunQueue &runQueue, const Thread &nextThread, uint64_t now) {
+    if (runQueue.oneShotTimer == nullptr) {
+        return;
+    }
+
+    // Without the PIT, the time page is published here, so it is never older than one tick, while a user thread is running
+    auto &timeService = *CpuLocal::timeService.get();
+    if (&nextThread != runQueue.idleThread && !timeService.hasPeriodicTimePageUpdates()) {
+        timeService.updateTimePage(MAXIMUM_TICK_INTERVAL * 1000);
+    }
+
+    auto deadline = runQueue.timeoutQueue.getEarliestWakeupTime();
+    if (&nextThread != runQueue.idleThread) {
+        // Other CPUs may make threads with a higher priority ready on this CPU at any time
+        auto interval = nextThread.timeSlice < MAXIMUM_TICK_INTERVAL ? nextThread.timeSlice : MAXIMUM_TICK_INTERVAL;
+        if (now + interval < deadline) {
+            deadline = now + interval;
+        }
+    }
+
+    if (deadline == runQueue.timerDeadline) {
+        // Avoid reprogramming the local APIC (expensive in virtual machines), e.g. while the idle thread is yielding
+        return;
+    }
+
+    runQueue.timerDeadline = deadline;
+    if (deadline == UINT64_MAX) {
+        // Nothing to do for this CPU, until another CPU gives it work
+        runQueue.oneShotTimer->stop();
+        return;
+    }
+
+    auto delay = deadline > now ? deadline - now : 0;
+    runQueue.oneShotTimer->setDeadline(delay > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(delay));
+}
+
+Device::ApicTimer* Scheduler::getOneShotTimer() {
+    auto &interruptService = System::getService<InterruptService>();
+    if (!interruptService.usesApic() || !interruptService.getApic().isCurrentTimerRunning()) {
+        return nullptr;
+    }
+
+    auto &timer = interruptService.getApic().getCurrentTimer();
+    return timer.isOneShot() ? &timer : nullptr;
+}
+
+uint64_t Scheduler::getSystemTime() {
+    return toMicroseconds(CpuLocal::timeService.get()->getSystemTime());
+}
+
+uint64_t Scheduler::toMicroseconds(const Util::Time::Timestamp &time) {
+    return static_cast<uint64_t>(time.toSeconds()) * 1000000 + time.getFraction() / 1000;
+}
+
+Thread* Scheduler::pollReadyThread(RunQueue &runQueue) {
+    if (runQueue.activeQueue->isEmpty()) {
+        auto *swap = runQueue.activeQueue;
+        runQueue.activeQueue = runQueue.expiredQueue;
+        runQueue.expiredQueue = swap;
+    }
+
+    return runQueue.activeQueue->dequeue();
+}
+
+uint32_t Scheduler::RunQueue::getReadyCount() const {
+    return readyQueues[0].size() + readyQueues[1].size();
 }
 
-bool Scheduler::SleepEntry::operator!=(const Scheduler::SleepEntry &other) const {
-    return thread->getId() != other.thread->getId();
+uint8_t Scheduler::getCpuId() {
+    return CpuLocal::cpuId.get();
 }
 
 }
@@ -20,11 +20,16 @@
 
 #include <cstdint>
 
-#include "lib/util/collection/ArrayListBlockingQueue.h"
 #include "lib/util/async/Spinlock.h"
-#include "lib/util/collection/ArrayList.h"
+#include "lib/util/collection/Array.h"
 #include "kernel/process/Thread.h"
+#include "kernel/process/ReadyQueue.h"
+#include "kernel/process/TimeoutQueue.h"
+#include "kernel/process/IdTable.h"
 
+namespace Device {
+class ApicTimer;
+}  // namespace Device
 namespace Util {
 namespace Time {
 class Timestamp;
@@ -32,16 +37,34 @@ class Timestamp;
 }  // namespace Util
 
 namespace Kernel {
+struct PerCpuData;
 
 class Scheduler {
 
     friend class SchedulerService;
 
 public:
+    /**
+     * Time, that a CPU has spent in its idle thread and in other threads, since it has started scheduling.
+     */
+    struct CpuTime {
+        uint8_t cpuId;
+        uint64_t idleTime; // Microseconds
+        uint64_t busyTime; // Microseconds
+
+        bool operator==(const CpuTime &other) const {
+            return cpuId == other.cpuId;
+        }
+
+        bool operator!=(const CpuTime &other) const {
+            return cpuId != other.cpuId;
+        }
+    };
+
     /**
      * Constructor.
      */
-    explicit Scheduler() = default;
+    Scheduler();
 
     /**
      * Copy Constructor.
@@ -58,8 +81,17 @@ public:
      */
     ~Scheduler();
 
+    /**
+     * Start scheduling on the bootstrap processor.
+     */
     void start();
 
+    /**
+     * Start scheduling on the calling application processor.
+     * A dedicated run queue and idle thread are created for it.
+     */
+    [[noreturn]] void startApplicationProcessor();
+
     /**
      * Registers a new Thread.
      *
@@ -72,8 +104,31 @@ public:
      */
     void exit();
 
+    /**
+     * Give up the CPU voluntarily. The calling thread's time slice is treated as used up,
+     * so it only runs again after all other ready threads of its CPU have received their time slices.
+     */
     void yield(bool force = false);
 
+    /**
+     * Halt the calling CPU until the next interrupt, if its run queue is empty (called by the idle thread).
+     * If the CPU supports it, mwait is used instead of hlt, so that other CPUs can end the halt without an interprocessor interrupt.
+     * Must be called with interrupts enabled.
+     */
+    void idle();
+
+    /**
+     * Account the elapsed time to the current thread of the calling CPU (called by the timer interrupt).
+     * The thread is preempted, if its time slice is used up, or if a thread with a higher priority has become ready.
+     * In tickless mode, the CPU's timer is armed again for the next deadline.
+     */
+    void tick();
+
+    /**
+     * Change the priority of a thread. A ready thread is moved to the new priority level immediately.
+     */
+    void setPriority(Thread &thread, uint8_t priority);
+
     /**
      * Kills a specific Thread.
      *
@@ -81,10 +136,15 @@ public:
      */
     void kill(Thread &thread);
 
-    void killWithoutLock(Thread &thread);
-
     void block();
 
+    /**
+     * Block the current thread, until it is unblocked or the timeout has passed.
+     *
+     * @return true, if the thread has been unblocked, false if the timeout has passed
+     */
+    bool block(const Util::Time::Timestamp &timeout);
+
     void unblock(Thread &thread);
 
     void sleep(const Util::Time::Timestamp &time);
@@ -96,39 +156,155 @@ public:
      */
     Thread& getCurrentThread();
 
-    Thread& getNextThread();
+    /**
+     * Look up a thread, regardless of whether it is running, ready, sleeping or blocked, and take a reference on it.
+     * The thread is not freed, until the caller calls removeReference(), even if it terminates in the meantime.
+     *
+     * @return The thread, or nullptr if no thread with the given id has been started or it has already terminated
+     */
+    Thread* acquireThread(uint32_t id);
 
-    Thread * getThread(uint32_t id);
+    /**
+     * Check if a thread is currently executed by any CPU.
+     * Threads must not be deleted, before this returns false.
+     */
+    bool isRunning(const Thread &thread);
 
     [[nodiscard]] uint32_t getThreadCount() const;
 
+    [[nodiscard]] Util::Array<CpuTime> getCpuTimes();
+
 private:
+
+    /**
+     * Ready threads are kept in two priority arrays. Threads, that have used up their time slice, are moved to the
+     * expired array and the arrays are swapped, once the active one is empty. This way, high priority threads are
+     * preferred, without starving lower priority ones.
+     */
+    struct RunQueue {
+        Util::Async::Spinlock lock = Util::Async::Spinlock("run-queue");
+        ReadyQueue readyQueues[2];
+        ReadyQueue *activeQueue = &readyQueues[0];
+        ReadyQueue *expiredQueue = &readyQueues[1];
+        TimeoutQueue timeoutQueue;
+        PerCpuData *cpuData = nullptr; // Holds the current thread of the run queue's CPU
+        Thread *idleThread = nullptr;
+        bool started = false;
+
+        uint64_t accountingTime = 0; // System time in microseconds, up to which the current thread's time slice has been charged
+        uint64_t accountingCycles = 0; // Time stamp counter value, up to which the current thread's CPU time has been charged
+        uint64_t startTime = 0; // System time in microseconds, at which the CPU has started scheduling
+        uint64_t idleTime = 0; // Microseconds, the idle thread has been running for (including halted time)
+        volatile uint32_t wakeupRequested = 0; // Monitored by the idle thread, while it is waiting with mwait
+        Device::ApicTimer *oneShotTimer = nullptr; // Only set in tickless mode
+        uint64_t timerDeadline = UINT64_MAX;
+
+        [[nodiscard]] uint32_t getReadyCount() const;
+    };
+
+    /**
+     * Acquire the lock of the run queue belonging to the CPU, that executes the calling thread.
+     * Afterwards, the calling thread cannot be migrated until the lock is released.
+     */
+    RunQueue& lockCurrentRunQueue(uint8_t &cpuId);
+
+    /**
+     * Acquire the lock of the run queue, that a thread is currently assigned to.
+     * Run queue locks may also be taken by interrupt handlers (e.g. to unblock a thread), so callers must clear
+     * the interrupt flag with Device::Cpu::saveAndDisableInterrupts() first. Since threads are switched with the lock held,
+     * the flags are saved on the stack of each thread, instead of using the nesting counter in Device::Cpu.
+     */
+    RunQueue& lockRunQueue(Thread &thread);
+
+    RunQueue& getCurrentRunQueue();
+
+    uint8_t getLeastLoadedCpu();
+
+    /**
+     * Switch to the next runnable thread. Must be called with the run queue's lock held.
+     * The lock is released after the switch, or before returning, if no switch is necessary.
+     *
+     * @param expire Move the current thread to the expired array and refill its time slice
+     * @param preempt The current thread is switched out by the timer and did not give up the CPU on its own
+     */
+    void reschedule(RunQueue &runQueue, uint8_t cpuId, bool expire, bool preempt = false);
+
+    /**
+     * Take the next thread from the active array, swapping the arrays if it is empty.
+     */
+    static Thread* pollReadyThread(RunQueue &runQueue);
+
+    /**
+     * Take a ready thread from another CPU's run queue and migrate it to the given CPU.
+     *
+     * @return The stolen thread, or nullptr if no other CPU has a thread to spare
+     */
+    Thread* stealThread(uint8_t cpuId);
+
+    /**
+     * End the halt of a CPU, if it is idle and a thread has been added to its run queue by another CPU.
+     * A CPU notices threads, that have been readied by its own interrupt handlers, as soon as the halt ends.
+     */
+    void wakeUp(RunQueue &runQueue, uint8_t cpuId);
+
+    /**
+     * Wake up any idle CPU except the given one, so that it steals a ready thread from a busy CPU.
+     */
+    void wakeUpIdleCpu(uint8_t busyCpuId);
+
     /**
      * Switches to the given Thread.
      *
      * @param nextThread A Thread
      */
-    void dispatch(Thread &nextThread);
+    void dispatch(RunQueue &runQueue, Thread &nextThread);
 
-    void checkSleepList();
+    /**
+     * Move all threads, whose wakeup time has been reached, from the timeout queue to the active array.
+     */
+    static void checkTimeouts(RunQueue &runQueue, uint64_t systemTime);
 
-private:
+    /**
+     * @param timeout The timeout in microseconds (0 means no timeout)
+     */
+    bool blockCurrentThread(uint64_t timeout);
 
-    struct SleepEntry {
-        Thread *thread;
-        uint32_t wakeupTime;
+    /**
+     * Charge the time since the last call to the current thread's time slice and CPU time statistics.
+     */
+    static void account(RunQueue &runQueue, uint64_t now);
 
-        bool operator!=(const SleepEntry &other) const;
-    };
+    /**
+     * Program the one-shot timer of a tickless CPU for the next event:
+     * The end of the next thread's time slice or the earliest wakeup time in the timeout queue.
+     * The timer is stopped, if the CPU is going to be idle without any pending timeouts.
+     */
+    static void armTimer(RunQueue &runQueue, const Thread &nextThread, uint64_t now);
+
+    static Device::ApicTimer* getOneShotTimer();
+
+    /**
+     * @return The system time in microseconds
+     */
+    static uint64_t getSystemTime();
 
-    Util::Async::Spinlock lock;
-    Util::Async::Spinlock sleepLock;
+    static uint64_t toMicroseconds(const Util::Time::Timestamp &time);
 
-    Util::ArrayListBlockingQueue<Thread*> threadQueue;
-    Util::ArrayList<SleepEntry> sleepList;
-    Thread *currentThread = nullptr;
+    Thread& createIdleThread();
+
+    static uint32_t getTimeSlice(uint8_t priority);
+
+    static uint8_t getCpuId();
+
+    RunQueue *runQueues[256]{}; // Indexed by local APIC id
+    IdTable<Thread> threadTable; // All started threads, that have not terminated yet (idle threads excluded)
 
     static bool fpuAvailable;
+    static bool mwaitAvailable;
+
+    static const constexpr uint32_t MINIMUM_TIME_SLICE = 10; // Milliseconds
+    static const constexpr uint32_t TIME_SLICE_PER_PRIORITY = 5;
+    static const constexpr uint32_t MAXIMUM_TICK_INTERVAL = 10000; // Microseconds, only used in tickless mode
 };
 
 }
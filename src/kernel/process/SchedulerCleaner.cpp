@@ -20,6 +20,8 @@
 #include "lib/util/async/Thread.h"
 #include "kernel/process/Process.h"
 #include "kernel/process/Thread.h"
+#include "kernel/service/SchedulerService.h"
+#include "kernel/system/System.h"
 #include "lib/util/base/Exception.h"
 #include "lib/util/time/Timestamp.h"
 
@@ -32,13 +34,23 @@ SchedulerCleaner::~SchedulerCleaner() {
 }
 
 void SchedulerCleaner::cleanup(Process *process) {
-    if (!processQueue.offer(process)) {
+    lock.acquire();
+    auto success = processQueue.offer(process);
+    lock.release();
+    waitQueue.notify();
+
+    if (!success) {
         Util::Exception::throwException(Util::Exception::OUT_OF_BOUNDS, "Too many processes to cleanup!");
     }
 }
 
 void SchedulerCleaner::cleanup(Thread *thread) {
-    if (!threadQueue.offer(thread)) {
+    lock.acquire();
+    auto success = threadQueue.offer(thread);
+    lock.release();
+    waitQueue.notify();
+
+    if (!success) {
         Util::Exception::throwException(Util::Exception::OUT_OF_BOUNDS, "Too many threads to cleanup!");
     }
 }
@@ -47,20 +59,56 @@ void SchedulerCleaner::run() {
     while (true) {
         cleanupThreads();
         cleanupProcesses();
-        Util::Async::Thread::sleep(Util::Time::Timestamp(1, 0));
+
+        // Clean up promptly, so that the resources of short-lived threads can be recycled
+        lock.acquire();
+        if (threadQueue.isEmpty() && processQueue.isEmpty()) {
+            waitQueue.wait(lock);
+        } else {
+            // Some threads are still running on another CPU -> Retry later
+            waitQueue.wait(lock, Util::Time::Timestamp::ofMilliseconds(RETRY_INTERVAL));
+        }
+        lock.release();
     }
 }
 
 void SchedulerCleaner::cleanupProcesses() {
-    while (processQueue.size() > 0) {
-        delete processQueue.poll();
+    lock.acquire();
+    for (uint32_t count = processQueue.size(); count > 0; count--) {
+        auto *process = processQueue.poll();
+        if (process->isReferenced()) {
+            // Another thread has looked up the process (e.g. to join it) and is still using it
+            processQueue.offer(process);
+            continue;
+        }
+
+        lock.release();
+        delete process;
+        lock.acquire();
     }
+
+    lock.release();
 }
 
 void SchedulerCleaner::cleanupThreads() {
-    while (threadQueue.size() > 0) {
-        delete threadQueue.poll();
+    auto &schedulerService = System::getService<SchedulerService>();
+
+    lock.acquire();
+    for (uint32_t count = threadQueue.size(); count > 0; count--) {
+        auto *thread = threadQueue.poll();
+        if (schedulerService.isRunning(*thread) || thread->isReferenced()) {
+            // A terminated thread may still be running on another CPU, until its next reschedule,
+            // or be used by another thread, that has looked it up (e.g. to join it)
+            threadQueue.offer(thread);
+            continue;
+        }
+
+        lock.release();
+        delete thread;
+        lock.acquire();
     }
+
+    lock.release();
 }
 
 }
\ No newline at end of file
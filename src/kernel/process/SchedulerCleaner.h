@@ -18,10 +18,12 @@
 #ifndef HHUOS_SCHEDULERCLEANER_H
 #define HHUOS_SCHEDULERCLEANER_H
 
+#include "lib/util/async/Spinlock.h"
 #include "lib/util/collection/ArrayBlockingQueue.h"
 #include "lib/util/async/Runnable.h"
 #include "kernel/process/Process.h"
 #include "kernel/process/Thread.h"
+#include "kernel/process/WaitQueue.h"
 
 namespace Kernel {
 
@@ -60,8 +62,12 @@ private:
 
     void cleanupThreads();
 
+    Util::Async::Spinlock lock;
     Util::ArrayBlockingQueue<Process*> processQueue;
     Util::ArrayBlockingQueue<Thread*> threadQueue;
+    WaitQueue waitQueue;
+
+    static const constexpr uint32_t RETRY_INTERVAL = 10;
 };
 
 }
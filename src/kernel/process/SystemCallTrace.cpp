@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "SystemCallTrace.h"
+
+namespace Kernel {
+
+SystemCallTrace::SystemCallTrace(uint32_t processId) : processId(processId) {}
+
+SystemCallTrace::~SystemCallTrace() {
+    delete[] records;
+}
+
+uint32_t SystemCallTrace::getProcessId() const {
+    return processId;
+}
+
+void SystemCallTrace::record(const Util::Async::SystemCallRecord &record) {
+    lock.acquire();
+
+    if (size == CAPACITY) {
+        droppedRecords++;
+    } else {
+        records[(readIndex + size) % CAPACITY] = record;
+        size++;
+    }
+
+    lock.release();
+}
+
+uint32_t SystemCallTrace::read(Util::Async::SystemCallRecord *buffer, uint32_t count, uint32_t &dropped, bool &finished) {
+    lock.acquire();
+
+    uint32_t i;
+    for (i = 0; i < count && size > 0; i++) {
+        buffer[i] = records[readIndex];
+        readIndex = (readIndex + 1) % CAPACITY;
+        size--;
+    }
+
+    dropped = droppedRecords;
+    droppedRecords = 0;
+    finished = !tracedProcessAttached && size == 0;
+
+    lock.release();
+    return i;
+}
+
+bool SystemCallTrace::detachTracedProcess() {
+    lock.acquire();
+    tracedProcessAttached = false;
+    auto last = !tracerAttached;
+    lock.release();
+
+    return last;
+}
+
+bool SystemCallTrace::detachTracer() {
+    lock.acquire();
+    tracerAttached = false;
+    auto last = !tracedProcessAttached;
+    lock.release();
+
+    return last;
+}
+
+}
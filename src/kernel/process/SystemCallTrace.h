@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_SYSTEMCALLTRACE_H
+#define HHUOS_SYSTEMCALLTRACE_H
+
+#include <cstdint>
+
+#include "lib/util/async/Process.h"
+#include "lib/util/async/Spinlock.h"
+
+namespace Kernel {
+
+/**
+ * Buffer for the system calls of a traced process, which are read by the process, that started it.
+ * The trace is shared by both processes and is deleted by the one detaching last,
+ * so that the tracer can still read the remaining records after the traced process has terminated.
+ */
+class SystemCallTrace {
+
+public:
+    /**
+     * Constructor.
+     */
+    explicit SystemCallTrace(uint32_t processId);
+
+    /**
+     * Copy Constructor.
+     */
+    SystemCallTrace(const SystemCallTrace &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    SystemCallTrace &operator=(const SystemCallTrace &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~SystemCallTrace();
+
+    [[nodiscard]] uint32_t getProcessId() const;
+
+    /**
+     * Append a record. If the buffer is full, the record is dropped and counted.
+     */
+    void record(const Util::Async::SystemCallRecord &record);
+
+    /**
+     * Move up to count records into the given buffer.
+     *
+     * @param droppedRecords Set to the number of records, that have been dropped since the last call
+     * @param finished Set to true, if the traced process has detached and no records are left
+     * @return The number of records, written to the buffer
+     */
+    uint32_t read(Util::Async::SystemCallRecord *buffer, uint32_t count, uint32_t &droppedRecords, bool &finished);
+
+    /**
+     * Called by the traced process, once all of its threads have terminated.
+     *
+     * @return true, if the tracer has already detached and the trace must be deleted by the caller
+     */
+    [[nodiscard]] bool detachTracedProcess();
+
+    /**
+     * Called by the tracer, once it has read all records or terminates.
+     *
+     * @return true, if the traced process has already detached and the trace must be deleted by the caller
+     */
+    [[nodiscard]] bool detachTracer();
+
+    static const constexpr uint32_t CAPACITY = 4096;
+
+private:
+
+    uint32_t processId;
+    Util::Async::SystemCallRecord *records = new Util::Async::SystemCallRecord[CAPACITY];
+    uint32_t readIndex = 0;
+    uint32_t size = 0;
+    uint32_t droppedRecords = 0;
+
+    bool tracedProcessAttached = true;
+    bool tracerAttached = true;
+
+    Util::Async::Spinlock lock = Util::Async::Spinlock("system-call-trace");
+};
+
+}
+
+#endif
@@ -18,11 +18,14 @@
 #include "lib/util/base/Address.h"
 #include "lib/util/base/operators.h"
 #include "kernel/system/System.h"
+#include "kernel/system/PerCpu.h"
 #include "kernel/paging/MemoryLayout.h"
 #include "kernel/paging/Paging.h"
 #include "asm_interface.h"
 #include "Thread.h"
 #include "kernel/process/ThreadState.h"
+#include "kernel/process/WaitQueue.h"
+#include "kernel/memory/BlockCache.h"
 #include "kernel/service/MemoryService.h"
 #include "kernel/service/SchedulerService.h"
 #include "lib/util/async/IdGenerator.h"
@@ -42,16 +45,21 @@ Thread::Thread(const Util::String &name, Process &parent, Util::Async::Runnable
         id(idGenerator.next()), name(name), parent(parent), runnable(runnable), kernelStack(kernelStack), userStack(userStack),
         interruptFrame(*reinterpret_cast<InterruptFrame*>(kernelStack->getStart() - sizeof(InterruptFrame))),
         kernelContext(reinterpret_cast<Context*>(kernelStack->getStart() - sizeof(InterruptFrame) - sizeof(Context))),
-        fpuContext(static_cast<uint8_t*>(System::getService<MemoryService>().allocateKernelMemory(512, 16))) {
+        fpuContext(static_cast<uint8_t*>(System::getService<SchedulerService>().getFpuContextCache().allocate())) {
     auto source = Util::Address<uint32_t>(System::getService<SchedulerService>().getDefaultFpuContext());
     Util::Address<uint32_t>(fpuContext).copyRange(source, 512);
 }
 
 Thread::~Thread() {
+    // A thread, that was still running on another CPU when it has been killed, may have parked itself afterwards
+    if (waitQueue != nullptr) {
+        waitQueue->remove(*this);
+    }
+
     // Do not delete user stack, as it is hard coded
     // TODO: Once a process can have multiple user threads, this needs to be revised
     delete kernelStack;
-    delete fpuContext;
+    System::getService<SchedulerService>().getFpuContextCache().free(fpuContext);
     delete runnable;
 }
 
@@ -63,7 +71,7 @@ Thread& Thread::createKernelThread(const Util::String &name, Process &parent, Ut
 
     thread->interruptFrame.cs = 0x08;
     thread->interruptFrame.fs = 0x10;
-    thread->interruptFrame.gs = 0x10;
+    thread->interruptFrame.gs = PerCpuData::SEGMENT_SELECTOR;
     thread->interruptFrame.ds = 0x10;
     thread->interruptFrame.es = 0x10;
     thread->interruptFrame.ss = 0x10;
@@ -150,6 +158,32 @@ uint8_t *Thread::getFpuContext() const {
     return fpuContext;
 }
 
+uint8_t Thread::getPriority() const {
+    return priority;
+}
+
+Thread::Statistics Thread::getStatistics() const {
+    return statistics;
+}
+
+void Thread::countPageFault() {
+    statistics.pageFaults++;
+}
+
+void Thread::countSystemCall() {
+    statistics.systemCalls++;
+}
+
+Thread::Statistics& Thread::Statistics::operator+=(const Thread::Statistics &other) {
+    cpuCycles += other.cpuCycles;
+    voluntaryContextSwitches += other.voluntaryContextSwitches;
+    involuntaryContextSwitches += other.involuntaryContextSwitches;
+    pageFaults += other.pageFaults;
+    systemCalls += other.systemCalls;
+
+    return *this;
+}
+
 void Thread::join() {
     auto &schedulerService = System::getService<SchedulerService>();
     joinLock.acquire();
@@ -167,7 +201,7 @@ void Thread::unblockJoinList() {
     joinLock.release();
 }
 
-Thread::Stack::Stack(uint8_t *stack, uint32_t size) : stack(stack), size(size) {
+Thread::Stack::Stack(uint8_t *stack, uint32_t size, BlockCache *cache) : stack(stack), size(size), cache(cache) {
     Util::Address<uint32_t>(stack).setRange(0, size);
 
     this->stack[0] = 0x44; // D
@@ -177,7 +211,11 @@ Thread::Stack::Stack(uint8_t *stack, uint32_t size) : stack(stack), size(size) {
 }
 
 Thread::Stack::~Stack() {
-    delete[] stack;
+    if (cache != nullptr) {
+        cache->free(stack);
+    } else {
+        delete[] stack;
+    }
 }
 
 uint8_t* Thread::Stack::getStart() const {
@@ -185,6 +223,11 @@ uint8_t* Thread::Stack::getStart() const {
 }
 
 Thread::Stack* Thread::Stack::createKernelStack(uint32_t size) {
+    auto &stackCache = System::getService<SchedulerService>().getKernelStackCache();
+    if (size == stackCache.getBlockSize()) {
+        return new Stack(static_cast<uint8_t*>(stackCache.allocate()), size, &stackCache);
+    }
+
     auto &memoryService = Kernel::System::getService<Kernel::MemoryService>();
     return new Stack(static_cast<uint8_t*>(memoryService.allocateKernelMemory(size, 16)), size);
 }
@@ -23,6 +23,8 @@
 #include "lib/util/base/String.h"
 #include "lib/util/collection/ArrayList.h"
 #include "lib/util/async/Spinlock.h"
+#include "lib/util/async/Thread.h"
+#include "kernel/process/ReferenceCounted.h"
 
 namespace Util {
 namespace Async {
@@ -33,14 +35,21 @@ template <typename T> class IdGenerator;
 
 namespace Kernel {
 
+class BlockCache;
 class Process;
+class ReadyQueue;
+class TimeoutQueue;
+class WaitQueue;
 struct Context;
 struct InterruptFrame;
 
-class Thread {
+class Thread : public ReferenceCounted {
 
     friend class ThreadScheduler;
     friend class Scheduler;
+    friend class ReadyQueue;
+    friend class TimeoutQueue;
+    friend class WaitQueue;
 
 public:
 
@@ -64,13 +73,30 @@ public:
 
     private:
 
-        explicit Stack(uint8_t *stack, uint32_t size);
+        explicit Stack(uint8_t *stack, uint32_t size, BlockCache *cache = nullptr);
 
         uint8_t *stack;
         uint32_t size;
+        BlockCache *cache; // Cache, the stack memory is returned to on destruction (nullptr, if it is not cached)
 
     };
 
+    /**
+     * Resource usage of a thread. The counters are only written by the CPU, that is currently executing the thread.
+     */
+    struct Statistics {
+        uint64_t cpuCycles = 0; // Time stamp counter cycles, the thread has been running for
+        uint32_t voluntaryContextSwitches = 0; // The thread has yielded, blocked, slept or exited
+        uint32_t involuntaryContextSwitches = 0; // The thread has been preempted
+        uint32_t pageFaults = 0;
+        uint32_t systemCalls = 0;
+
+        Statistics& operator+=(const Statistics &other);
+    };
+
+    static const constexpr uint8_t PRIORITY_LEVELS = Util::Async::Thread::MAXIMUM + 1;
+    static const constexpr uint32_t DEFAULT_STACK_SIZE = 4096;
+
     /**
      * Copy Constructor.
      */
@@ -103,6 +129,14 @@ public:
 
     [[nodiscard]] uint8_t* getFpuContext() const;
 
+    [[nodiscard]] uint8_t getPriority() const;
+
+    [[nodiscard]] Statistics getStatistics() const;
+
+    void countPageFault();
+
+    void countSystemCall();
+
     void join();
 
     void unblockJoinList();
@@ -111,6 +145,14 @@ public:
 
 private:
 
+    enum State : uint8_t {
+        READY,
+        RUNNING,
+        BLOCKED,
+        SLEEPING,
+        TERMINATED
+    };
+
     Thread(const Util::String &name, Process &parent, Util::Async::Runnable *runnable, Thread::Stack *kernelStack, Thread::Stack *userStack);
 
     uint32_t id;
@@ -125,11 +167,33 @@ private:
     Context *kernelContext;
     uint8_t *fpuContext;
 
+    // Scheduling state, only accessed by the scheduler while holding the lock of the run queue given by 'cpuId'
+    State state = READY;
+    uint8_t cpuId = 0;
+    bool wakeupPending = false;
+    uint8_t priority = Util::Async::Thread::NORMAL;
+    uint32_t timeSlice = 0; // Remaining time slice in microseconds
+
+    // Links inside the ready queue, that currently holds this thread
+    ReadyQueue *readyQueue = nullptr;
+    Thread *queueNext = nullptr;
+    Thread *queuePrevious = nullptr;
+
+    // Position inside the timeout queue, that currently holds this thread
+    TimeoutQueue *timeoutQueue = nullptr;
+    uint32_t timeoutIndex = 0;
+    uint64_t wakeupTime = 0; // System time in microseconds
+    bool timedOut = false;
+
+    // The wait queue, that this thread is parked on (only changed while holding the queue's lock)
+    WaitQueue *waitQueue = nullptr;
+
+    Statistics statistics;
+
     Util::ArrayList<Thread*> joinList;
     Util::Async::Spinlock joinLock;
 
     static Util::Async::IdGenerator<uint32_t> idGenerator;
-    static const constexpr uint32_t DEFAULT_STACK_SIZE = 4096;
 };
 
 }
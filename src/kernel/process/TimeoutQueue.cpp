@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+#include "TimeoutQueue.h"
+
+#include "lib/util/base/Exception.h"
+
+namespace Kernel {
+
+void TimeoutQueue::add(Thread &thread, uint64_t wakeupTime) {
+    if (thread.timeoutQueue != nullptr) {
+        Util::Exception::throwException(Util::Exception::INVALID_ARGUMENT, "TimeoutQueue: Thread is already queued!");
+    }
+
+    thread.timeoutQueue = this;
+    thread.wakeupTime = wakeupTime;
+    thread.timeoutIndex = heap.size();
+    heap.add(&thread);
+
+    siftUp(thread.timeoutIndex);
+}
+
+void TimeoutQueue::remove(Thread &thread) {
+    if (thread.timeoutQueue != this) {
+        return;
+    }
+
+    auto index = thread.timeoutIndex;
+    auto last = heap.size() - 1;
+    if (index != last) {
+        swap(index, last);
+    }
+
+    heap.removeIndex(last);
+    thread.timeoutQueue = nullptr;
+
+    if (index != last) {
+        // The former last element may have to move in either direction
+        auto *moved = heap.get(index);
+        siftUp(index);
+        siftDown(moved->timeoutIndex);
+    }
+}
+
+Thread* TimeoutQueue::pollExpired(uint64_t systemTime) {
+    if (heap.isEmpty()) {
+        return nullptr;
+    }
+
+    auto *thread = heap.get(0);
+    if (systemTime < thread->wakeupTime) {
+        return nullptr;
+    }
+
+    remove(*thread);
+    return thread;
+}
+
+uint64_t TimeoutQueue::getEarliestWakeupTime() const {
+    return heap.isEmpty() ? UINT64_MAX : heap.get(0)->wakeupTime;
+}
+
+bool TimeoutQueue::contains(const Thread &thread) const {
+    return thread.timeoutQueue == this;
+}
+
+bool TimeoutQueue::isEmpty() const {
+    return heap.isEmpty();
+}
+
+uint32_t TimeoutQueue::size() const {
+    return heap.size();
+}
+
+void TimeoutQueue::swap(uint32_t index, uint32_t other) {
+    auto *thread = heap.get(index);
+    auto *otherThread = heap.get(other);
+
+    heap.set(index, otherThread);
+    heap.set(other, thread);
+    otherThread->timeoutIndex = index;
+    thread->timeoutIndex = other;
+}
+
+void TimeoutQueue::siftUp(uint32_t index) {
+    while (index > 0) {
+        auto parent = (index - 1) / 2;
+        if (heap.get(index)->wakeupTime >= heap.get(parent)->wakeupTime) {
+            return;
+        }
+
+        swap(index, parent);
+        index = parent;
+    }
+}
+
+void TimeoutQueue::siftDown(uint32_t index) {
+    auto size = heap.size();
+    while (true) {
+        auto left = 2 * index + 1;
+        auto right = left + 1;
+        auto smallest = index;
+
+        if (left < size && heap.get(left)->wakeupTime < heap.get(smallest)->wakeupTime) {
+            smallest = left;
+        }
+
+        if (right < size && heap.get(right)->wakeupTime < heap.get(smallest)->wakeupTime) {
+            smallest = right;
+        }
+
+        if (smallest == index) {
+            return;
+        }
+
+        swap(index, smallest);
+        index = smallest;
+    }
+}
+
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+#ifndef HHUOS_TIMEOUTQUEUE_H
+#define HHUOS_TIMEOUTQUEUE_H
+
+#include <cstdint>
+
+#include "lib/util/collection/ArrayList.h"
+#include "kernel/process/Thread.h"
+
+namespace Kernel {
+
+/**
+ * Holds the threads of a run queue, that wait for a point in time (sleeping threads and blocked threads with a timeout).
+ * The threads are kept in a binary min-heap, ordered by their wakeup time. Each thread stores its position inside the heap,
+ * so that looking at the next expired thread is O(1), while adding and removing an arbitrary thread is O(log n).
+ */
+class TimeoutQueue {
+
+public:
+    /**
+     * Default Constructor.
+     */
+    TimeoutQueue() = default;
+
+    /**
+     * Copy Constructor.
+     */
+    TimeoutQueue(const TimeoutQueue &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    TimeoutQueue &operator=(const TimeoutQueue &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~TimeoutQueue() = default;
+
+    /**
+     * Add a thread, that shall be woken up at the given system time (in microseconds).
+     * A thread can only be part of a single timeout queue at a time.
+     */
+    void add(Thread &thread, uint64_t wakeupTime);
+
+    void remove(Thread &thread);
+
+    /**
+     * Remove the thread with the earliest wakeup time, if its wakeup time has been reached.
+     *
+     * @return The removed thread, or nullptr if no thread has expired yet
+     */
+    Thread* pollExpired(uint64_t systemTime);
+
+    /**
+     * @return The earliest wakeup time of all queued threads, or UINT64_MAX if the queue is empty
+     */
+    [[nodiscard]] uint64_t getEarliestWakeupTime() const;
+
+    [[nodiscard]] bool contains(const Thread &thread) const;
+
+    [[nodiscard]] bool isEmpty() const;
+
+    [[nodiscard]] uint32_t size() const;
+
+private:
+
+    void swap(uint32_t index, uint32_t other);
+
+    void siftUp(uint32_t index);
+
+    void siftDown(uint32_t index);
+
+    Util::ArrayList<Thread*> heap;
+};
+
+}
+
+#endif
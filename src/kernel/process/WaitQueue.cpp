@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+#include "WaitQueue.h"
+
+#include "kernel/system/System.h"
+#include "kernel/service/SchedulerService.h"
+#include "kernel/process/Thread.h"
+#include "lib/util/async/Lock.h"
+
+namespace Kernel {
+
+void WaitQueue::wait(Util::Async::Lock &conditionLock) {
+    auto flags = Device::Cpu::saveAndDisableInterrupts();
+    acquireLock();
+    park(flags, &conditionLock, nullptr);
+}
+
+bool WaitQueue::wait(Util::Async::Lock &conditionLock, const Util::Time::Timestamp &timeout) {
+    auto flags = Device::Cpu::saveAndDisableInterrupts();
+    acquireLock();
+    return park(flags, &conditionLock, &timeout);
+}
+
+void WaitQueue::notify() {
+    auto &schedulerService = System::getService<SchedulerService>();
+    auto flags = Device::Cpu::saveAndDisableInterrupts();
+    acquireLock();
+
+    if (!waitingThreads.isEmpty()) {
+        auto *thread = waitingThreads.removeIndex(0);
+        schedulerService.unblock(*thread);
+        thread->waitQueue = nullptr;
+    }
+
+    lock.release();
+    Device::Cpu::restoreInterrupts(flags);
+}
+
+void WaitQueue::notifyAll() {
+    auto flags = Device::Cpu::saveAndDisableInterrupts();
+    acquireLock();
+    unblockAll();
+    lock.release();
+    Device::Cpu::restoreInterrupts(flags);
+}
+
+bool WaitQueue::isEmpty() {
+    auto flags = Device::Cpu::saveAndDisableInterrupts();
+    acquireLock();
+    auto empty = waitingThreads.isEmpty();
+    lock.release();
+    Device::Cpu::restoreInterrupts(flags);
+
+    return empty;
+}
+
+void WaitQueue::acquireLock() {
+    // Interrupts are disabled and the lock is only held for a few instructions, so there is no need to yield
+    while (!lock.tryAcquire()) {
+        asm volatile ("pause");
+    }
+}
+
+void WaitQueue::unblockAll() {
+    auto &schedulerService = System::getService<SchedulerService>();
+    for (auto *thread : waitingThreads) {
+        schedulerService.unblock(*thread);
+        thread->waitQueue = nullptr;
+    }
+
+    waitingThreads.clear();
+}
+
+void WaitQueue::remove(Thread &thread) {
+    auto flags = Device::Cpu::saveAndDisableInterrupts();
+    acquireLock();
+
+    if (thread.waitQueue == this) {
+        waitingThreads.remove(&thread);
+        thread.waitQueue = nullptr;
+    }
+
+    lock.release();
+    Device::Cpu::restoreInterrupts(flags);
+}
+
+bool WaitQueue::park(uint32_t flags, Util::Async::Lock *conditionLock, const Util::Time::Timestamp *timeout) {
+    auto &schedulerService = System::getService<SchedulerService>();
+    auto &currentThread = schedulerService.getCurrentThread();
+
+    waitingThreads.add(&currentThread);
+    currentThread.waitQueue = this;
+    lock.release();
+    Device::Cpu::restoreInterrupts(flags);
+
+    if (conditionLock != nullptr) {
+        conditionLock->release();
+    }
+
+    auto notified = true;
+    if (timeout != nullptr) {
+        notified = schedulerService.block(*timeout);
+    } else {
+        schedulerService.block();
+    }
+
+    if (!notified) {
+        flags = Device::Cpu::saveAndDisableInterrupts();
+        acquireLock();
+        auto stillWaiting = waitingThreads.remove(&currentThread);
+        if (stillWaiting) {
+            currentThread.waitQueue = nullptr;
+        }
+        lock.release();
+        Device::Cpu::restoreInterrupts(flags);
+
+        if (!stillWaiting) {
+            // The thread has been notified right after the timeout and its unblock is pending -> Consume it
+            schedulerService.block();
+            notified = true;
+        }
+    }
+
+    if (conditionLock != nullptr) {
+        conditionLock->acquire();
+    }
+
+    return notified;
+}
+
+}
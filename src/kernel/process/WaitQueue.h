@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+#ifndef HHUOS_WAITQUEUE_H
+#define HHUOS_WAITQUEUE_H
+
+#include <cstdint>
+
+#include "device/cpu/Cpu.h"
+#include "lib/util/async/Spinlock.h"
+#include "lib/util/collection/ArrayList.h"
+
+namespace Util {
+namespace Async {
+class Lock;
+}  // namespace Async
+namespace Time {
+class Timestamp;
+}  // namespace Time
+}  // namespace Util
+
+namespace Kernel {
+class Thread;
+
+/**
+ * Parks threads, that wait for a condition to become true, instead of letting them spin on yield().
+ * Waiting threads are blocked by the scheduler and only become ready again, once a producer calls notify() or notifyAll().
+ * Notifying is safe from interrupt handlers. A notification, that arrives before the waiting thread has actually blocked,
+ * is not lost, since the thread is queued before it releases the lock, that protects the condition.
+ */
+class WaitQueue {
+
+public:
+    /**
+     * Default Constructor.
+     */
+    WaitQueue() = default;
+
+    /**
+     * Copy Constructor.
+     */
+    WaitQueue(const WaitQueue &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    WaitQueue &operator=(const WaitQueue &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~WaitQueue() = default;
+
+    /**
+     * Block the current thread, until it is notified.
+     * The given lock protects the awaited condition and must be held by the caller.
+     * It is released while waiting and acquired again before returning.
+     */
+    void wait(Util::Async::Lock &conditionLock);
+
+    /**
+     * Block the current thread, until it is notified or the timeout has passed.
+     *
+     * @return true, if the thread has been notified, false if the timeout has passed
+     */
+    bool wait(Util::Async::Lock &conditionLock, const Util::Time::Timestamp &timeout);
+
+    /**
+     * Block the current thread, until the condition is true.
+     * The condition is evaluated with interrupts disabled, so that it may be fulfilled by an interrupt handler,
+     * which calls notify() afterwards.
+     */
+    template<typename Condition>
+    void waitUntil(Condition condition) {
+        while (true) {
+            auto flags = Device::Cpu::saveAndDisableInterrupts();
+            acquireLock();
+
+            if (condition()) {
+                lock.release();
+                Device::Cpu::restoreInterrupts(flags);
+                return;
+            }
+
+            park(flags, nullptr, nullptr);
+        }
+    }
+
+    /**
+     * Wake up the thread, that has been waiting the longest.
+     */
+    void notify();
+
+    /**
+     * Wake up all waiting threads.
+     */
+    void notifyAll();
+
+    /**
+     * Change the awaited condition and wake up all waiting threads, while holding the queue's lock.
+     * Since waitUntil() evaluates its condition with the same lock held, a waiter can only observe the change,
+     * after the queue has been released. This allows a waiter to free the object containing the queue right away.
+     */
+    template<typename Update>
+    void notifyAll(Update update) {
+        auto flags = Device::Cpu::saveAndDisableInterrupts();
+        acquireLock();
+
+        update();
+        unblockAll();
+
+        lock.release();
+        Device::Cpu::restoreInterrupts(flags);
+    }
+
+    [[nodiscard]] bool isEmpty();
+
+    /**
+     * Remove a thread, that is killed while waiting, so that it is not notified after it has been freed.
+     * Returns after any notification, that is currently unblocking the thread, has finished.
+     */
+    void remove(Thread &thread);
+
+private:
+
+    void acquireLock();
+
+    /**
+     * Unblock and dequeue all waiting threads. Must be called with the queue's lock held.
+     * A thread's queue is reset after it has been unblocked, so that remove() waits for the notification to finish.
+     */
+    void unblockAll();
+
+    /**
+     * Queue and block the current thread. Must be called with the queue's lock held and interrupts disabled.
+     * Both are released before blocking.
+     */
+    bool park(uint32_t flags, Util::Async::Lock *conditionLock, const Util::Time::Timestamp *timeout);
+
+    Util::Async::Spinlock lock = Util::Async::Spinlock("wait-queue");
+    Util::ArrayList<Thread*> waitingThreads;
+};
+
+}
+
+#endif
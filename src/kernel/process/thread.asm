@@ -14,6 +14,7 @@
 ; along with this program.  If not, see <http://www.gnu.org/licenses/>
 
 global start_first_thread
+global start_application_processor_thread
 global switch_context
 
 extern scheduler_initialized
@@ -36,6 +37,22 @@ start_first_thread:
     ; start thread
     ret
 
+; Application processors have already loaded their task state segment during startup (see symmetric_multiprocessing.asm)
+start_application_processor_thread:
+    ; get the thread's context
+    mov    esp, [esp + 0x04]
+
+    ; load registers
+    pop edi
+    pop esi
+    pop ebx
+    pop ebp
+
+    call release_scheduler_lock
+
+    ; start thread
+    ret
+
 switch_context:
     ; get both thread's contexts
     mov eax, [esp + 0x04]
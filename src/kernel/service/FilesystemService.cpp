@@ -158,6 +158,10 @@ FilesystemService::FilesystemService() {
         return true;
     });
 
+    // The data buffers of WRITE_FILE and READ_FILE (slot 1) are loaded with their 64-bit length (slots 4 and 5) by the system call boundary
+    SystemCall::registerUserBuffer(Util::System::WRITE_FILE, 5, 1, 4);
+    SystemCall::registerUserBuffer(Util::System::READ_FILE, 5, 1, 4);
+
     SystemCall::registerSystemCall(Util::System::WRITE_FILE, [](uint32_t paramCount, va_list arguments) -> bool {
         if (paramCount < 5) {
             return false;
@@ -17,11 +17,18 @@
 
 #include "InterruptService.h"
 
+#include "device/cpu/Cpu.h"
 #include "device/interrupt/InterruptRequest.h"
 #include "device/interrupt/apic/Apic.h"
 #include "kernel/interrupt/InterruptVector.h"
 #include "kernel/log/Logger.h"
 #include "device/interrupt/apic/LocalApic.h"
+#include "kernel/system/PerCpu.h"
+#include "kernel/system/System.h"
+#include "kernel/process/Thread.h"
+#include "kernel/service/ProcessService.h"
+#include "kernel/service/SchedulerService.h"
+#include "lib/util/async/Thread.h"
 
 namespace Kernel {
 class InterruptHandler;
@@ -31,6 +38,10 @@ Kernel::Logger InterruptService::log = Kernel::Logger::get("Interrupt");
 
 void InterruptService::useApic(Device::Apic *apic) {
     InterruptService::apic = apic;
+
+    // The bootstrap processor's local APIC id is not necessarily 0
+    dispatcher.addCpu(Device::LocalApic::getId());
+    System::registerPerCpuData(Device::LocalApic::getId(), CpuLocal::getData());
 }
 
 bool InterruptService::usesApic() const {
@@ -42,27 +53,67 @@ InterruptService::~InterruptService() {
 }
 
 void InterruptService::assignInterrupt(InterruptVector slot, InterruptHandler &handler) {
+    auto flags = Device::Cpu::saveAndDisableInterrupts();
+    registrationLock.acquire();
     dispatcher.assign(slot, handler);
+    registrationLock.release();
+    Device::Cpu::restoreInterrupts(flags);
 }
 
 void InterruptService::dispatchInterrupt(const InterruptFrame &frame) {
     dispatcher.dispatch(frame);
+
+    // Deferred work is processed on interrupt exit, until the worker thread is running
+    if (!workQueue->isWorkerRunning()) {
+        workQueue->drain();
+    }
+}
+
+void InterruptService::addCpu(uint8_t cpuId) {
+    dispatcher.addCpu(cpuId);
+}
+
+InterruptDispatcher::Statistics InterruptService::getInterruptStatistics(InterruptVector slot) {
+    return dispatcher.getStatistics(slot);
+}
+
+void InterruptService::deferWork(InterruptHandler &handler) {
+    workQueue->submit(handler);
+}
+
+void InterruptService::startWorkerThread() {
+    auto &processService = System::getService<ProcessService>();
+    auto &schedulerService = System::getService<SchedulerService>();
+
+    auto &workerThread = Thread::createKernelThread("Interrupt-Worker", processService.getKernelProcess(), workQueue);
+    schedulerService.setPriority(workerThread, Util::Async::Thread::MAXIMUM);
+    schedulerService.ready(workerThread);
 }
 
 void InterruptService::allowHardwareInterrupt(Device::InterruptRequest interrupt) {
+    auto flags = Device::Cpu::saveAndDisableInterrupts();
+    registrationLock.acquire();
     if (usesApic()) {
         apic->allow(interrupt);
     } else if (interrupt - 32 <= Device::InterruptRequest::SECONDARY_ATA) {
         pic.allow(interrupt);
     }
+
+    registrationLock.release();
+    Device::Cpu::restoreInterrupts(flags);
 }
 
 void InterruptService::forbidHardwareInterrupt(Device::InterruptRequest interrupt) {
+    auto flags = Device::Cpu::saveAndDisableInterrupts();
+    registrationLock.acquire();
     if (usesApic()) {
         apic->forbid(interrupt);
     } else if (interrupt - 32 <= Device::InterruptRequest::SECONDARY_ATA) {
         pic.forbid(interrupt);
     }
+
+    registrationLock.release();
+    Device::Cpu::restoreInterrupts(flags);
 }
 
 void InterruptService::sendEndOfInterrupt(InterruptVector interrupt) {
@@ -122,7 +173,7 @@ void InterruptService::setInterruptMask(uint16_t mask) {
 }
 
 uint8_t InterruptService::getCpuId() const {
-    return usesApic() ? Device::LocalApic::getId() : 0;
+    return CpuLocal::cpuId.get();
 }
 
 bool InterruptService::isParallelComputingAllowed() const {
@@ -22,9 +22,11 @@
 
 #include "device/interrupt/Pic.h"
 #include "kernel/interrupt/InterruptDispatcher.h"
+#include "kernel/interrupt/WorkQueue.h"
 #include "kernel/service/Service.h"
 #include "device/debug/GdbServer.h"
 #include "device/port/serial/SerialPort.h"
+#include "lib/util/async/Spinlock.h"
 
 namespace Device {
 class Apic;
@@ -68,6 +70,20 @@ public:
 
     void dispatchInterrupt(const InterruptFrame &frame);
 
+    /**
+     * Prepare the interrupt statistics of an application processor, before it is started (see InterruptDispatcher::addCpu()).
+     */
+    void addCpu(uint8_t cpuId);
+
+    [[nodiscard]] InterruptDispatcher::Statistics getInterruptStatistics(InterruptVector slot);
+
+    /**
+     * Queue the deferred work of an interrupt handler, which is then processed by the interrupt worker thread.
+     */
+    void deferWork(InterruptHandler &handler);
+
+    void startWorkerThread();
+
     void allowHardwareInterrupt(Device::InterruptRequest interrupt);
 
     void forbidHardwareInterrupt(Device::InterruptRequest interrupt);
@@ -100,10 +116,14 @@ private:
     Device::Apic *apic = nullptr;
 
     InterruptDispatcher dispatcher;
+    WorkQueue *workQueue = new WorkQueue(); // Owned by the worker thread, once it has been started
     Device::GdbServer gdbServer = Device::GdbServer();
 
     bool parallelComputingAllowed = false;
 
+    // Devices may be probed in parallel during boot, while they register their handlers
+    Util::Async::Spinlock registrationLock = Util::Async::Spinlock("interrupt-registration");
+
     static Kernel::Logger log;
 };
 
@@ -19,19 +19,27 @@
 
 #include "kernel/paging/Paging.h"
 #include "kernel/system/System.h"
+#include "kernel/system/PerCpu.h"
 #include "kernel/service/InterruptService.h"
 #include "kernel/paging/MemoryLayout.h"
 #include "asm_interface.h"
 #include "MemoryService.h"
+#include "kernel/log/Trace.h"
 #include "kernel/service/MemoryService.h"
 #include "kernel/memory/PageFrameAllocator.h"
 #include "kernel/memory/PagingAreaManager.h"
 #include "kernel/paging/PageDirectory.h"
 #include "kernel/paging/VirtualAddressSpace.h"
 #include "kernel/process/ThreadState.h"
+#include "kernel/process/Thread.h"
+#include "kernel/process/Process.h"
+#include "kernel/process/ImageCache.h"
+#include "kernel/service/TimeService.h"
 #include "kernel/system/SystemCall.h"
 #include "lib/util/base/Exception.h"
+#include "lib/util/base/Address.h"
 #include "lib/util/base/HeapMemoryManager.h"
+#include "lib/util/base/Constants.h"
 #include "lib/util/base/System.h"
 #include "kernel/interrupt/InterruptVector.h"
 #include "lib/util/collection/Iterator.h"
@@ -39,8 +47,9 @@
 namespace Kernel {
 
 MemoryService::MemoryService(PageFrameAllocator *pageFrameAllocator, PagingAreaManager *pagingAreaManager, VirtualAddressSpace *kernelAddressSpace)
-        : pageFrameAllocator(*pageFrameAllocator), pagingAreaManager(*pagingAreaManager), currentAddressSpace(kernelAddressSpace), kernelAddressSpace(*kernelAddressSpace) {
+        : pageFrameAllocator(*pageFrameAllocator), pagingAreaManager(*pagingAreaManager), kernelAddressSpace(*kernelAddressSpace) {
     addressSpaces.add(kernelAddressSpace);
+    CpuLocal::currentAddressSpace.set(kernelAddressSpace);
 
     lowerMemoryManager.initialize(reinterpret_cast<uint8_t*>(MemoryLayout::USABLE_LOWER_MEMORY.toVirtual().startAddress), reinterpret_cast<uint8_t*>(MemoryLayout::USABLE_LOWER_MEMORY.toVirtual().endAddress));
     lowerMemoryManager.disableAutomaticUnmapping();
@@ -99,15 +108,15 @@ void MemoryService::freeKernelMemory(void *pointer, uint32_t alignment) {
 }
 
 void *MemoryService::allocateUserMemory(uint32_t size, uint32_t alignment) {
-    return currentAddressSpace->getMemoryManager().allocateMemory(size, alignment);
+    return getCurrentAddressSpace().getMemoryManager().allocateMemory(size, alignment);
 }
 
 void *MemoryService::reallocateUserMemory(void *pointer, uint32_t size, uint32_t alignment) {
-    return currentAddressSpace->getMemoryManager().reallocateMemory(pointer, size, alignment);
+    return getCurrentAddressSpace().getMemoryManager().reallocateMemory(pointer, size, alignment);
 }
 
 void MemoryService::freeUserMemory(void *pointer, uint32_t alignment) {
-    currentAddressSpace->getMemoryManager().freeMemory(pointer, alignment);
+    getCurrentAddressSpace().getMemoryManager().freeMemory(pointer, alignment);
 }
 
 void *MemoryService::allocateLowerMemory(uint32_t size, uint32_t alignment) {
@@ -154,7 +163,15 @@ void Kernel::MemoryService::mapPhysicalAddress(uint32_t virtualAddress, uint32_t
     // Mark the physical page frame as used
     physicalAddress = reinterpret_cast<uint32_t>(pageFrameAllocator.allocateBlockAtAddress(reinterpret_cast<void*>(physicalAddress)));
     // Map the page into the directory
-    currentAddressSpace->getPageDirectory().map(physicalAddress, virtualAddress, flags);
+    getCurrentAddressSpace().getPageDirectory().map(physicalAddress, virtualAddress, flags);
+}
+
+void MemoryService::referencePageFrame(uint32_t physicalAddress) {
+    static_cast<void>(pageFrameAllocator.allocateBlockAtAddress(reinterpret_cast<void*>(physicalAddress)));
+}
+
+void MemoryService::releasePageFrame(uint32_t physicalAddress) {
+    pageFrameAllocator.freeBlock(reinterpret_cast<void*>(physicalAddress));
 }
 
 void Kernel::MemoryService::mapRange(uint32_t virtualStartAddress, uint32_t virtualEndAddress, uint16_t flags) {
@@ -169,30 +186,33 @@ void Kernel::MemoryService::mapRange(uint32_t virtualStartAddress, uint32_t virt
     }
 }
 
-void Kernel::MemoryService::map(uint32_t virtualAddress, uint16_t flags, bool interrupt) {
+bool Kernel::MemoryService::map(uint32_t virtualAddress, uint16_t flags, bool interrupt) {
     // Allocate a physical page frame where the page should be mapped
     const auto physicalAddress = reinterpret_cast<uint32_t>(pageFrameAllocator.allocateBlock());
     // Map the page into the directory
-    currentAddressSpace->getPageDirectory().map(physicalAddress, virtualAddress, flags, interrupt);
+    if (!getCurrentAddressSpace().getPageDirectory().map(physicalAddress, virtualAddress, flags, interrupt)) {
+        pageFrameAllocator.freeBlock(reinterpret_cast<void*>(physicalAddress));
+        return false;
+    }
+
+    return true;
 }
 
 uint32_t Kernel::MemoryService::unmap(uint32_t virtualAddress) {
-    uint32_t physAddress = currentAddressSpace->getPageDirectory().unmap(virtualAddress);
-    if (!physAddress) {
-        return 0;
+    uint32_t physAddress = unmapLocal(virtualAddress);
+    if (physAddress != 0) {
+        // Other CPUs may write through stale TLB entries, until the shootdown has finished
+        tlbShootdownHandler.invalidate(virtualAddress, virtualAddress, getCurrentAddressSpace());
+        pageFrameAllocator.freeBlock(reinterpret_cast<void*>(physAddress));
     }
 
-    pageFrameAllocator.freeBlock(reinterpret_cast<void*>(physAddress));
-
-    // Invalidate entry in TLB
-    asm volatile("push %%edx;"
-                 "movl %0,%%edx;"
-                 "invlpg (%%edx);"
-                 "pop %%edx;"  : : "r"(virtualAddress));
-
     return physAddress;
 }
 
+uint32_t MemoryService::unmapLocal(uint32_t virtualAddress) {
+    return getCurrentAddressSpace().getPageDirectory().unmap(virtualAddress);
+}
+
 uint32_t Kernel::MemoryService::unmap(uint32_t virtualStartAddress, uint32_t virtualEndAddress, uint32_t breakCount) {
     // Remark: if given addresses are not aligned on pages, we do not want to unmap
     // data that could be on the same page before virtualStartAddress or behind virtualEndAddress
@@ -212,17 +232,30 @@ uint32_t Kernel::MemoryService::unmap(uint32_t virtualStartAddress, uint32_t vir
     uint32_t pageCount = (alignedEndAddress - alignedStartAddress) / Kernel::Paging::PAGESIZE + 1;
 
     // loop through the pages and unmap them
+    // The frames are only freed after the TLB shootdown, so they are collected in batches
+    uint32_t frames[UNMAP_BATCH_SIZE];
+    uint32_t frameCount = 0;
+    uint32_t batchStartAddress = alignedStartAddress;
     uint32_t ret = 0;
     uint8_t cnt = 0;
+    uint32_t lastUnmappedAddress = 0;
     for (uint32_t i = 0; i < pageCount; i++) {
-        ret = unmap(alignedStartAddress + i * Kernel::Paging::PAGESIZE);
+        ret = unmapLocal(alignedStartAddress + i * Kernel::Paging::PAGESIZE);
 
         if (ret) {
             cnt = 0;
+            lastUnmappedAddress = alignedStartAddress + i * Kernel::Paging::PAGESIZE;
+            frames[frameCount++] = ret;
         } else {
             cnt++;
         }
 
+        if (frameCount == UNMAP_BATCH_SIZE) {
+            freeUnmappedFrames(batchStartAddress, lastUnmappedAddress, frames, frameCount);
+            batchStartAddress = lastUnmappedAddress + Kernel::Paging::PAGESIZE;
+            frameCount = 0;
+        }
+
         // TODO: This is ugly! We need a proper management for mapped/unmapped pages
         // If there were eight pages after each other already unmapped, we break here.
         // This is sort of a workaround because by merging large free memory blocks in memory management
@@ -232,17 +265,30 @@ uint32_t Kernel::MemoryService::unmap(uint32_t virtualStartAddress, uint32_t vir
         }
     }
 
+    if (frameCount > 0) {
+        freeUnmappedFrames(batchStartAddress, lastUnmappedAddress, frames, frameCount);
+    }
 
     return ret;
 }
 
+void MemoryService::freeUnmappedFrames(uint32_t virtualStartAddress, uint32_t virtualEndAddress, const uint32_t *frames, uint32_t frameCount) {
+    // Invalidate all unmapped pages at once, instead of interrupting the other CPUs for each page.
+    // Other CPUs may write through stale TLB entries, until the shootdown has finished.
+    tlbShootdownHandler.invalidate(virtualStartAddress, virtualEndAddress, getCurrentAddressSpace());
+
+    for (uint32_t i = 0; i < frameCount; i++) {
+        pageFrameAllocator.freeBlock(reinterpret_cast<void*>(frames[i]));
+    }
+}
+
 void *Kernel::MemoryService::mapIO(uint32_t physicalAddress, uint32_t size, bool mapToKernelHeap) {
     // Get amount of needed pages
     uint32_t pageCnt = size / Kernel::Paging::PAGESIZE;
     pageCnt += (size % Kernel::Paging::PAGESIZE == 0) ? 0 : 1;
 
     // Allocate 4 KiB aligned virtual memory
-    auto &manager = mapToKernelHeap ? kernelAddressSpace.getMemoryManager() : currentAddressSpace->getMemoryManager();
+    auto &manager = mapToKernelHeap ? kernelAddressSpace.getMemoryManager() : getCurrentAddressSpace().getMemoryManager();
     void *virtualStartAddress = manager.allocateMemory(pageCnt * Kernel::Paging::PAGESIZE, Kernel::Paging::PAGESIZE);
 
     // Map the allocated virtual memory to physical addresses
@@ -294,16 +340,16 @@ void *MemoryService::mapIO(uint32_t size, bool mapToKernelHeap) {
     } while (!contiguous);
 
     // See mapIO(uint32_t physicalAddress, uint32_t size, bool mapToKernelHeap) for comments
-    auto &manager = mapToKernelHeap ? kernelAddressSpace.getMemoryManager() : currentAddressSpace->getMemoryManager();
+    auto &manager = mapToKernelHeap ? kernelAddressSpace.getMemoryManager() : getCurrentAddressSpace().getMemoryManager();
     void *virtualStartAddress = manager.allocateMemory(pageCnt * Kernel::Paging::PAGESIZE, Kernel::Paging::PAGESIZE);
 
     for (uint32_t i = 0; i < pageCnt; i++) {
         uint32_t virtualAddress = reinterpret_cast<uint32_t>(virtualStartAddress) + i * Kernel::Paging::PAGESIZE;
         uint32_t physicalAddress = reinterpret_cast<uint32_t>(physicalStartAddress) + i * Kernel::Paging::PAGESIZE;
         unmap(virtualAddress);
-        currentAddressSpace->getPageDirectory().map(physicalAddress, virtualAddress,
-                                                    Paging::PRESENT | Paging::READ_WRITE | Paging::CACHE_DISABLE |
-                                                    (virtualAddress < Kernel::MemoryLayout::KERNEL_START ? Paging::USER_ACCESS : 0));
+        getCurrentAddressSpace().getPageDirectory().map(physicalAddress, virtualAddress,
+                                                        Paging::PRESENT | Paging::READ_WRITE | Paging::CACHE_DISABLE |
+                                                        (virtualAddress < Kernel::MemoryLayout::KERNEL_START ? Paging::USER_ACCESS : 0));
     }
 
     return virtualStartAddress;
@@ -313,23 +359,30 @@ VirtualAddressSpace& MemoryService::createAddressSpace() {
     auto addressSpace = new VirtualAddressSpace(kernelAddressSpace.getPageDirectory());
     addressSpaces.add(addressSpace);
 
+    // The time page is shared by all address spaces and must not be freed, when a process exits
+    auto timePageAddress = System::getService<TimeService>().getTimePagePhysicalAddress();
+    addressSpace->getPageDirectory().map(timePageAddress, Util::USER_SPACE_TIME_PAGE_ADDRESS, Paging::PRESENT | Paging::USER_ACCESS | Paging::DO_NOT_UNMAP);
+
     return *addressSpace;
 }
 
 void MemoryService::switchAddressSpace(VirtualAddressSpace &addressSpace) {
-    if (currentAddressSpace == &addressSpace) {
+    if (CpuLocal::currentAddressSpace.get() == &addressSpace) {
         return;
     }
 
     // Set current address space
-    currentAddressSpace = &addressSpace;
+    CpuLocal::currentAddressSpace.set(&addressSpace);
     // load cr3-register with phys. address of Page Directory
     load_page_directory(addressSpace.getPageDirectory().getPageDirectoryPhysicalAddress());
 }
 
 void MemoryService::removeAddressSpace(VirtualAddressSpace &addressSpace) {
-    if (currentAddressSpace == &addressSpace) {
-        Util::Exception::throwException(Util::Exception::INVALID_ARGUMENT, "MemoryService: Trying to delete the currently active address space!");
+    for (uint32_t i = 0; i < 256; i++) {
+        const auto *cpuData = System::getPerCpuData(i);
+        if (cpuData != nullptr && cpuData->currentAddressSpace == &addressSpace) {
+            Util::Exception::throwException(Util::Exception::INVALID_ARGUMENT, "MemoryService: Trying to delete an active address space!");
+        }
     }
 
     addressSpaces.remove(&addressSpace);
@@ -337,11 +390,12 @@ void MemoryService::removeAddressSpace(VirtualAddressSpace &addressSpace) {
 }
 
 void* MemoryService::getPhysicalAddress(void *virtualAddress) {
-    return currentAddressSpace->getPageDirectory().getPhysicalAddress(virtualAddress);
+    return getCurrentAddressSpace().getPageDirectory().getPhysicalAddress(virtualAddress);
 }
 
 void MemoryService::plugin() {
     System::getService<Kernel::InterruptService>().assignInterrupt(InterruptVector::PAGE_FAULT, *this);
+    tlbShootdownHandler.plugin();
 }
 
 void MemoryService::trigger(const Kernel::InterruptFrame &frame) {
@@ -349,12 +403,31 @@ void MemoryService::trigger(const Kernel::InterruptFrame &frame) {
     uint32_t faultAddress = 0;
     // The faulted linear address is loaded in the cr2 register
     asm volatile ("mov %%cr2, %0" : "=r" (faultAddress));
+    Trace::tracepoint(Trace::PAGE_FAULT, faultAddress, frame.error);
 
     // There should be no access to the first page (address 0)
     if (faultAddress == 0) {
         Util::Exception::throwException(Util::Exception::NULL_POINTER, "Page fault at address 0x00000000!");
     }
 
+    auto *currentThread = CpuLocal::currentThread.get();
+    if (currentThread != nullptr) {
+        currentThread->countPageFault();
+    }
+
+    // Segments of executables are loaded on first access
+    if (currentThread != nullptr && faultAddress < Kernel::MemoryLayout::KERNEL_START && currentThread->getParent().isFileBacked(faultAddress)) {
+        auto &process = currentThread->getParent();
+        auto write = (frame.error & 0x00000002u) > 0;
+        if (process.isFileBackedPageZeroFilled(faultAddress & 0xfffff000)) {
+            mapZeroFilledPage(process, faultAddress, write);
+        } else {
+            loadFileBackedPage(process, faultAddress, write);
+        }
+
+        return;
+    }
+
     // check if page fault was caused by illegal page access
     if ((frame.error & 0x00000001u) > 0) {
         Util::Exception::throwException(Util::Exception::ILLEGAL_PAGE_ACCESS, "Privilege level not sufficient to access page!");
@@ -362,9 +435,108 @@ void MemoryService::trigger(const Kernel::InterruptFrame &frame) {
 
     // Map the faulted Page
     map(faultAddress, Paging::PRESENT | Paging::READ_WRITE | (faultAddress < Kernel::MemoryLayout::KERNEL_START ? Paging::USER_ACCESS : 0), true);
+
     // TODO: Check other Faults
 }
 
+void MemoryService::loadFileBackedPage(Process &process, uint32_t faultAddress, bool write) {
+    auto pageAddress = faultAddress & 0xfffff000;
+    auto &pageDirectory = getCurrentAddressSpace().getPageDirectory();
+    auto &lock = process.getFileBackedRegionLock();
+    auto readOnly = process.isFileBackedPageReadOnly(pageAddress);
+
+    lock.acquire();
+
+    // Another thread may have loaded the page in the meantime -> Just retry the access
+    if (pageDirectory.getPhysicalAddress(reinterpret_cast<void*>(pageAddress)) != nullptr) {
+        lock.release();
+        if (write && readOnly) {
+            Util::Exception::throwException(Util::Exception::ILLEGAL_PAGE_ACCESS, "Write access to read-only page!");
+        }
+
+        return;
+    }
+
+    // Read-only pages (text and rodata) are shared with other processes running the same executable
+    auto *sharedImage = readOnly ? process.getSharedImage() : nullptr;
+    if (sharedImage != nullptr) {
+        auto physicalAddress = sharedImage->getFrame(pageAddress);
+        if (physicalAddress != 0) {
+            mapPhysicalAddress(pageAddress, physicalAddress, Paging::PRESENT | Paging::USER_ACCESS);
+            lock.release();
+            return;
+        }
+    }
+
+    // User threads must not access the page, until it has been filled completely
+    map(pageAddress, Paging::PRESENT | Paging::READ_WRITE);
+    Util::Address<uint32_t>(pageAddress).setRange(0, Paging::PAGESIZE);
+    process.loadFileBackedPage(pageAddress);
+
+    if (readOnly) {
+        pageDirectory.unsetPageFlags(pageAddress, Paging::READ_WRITE);
+        if (sharedImage != nullptr) {
+            sharedImage->addFrame(pageAddress, reinterpret_cast<uint32_t>(pageDirectory.getPhysicalAddress(reinterpret_cast<void*>(pageAddress))));
+        }
+    }
+
+    pageDirectory.setPageFlags(pageAddress, Paging::USER_ACCESS);
+    asm volatile ("invlpg (%0)" : : "r"(pageAddress) : "memory");
+
+    lock.release();
+}
+
+void MemoryService::mapZeroFilledPage(Process &process, uint32_t faultAddress, bool write) {
+    auto pageAddress = faultAddress & 0xfffff000;
+    auto &pageDirectory = getCurrentAddressSpace().getPageDirectory();
+    auto readOnly = process.isFileBackedPageReadOnly(pageAddress);
+
+    // Another CPU has mapped the page in the meantime (or holds the page table lock) -> Just retry the access
+    // User threads must not access the page, until it has been filled completely
+    if (!map(pageAddress, Paging::PRESENT | Paging::READ_WRITE, true)) {
+        if (write && readOnly && pageDirectory.getPhysicalAddress(reinterpret_cast<void*>(pageAddress)) != nullptr) {
+            Util::Exception::throwException(Util::Exception::ILLEGAL_PAGE_ACCESS, "Write access to read-only page!");
+        }
+
+        return;
+    }
+
+    Util::Address<uint32_t>(pageAddress).setRange(0, Paging::PAGESIZE);
+    if (readOnly) {
+        pageDirectory.unsetPageFlags(pageAddress, Paging::READ_WRITE);
+    }
+
+    pageDirectory.setPageFlags(pageAddress, Paging::USER_ACCESS);
+    asm volatile ("invlpg (%0)" : : "r"(pageAddress) : "memory");
+}
+
+void MemoryService::loadFileBackedPages(const void *buffer, uint64_t length) {
+    auto *currentThread = CpuLocal::currentThread.get();
+    auto startAddress = reinterpret_cast<uint32_t>(buffer);
+    if (currentThread == nullptr || length == 0 || startAddress >= Kernel::MemoryLayout::KERNEL_START) {
+        return;
+    }
+
+    auto &process = currentThread->getParent();
+    auto &pageDirectory = getCurrentAddressSpace().getPageDirectory();
+    auto endAddress = length < Kernel::MemoryLayout::KERNEL_START - startAddress ? startAddress + static_cast<uint32_t>(length) : Kernel::MemoryLayout::KERNEL_START;
+    for (auto pageAddress = startAddress & 0xfffff000; pageAddress < endAddress; pageAddress += Paging::PAGESIZE) {
+        // User access is granted last, so a page with this flag has been filled completely
+        if (!process.isFileBacked(pageAddress) || (pageDirectory.getPageFlags(pageAddress) & Paging::USER_ACCESS) != 0) {
+            continue;
+        }
+
+        if (process.isFileBackedPageZeroFilled(pageAddress)) {
+            // Another CPU may still be filling the page with zeros -> Retry, until user threads may access it
+            while ((pageDirectory.getPageFlags(pageAddress) & Paging::USER_ACCESS) == 0) {
+                mapZeroFilledPage(process, pageAddress, false);
+            }
+        } else {
+            loadFileBackedPage(process, pageAddress, false);
+        }
+    }
+}
+
 MemoryService::MemoryStatus MemoryService::getMemoryStatus() {
     return {pageFrameAllocator.getTotalMemory(), pageFrameAllocator.getFreeMemory(),
             lowerMemoryManager.getTotalMemory(), lowerMemoryManager.getFreeMemory(),
@@ -377,7 +549,15 @@ VirtualAddressSpace& MemoryService::getKernelAddressSpace() const {
 }
 
 VirtualAddressSpace &MemoryService::getCurrentAddressSpace() const {
-    return *currentAddressSpace;
+    return *CpuLocal::currentAddressSpace.get();
+}
+
+VirtualAddressSpace &MemoryService::getCurrentAddressSpace(uint8_t cpuId) const {
+    return *System::getPerCpuData(cpuId)->currentAddressSpace;
+}
+
+TlbShootdownHandler &MemoryService::getTlbShootdownHandler() {
+    return tlbShootdownHandler;
 }
 
 }
\ No newline at end of file
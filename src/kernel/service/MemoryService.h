@@ -25,11 +25,13 @@
 #include "lib/util/collection/ArrayList.h"
 #include "lib/util/base/FreeListMemoryManager.h"
 #include "kernel/paging/VirtualAddressSpace.h"
+#include "kernel/paging/TlbShootdownHandler.h"
 
 namespace Kernel {
 class PageDirectory;
 class PageFrameAllocator;
 class PagingAreaManager;
+class Process;
 struct InterruptFrame;
 }  // namespace Kernel
 
@@ -120,6 +122,13 @@ public:
      */
     void mapPhysicalAddress(uint32_t virtualAddress, uint32_t physicalAddress, uint16_t flags);
 
+    /**
+     * Increment the use count of an allocated page frame, so that it is not freed, before releasePageFrame() has been called.
+     */
+    void referencePageFrame(uint32_t physicalAddress);
+
+    void releasePageFrame(uint32_t physicalAddress);
+
     /**
      * Map a range of virtual addresses into the current Page Directory.
      *
@@ -134,8 +143,10 @@ public:
      *
      * @param virtualAddress Virtual address where a page should be mapped
      * @param flags Flags for Page Table Entry
+     * @param interrupt If true, the page is not mapped if another CPU holds the page table lock or has already mapped the page (see PageDirectory::map())
+     * @return true, if the page has been mapped
      */
-    void map(uint32_t virtualAddress, uint16_t flags, bool interrupt = false);
+    bool map(uint32_t virtualAddress, uint16_t flags, bool interrupt = false);
 
     /**
      * Map a physical address into the current address space's heap.
@@ -223,23 +234,62 @@ public:
      */
     void trigger(const Kernel::InterruptFrame &frame) override;
 
+    /**
+     * Load the pages of the current process' file backed regions, that overlap a user buffer and have not been accessed yet.
+     * Called for the arguments of each system call (see SystemCall::invoke()) and before an I/O ring operation is executed.
+     * Otherwise, a page fault inside a filesystem or device driver would read the page from the filesystem, while the driver's
+     * and the filesystem's locks are already held.
+     */
+    void loadFileBackedPages(const void *buffer, uint64_t length);
+
     [[nodiscard]] VirtualAddressSpace& getKernelAddressSpace() const;
 
     [[nodiscard]] VirtualAddressSpace& getCurrentAddressSpace() const;
 
+    [[nodiscard]] VirtualAddressSpace& getCurrentAddressSpace(uint8_t cpuId) const;
+
+    [[nodiscard]] TlbShootdownHandler& getTlbShootdownHandler();
+
     MemoryStatus getMemoryStatus();
 
     static const constexpr uint8_t SERVICE_ID = 2;
 
 private:
 
+    static const constexpr uint32_t UNMAP_BATCH_SIZE = 64;
+
+    /**
+     * Map and fill a page of a file backed region (e.g. a segment of an executable), that has been accessed for the first time.
+     * Reads from the filesystem and may block, so it must not be reached while filesystem or driver locks are held (see loadFileBackedPages()).
+     */
+    void loadFileBackedPage(Process &process, uint32_t faultAddress, bool write);
+
+    /**
+     * Map a page of a file backed region, that does not contain any file data (e.g. BSS), filled with zeros.
+     * Neither takes the process' file backed region lock nor reads from the filesystem, so it is safe in any context.
+     */
+    void mapZeroFilledPage(Process &process, uint32_t faultAddress, bool write);
+
+    /**
+     * Unmap a page from the current address space, without invalidating it in the TLBs of other CPUs.
+     * The page frame is not freed, since other CPUs may still access it, until the TLB shootdown has finished.
+     *
+     * @return The physical address of the unmapped page frame (or 0, if the page was not mapped)
+     */
+    uint32_t unmapLocal(uint32_t virtualAddress);
+
+    /**
+     * Invalidate a range of unmapped pages on all CPUs and free their page frames afterwards.
+     */
+    void freeUnmappedFrames(uint32_t virtualStartAddress, uint32_t virtualEndAddress, const uint32_t *frames, uint32_t frameCount);
+
     Util::FreeListMemoryManager lowerMemoryManager;
+    TlbShootdownHandler tlbShootdownHandler;
 
     PageFrameAllocator &pageFrameAllocator;
     PagingAreaManager &pagingAreaManager;
 
     Util::ArrayList<VirtualAddressSpace*> addressSpaces;
-    VirtualAddressSpace *currentAddressSpace;
     VirtualAddressSpace &kernelAddressSpace;
 };
 
@@ -77,16 +77,11 @@ NetworkService::NetworkService() {
             return false;
         }
 
-        auto &filesystemService = System::getService<FilesystemService>();
+        auto &networkService = System::getService<NetworkService>();
         auto fileDescriptor = va_arg(arguments, int32_t);
         auto &datagram = *va_arg(arguments, Util::Network::Datagram*);
 
-        auto &socket = reinterpret_cast<Network::Socket&>(filesystemService.getNode(fileDescriptor));
-        if (!socket.isBound()) {
-            Util::Exception::throwException(Util::Exception::ILLEGAL_STATE, "Socket: Not yet bound!");
-        }
-
-        return socket.send(datagram);
+        return networkService.sendDatagram(fileDescriptor, datagram);
     });
 
     SystemCall::registerSystemCall(Util::System::RECEIVE_DATAGRAM, [](uint32_t paramCount, va_list arguments) -> bool {
@@ -94,33 +89,11 @@ NetworkService::NetworkService() {
             return false;
         }
 
-        auto &filesystemService = System::getService<FilesystemService>();
-        auto &memoryService = System::getService<MemoryService>();
+        auto &networkService = System::getService<NetworkService>();
         auto fileDescriptor = va_arg(arguments, int32_t);
         auto &datagram = *va_arg(arguments, Util::Network::Datagram*);
 
-        auto &socket = reinterpret_cast<Network::Socket &>(filesystemService.getNode(fileDescriptor));
-        if (!socket.isBound()) {
-            Util::Exception::throwException(Util::Exception::ILLEGAL_STATE, "Socket: Not yet bound!");
-        }
-
-        auto *kernelDatagram = socket.receive();
-        if (kernelDatagram == nullptr) {
-            return false;
-        }
-
-        auto *datagramBuffer = reinterpret_cast<uint8_t*>(memoryService.allocateUserMemory(kernelDatagram->getLength()));
-
-        auto source = Util::Address<uint32_t>(kernelDatagram->getData());
-        auto target = Util::Address<uint32_t>(datagramBuffer);
-        target.copyRange(source, kernelDatagram->getLength());
-
-        datagram.setData(datagramBuffer, kernelDatagram->getLength());
-        datagram.setRemoteAddress(kernelDatagram->getRemoteAddress());
-        datagram.setAttributes(*kernelDatagram);
-
-        delete kernelDatagram;
-        return true;
+        return networkService.receiveDatagram(fileDescriptor, datagram);
     });
 }
 
@@ -186,6 +159,45 @@ Network::NetworkStack &NetworkService::getNetworkStack() {
     return networkStack;
 }
 
+bool NetworkService::sendDatagram(int32_t fileDescriptor, const Util::Network::Datagram &datagram) {
+    auto &filesystemService = System::getService<FilesystemService>();
+    auto &socket = reinterpret_cast<Network::Socket&>(filesystemService.getNode(fileDescriptor));
+    if (!socket.isBound()) {
+        Util::Exception::throwException(Util::Exception::ILLEGAL_STATE, "Socket: Not yet bound!");
+    }
+
+    return socket.send(datagram);
+}
+
+bool NetworkService::receiveDatagram(int32_t fileDescriptor, Util::Network::Datagram &datagram) {
+    auto &filesystemService = System::getService<FilesystemService>();
+    auto &memoryService = System::getService<MemoryService>();
+
+    auto &socket = reinterpret_cast<Network::Socket &>(filesystemService.getNode(fileDescriptor));
+    if (!socket.isBound()) {
+        Util::Exception::throwException(Util::Exception::ILLEGAL_STATE, "Socket: Not yet bound!");
+    }
+
+    auto *kernelDatagram = socket.receive();
+    if (kernelDatagram == nullptr) {
+        return false;
+    }
+
+    // The datagram is handed over to the calling process, so its data must reside in the process's memory
+    auto *datagramBuffer = reinterpret_cast<uint8_t*>(memoryService.allocateUserMemory(kernelDatagram->getLength()));
+
+    auto source = Util::Address<uint32_t>(kernelDatagram->getData());
+    auto target = Util::Address<uint32_t>(datagramBuffer);
+    target.copyRange(source, kernelDatagram->getLength());
+
+    datagram.setData(datagramBuffer, kernelDatagram->getLength());
+    datagram.setRemoteAddress(kernelDatagram->getRemoteAddress());
+    datagram.setAttributes(*kernelDatagram);
+
+    delete kernelDatagram;
+    return true;
+}
+
 int32_t NetworkService::createSocket(Util::Network::Socket::Type socketType) {
     Filesystem::Node *socket;
     switch (socketType) {
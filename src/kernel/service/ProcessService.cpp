@@ -24,6 +24,8 @@
 #include "FilesystemService.h"
 #include "kernel/file/FileDescriptorManager.h"
 #include "kernel/process/Process.h"
+#include "kernel/process/IoRing.h"
+#include "kernel/process/SystemCallTrace.h"
 #include "kernel/process/Thread.h"
 #include "kernel/service/MemoryService.h"
 #include "kernel/service/SchedulerService.h"
@@ -57,8 +59,9 @@ ProcessService::ProcessService() : kernelProcess(createProcess(System::getServic
         auto *command = va_arg(arguments, const Util::String*);
         auto *commandArguments = va_arg(arguments, Util::Array<Util::String>*);
         auto &processId = *va_arg(arguments, uint32_t*);
+        auto traceSystemCalls = paramCount > 7 && va_arg(arguments, int) != 0;
 
-        auto &process = processService.loadBinary(*binaryFile, *inputFile, *outputFile, *errorFile, *command, *commandArguments);
+        auto &process = processService.loadBinary(*binaryFile, *inputFile, *outputFile, *errorFile, *command, *commandArguments, traceSystemCalls);
 
         processId = process.getId();
         return true;
@@ -84,12 +87,13 @@ ProcessService::ProcessService() : kernelProcess(createProcess(System::getServic
         auto &processService = System::getService<ProcessService>();
         auto processId = va_arg(arguments, uint32_t);
 
-        auto *process = processService.getProcess(processId);
+        auto *process = processService.acquireProcess(processId);
         if (process == nullptr) {
             return false;
         }
 
         process->join();
+        process->removeReference();
         return true;
     });
 
@@ -101,12 +105,67 @@ ProcessService::ProcessService() : kernelProcess(createProcess(System::getServic
         auto &processService = System::getService<ProcessService>();
         auto processId = va_arg(arguments, int32_t);
 
-        auto *process = processService.getProcess(processId);
+        auto *process = processService.acquireProcess(processId);
         if (process == nullptr) {
             return false;
         }
 
         processService.killProcess(*process);
+        process->removeReference();
+        return true;
+    });
+
+    SystemCall::registerSystemCall(Util::System::CREATE_IO_RING, [](uint32_t paramCount, va_list arguments) -> bool {
+        if (paramCount < 1) {
+            return false;
+        }
+
+        auto &processService = System::getService<ProcessService>();
+        auto &rings = *va_arg(arguments, Util::Io::IoRing::Rings*);
+
+        return processService.createIoRing(rings);
+    });
+
+    SystemCall::registerSystemCall(Util::System::ENTER_IO_RING, [](uint32_t paramCount, va_list arguments) -> bool {
+        if (paramCount < 3) {
+            return false;
+        }
+
+        auto &processService = System::getService<ProcessService>();
+        auto &rings = *va_arg(arguments, Util::Io::IoRing::Rings*);
+        auto minCompletions = va_arg(arguments, uint32_t);
+        auto &availableCompletions = *va_arg(arguments, uint32_t*);
+
+        availableCompletions = processService.enterIoRing(rings, minCompletions);
+        return true;
+    });
+
+    SystemCall::registerSystemCall(Util::System::DESTROY_IO_RING, [](uint32_t paramCount, va_list arguments) -> bool {
+        if (paramCount < 1) {
+            return false;
+        }
+
+        auto &processService = System::getService<ProcessService>();
+        auto &rings = *va_arg(arguments, Util::Io::IoRing::Rings*);
+
+        processService.destroyIoRing(rings);
+        return true;
+    });
+
+    SystemCall::registerSystemCall(Util::System::READ_SYSTEM_CALL_TRACE, [](uint32_t paramCount, va_list arguments) -> bool {
+        if (paramCount < 6) {
+            return false;
+        }
+
+        auto &processService = System::getService<ProcessService>();
+        auto processId = va_arg(arguments, uint32_t);
+        auto *buffer = va_arg(arguments, Util::Async::SystemCallRecord*);
+        auto count = va_arg(arguments, uint32_t);
+        auto &droppedRecords = *va_arg(arguments, uint32_t*);
+        auto &finished = *va_arg(arguments, bool*);
+        auto &read = *va_arg(arguments, uint32_t*);
+
+        read = processService.readSystemCallTrace(processId, buffer, count, droppedRecords, finished);
         return true;
     });
 }
@@ -123,16 +182,22 @@ Process& ProcessService::createProcess(VirtualAddressSpace &addressSpace, const
 
     lock.acquire();
     processList.add(process);
+    processTable.put(process->getId(), *process);
     lock.release();
 
     return *process;
 }
 
-Process& ProcessService::loadBinary(const Util::Io::File &binaryFile, const Util::Io::File &inputFile, const Util::Io::File &outputFile, const Util::Io::File &errorFile, const Util::String &command, const Util::Array<Util::String> &arguments) {
+Process& ProcessService::loadBinary(const Util::Io::File &binaryFile, const Util::Io::File &inputFile, const Util::Io::File &outputFile, const Util::Io::File &errorFile, const Util::String &command, const Util::Array<Util::String> &arguments, bool traceSystemCalls) {
     auto &memoryService = Kernel::System::getService<Kernel::MemoryService>();
 
     auto &virtualAddressSpace = memoryService.createAddressSpace();
     auto &process = createProcess(virtualAddressSpace, binaryFile.getCanonicalPath(), Util::Io::File::getCurrentWorkingDirectory(), inputFile, outputFile, errorFile);
+    if (traceSystemCalls) {
+        auto *trace = new SystemCallTrace(process.getId());
+        process.setSystemCallTrace(*trace);
+        getCurrentProcess().addTracedProcess(*trace);
+    }
     auto &thread = Kernel::Thread::createKernelThread("Loader", process, new Kernel::BinaryLoader(binaryFile.getCanonicalPath(), command, arguments));
 
     System::getService<SchedulerService>().ready(thread);
@@ -145,11 +210,9 @@ void ProcessService::killProcess(Process &process) {
     }
 
     auto &schedulerService = System::getService<SchedulerService>();
-    schedulerService.lockScheduler();
     for (auto *thread : process.getThreads()) {
-        schedulerService.killWithoutLock(*thread);
+        schedulerService.kill(*thread);
     }
-    schedulerService.unlockScheduler();
 
     auto &cleanerThread = Thread::createKernelThread("Address-Space-Cleaner", process, new AddressSpaceCleaner());
     schedulerService.ready(cleanerThread);
@@ -157,6 +220,7 @@ void ProcessService::killProcess(Process &process) {
 
     lock.acquire();
     processList.remove(&process);
+    processTable.remove(process.getId());
     lock.release();
 }
 
@@ -165,13 +229,7 @@ Process& ProcessService::getCurrentProcess() {
 }
 
 bool ProcessService::isProcessActive(uint32_t id) {
-    for (const auto *process : processList) {
-        if (process->getId() == id) {
-            return true;
-        }
-    }
-
-    return false;
+    return processTable.get(id) != nullptr;
 }
 
 void ProcessService::exitCurrentProcess(int32_t exitCode) {
@@ -186,6 +244,7 @@ void ProcessService::exitCurrentProcess(int32_t exitCode) {
 
     lock.acquire();
     processList.remove(&process);
+    processTable.remove(process.getId());
     lock.release();
 
     schedulerService.exitCurrentThread();
@@ -193,14 +252,8 @@ void ProcessService::exitCurrentProcess(int32_t exitCode) {
     __builtin_unreachable();
 }
 
-Process* ProcessService::getProcess(uint32_t id) {
-    for (auto *process : processList) {
-        if (process->getId() == id) {
-            return process;
-        }
-    }
-
-    return nullptr;
+Process* ProcessService::acquireProcess(uint32_t id) {
+    return processTable.acquire(id);
 }
 
 Process& ProcessService::getKernelProcess() const {
@@ -216,4 +269,59 @@ Util::Array<uint32_t> ProcessService::getActiveProcessIds() const {
     return ids;
 }
 
-}
\ No newline at end of file
+ImageCache& ProcessService::getImageCache() {
+    return imageCache;
+}
+
+bool ProcessService::createIoRing(Util::Io::IoRing::Rings &rings) {
+    // The capacity must be a power of two, since the ring indices are masked
+    if (rings.capacity == 0 || (rings.capacity & (rings.capacity - 1)) != 0) {
+        return false;
+    }
+
+    auto &process = getCurrentProcess();
+    if (process.getIoRing(rings) != nullptr) {
+        return false;
+    }
+
+    auto *ring = new IoRing(process, rings);
+    process.addIoRing(*ring);
+    ring->start();
+
+    return true;
+}
+
+uint32_t ProcessService::enterIoRing(Util::Io::IoRing::Rings &rings, uint32_t minCompletions) {
+    auto *ring = getCurrentProcess().getIoRing(rings);
+    return ring == nullptr ? 0 : ring->enter(minCompletions);
+}
+
+void ProcessService::destroyIoRing(Util::Io::IoRing::Rings &rings) {
+    auto *ring = getCurrentProcess().removeIoRing(rings);
+    if (ring != nullptr) {
+        ring->stop();
+        delete ring;
+    }
+}
+
+uint32_t ProcessService::readSystemCallTrace(uint32_t processId, Util::Async::SystemCallRecord *buffer, uint32_t count, uint32_t &droppedRecords, bool &finished) {
+    auto &process = getCurrentProcess();
+    auto *trace = process.getTracedProcess(processId);
+    if (trace == nullptr) {
+        droppedRecords = 0;
+        finished = true;
+        return 0;
+    }
+
+    auto read = trace->read(buffer, count, droppedRecords, finished);
+    if (finished) {
+        process.removeTracedProcess(*trace);
+        if (trace->detachTracer()) {
+            delete trace;
+        }
+    }
+
+    return read;
+}
+
+}
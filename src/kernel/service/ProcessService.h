@@ -26,8 +26,13 @@
 #include "lib/util/collection/ArrayList.h"
 #include "lib/util/base/String.h"
 #include "kernel/process/Process.h"
+#include "kernel/process/IdTable.h"
+#include "kernel/process/ImageCache.h"
 
 namespace Util {
+namespace Async {
+struct SystemCallRecord;
+}  // namespace Async
 namespace Io {
 class File;
 }  // namespace File
@@ -61,7 +66,11 @@ public:
 
     Process& createProcess(VirtualAddressSpace &addressSpace, const Util::String &name, const Util::Io::File &workingDirectory, const Util::Io::File &standardIn, const Util::Io::File &standardOut, const Util::Io::File &standardError);
 
-    Process& loadBinary(const Util::Io::File &binaryFile, const Util::Io::File &inputFile, const Util::Io::File &outputFile, const Util::Io::File &errorFile, const Util::String &command, const Util::Array<Util::String> &arguments);
+    /**
+     * Start a process running the given binary. If traceSystemCalls is set, the system calls of the new process are recorded
+     * and can be read by the calling process via readSystemCallTrace().
+     */
+    Process& loadBinary(const Util::Io::File &binaryFile, const Util::Io::File &inputFile, const Util::Io::File &outputFile, const Util::Io::File &errorFile, const Util::String &command, const Util::Array<Util::String> &arguments, bool traceSystemCalls = false);
 
     void killProcess(Process &process);
 
@@ -71,18 +80,48 @@ public:
 
     [[nodiscard]] Process& getCurrentProcess();
 
-    [[nodiscard]] Process* getProcess(uint32_t id);
+    /**
+     * Look up a process and take a reference on it, which must be released with removeReference().
+     * The process is not freed in the meantime, even if it exits.
+     */
+    [[nodiscard]] Process* acquireProcess(uint32_t id);
 
     [[nodiscard]] Process& getKernelProcess() const;
 
     [[nodiscard]] Util::Array<uint32_t> getActiveProcessIds() const;
 
+    [[nodiscard]] ImageCache& getImageCache();
+
+    /**
+     * Set up an I/O ring for the current process, which uses the given rings in the process's memory.
+     *
+     * @return false, if the capacity is not a power of two or the rings are already in use
+     */
+    bool createIoRing(Util::Io::IoRing::Rings &rings);
+
+    uint32_t enterIoRing(Util::Io::IoRing::Rings &rings, uint32_t minCompletions);
+
+    /**
+     * Stop the workers of an I/O ring and delete it. Blocks, until all operations in flight have completed.
+     */
+    void destroyIoRing(Util::Io::IoRing::Rings &rings);
+
+    /**
+     * Read the recorded system calls of a process, that has been started by the current process with tracing enabled.
+     * Once the traced process has terminated and all records have been read, the trace is released.
+     *
+     * @return The number of records, written to the buffer (finished is set, if the process is not traced by the current process)
+     */
+    uint32_t readSystemCallTrace(uint32_t processId, Util::Async::SystemCallRecord *buffer, uint32_t count, uint32_t &droppedRecords, bool &finished);
+
     static const constexpr uint8_t SERVICE_ID = 7;
 
 private:
 
+    ImageCache imageCache;
     Util::ArrayList<Process*> processList;
-    Util::Async::Spinlock lock;
+    IdTable<Process> processTable;
+    Util::Async::Spinlock lock = Util::Async::Spinlock("process-service");
     Process &kernelProcess;
 };
 
@@ -26,6 +26,7 @@
 #include "kernel/process/Process.h"
 #include "kernel/process/SchedulerCleaner.h"
 #include "kernel/process/Thread.h"
+#include "kernel/service/InterruptService.h"
 #include "kernel/service/MemoryService.h"
 #include "kernel/system/SystemCall.h"
 #include "lib/util/async/Spinlock.h"
@@ -113,9 +114,10 @@ SchedulerService::SchedulerService() {
         auto &schedulerService = System::getService<SchedulerService>();
         auto threadId = va_arg(arguments, uint32_t);
 
-        auto *thread = schedulerService.getThread(threadId);
+        auto *thread = schedulerService.acquireThread(threadId);
         if (thread != nullptr) {
             thread->join();
+            thread->removeReference();
         }
 
         return true;
@@ -125,6 +127,34 @@ SchedulerService::SchedulerService() {
         System::getService<SchedulerService>().exitCurrentThread();
         return true;
     });
+
+    SystemCall::registerSystemCall(Util::System::SET_THREAD_PRIORITY, [](uint32_t paramCount, va_list arguments) -> bool {
+        if (paramCount < 2) {
+            return false;
+        }
+
+        auto &schedulerService = System::getService<SchedulerService>();
+        auto threadId = va_arg(arguments, uint32_t);
+        auto priority = va_arg(arguments, uint32_t);
+
+        if (priority > Util::Async::Thread::MAXIMUM) {
+            return false;
+        }
+
+        auto *thread = schedulerService.acquireThread(threadId);
+        if (thread == nullptr) {
+            return false;
+        }
+
+        // Processes may only change the priority of their own threads
+        auto ownThread = &thread->getParent() == &schedulerService.getCurrentThread().getParent();
+        if (ownThread) {
+            schedulerService.setPriority(*thread, priority);
+        }
+
+        thread->removeReference();
+        return ownThread;
+    });
 }
 
 void SchedulerService::kickoffThread() {
@@ -137,32 +167,50 @@ void SchedulerService::startScheduler() {
     cleaner = new Kernel::SchedulerCleaner();
     auto &schedulerCleanerThread = Kernel::Thread::createKernelThread("Scheduler-Cleaner", processService.getKernelProcess(), cleaner);
     ready(schedulerCleanerThread);
+
+    System::getService<InterruptService>().startWorkerThread();
     
     scheduler.start();
 }
 
+void SchedulerService::startApplicationProcessor() {
+    scheduler.startApplicationProcessor();
+}
+
 void SchedulerService::ready(Thread &thread) {
     scheduler.ready(thread);
 }
 
 void SchedulerService::lockScheduler() {
-    scheduler.lock.acquire();
+    scheduler.getCurrentRunQueue().lock.acquire();
 }
 
 void SchedulerService::unlockScheduler() {
-    scheduler.lock.release();
+    scheduler.getCurrentRunQueue().lock.release();
 }
 
 void SchedulerService::yield() {
     scheduler.yield();
 }
 
+void SchedulerService::idle() {
+    scheduler.idle();
+}
+
+void SchedulerService::tick() {
+    scheduler.tick();
+}
+
+void SchedulerService::setPriority(Thread &thread, uint8_t priority) {
+    scheduler.setPriority(thread, priority);
+}
+
 Thread& SchedulerService::getCurrentThread() {
     return scheduler.getCurrentThread();
 }
 
-Thread *SchedulerService::getThread(uint32_t id) {
-    return scheduler.getThread(id);
+Thread *SchedulerService::acquireThread(uint32_t id) {
+    return scheduler.acquireThread(id);
 }
 
 void SchedulerService::cleanup(Thread *thread) {
@@ -178,6 +226,10 @@ void SchedulerService::block() {
     scheduler.block();
 }
 
+bool SchedulerService::block(const Util::Time::Timestamp &timeout) {
+    return scheduler.block(timeout);
+}
+
 void SchedulerService::unblock(Thread &thread) {
     auto &processService = System::getService<ProcessService>();
     auto &process = thread.getParent();
@@ -192,10 +244,6 @@ void SchedulerService::kill(Thread &thread) {
     scheduler.kill(thread);
 }
 
-void SchedulerService::killWithoutLock(Thread &thread) {
-    scheduler.killWithoutLock(thread);
-}
-
 void SchedulerService::exitCurrentThread() {
     scheduler.exit();
 }
@@ -208,4 +256,28 @@ void SchedulerService::sleep(const Util::Time::Timestamp &time) {
     scheduler.sleep(time);
 }
 
+BlockCache& SchedulerService::getKernelStackCache() {
+    return kernelStackCache;
+}
+
+BlockCache& SchedulerService::getFpuContextCache() {
+    return fpuContextCache;
+}
+
+SamplingProfiler& SchedulerService::getProfiler() {
+    return profiler;
+}
+
+bool SchedulerService::isRunning(const Thread &thread) {
+    return scheduler.isRunning(thread);
+}
+
+bool SchedulerService::isFpuContextLoaded(const Thread &thread, uint8_t cpuId) const {
+    return fpu != nullptr && fpu->isContextLoaded(thread, cpuId);
+}
+
+Util::Array<Scheduler::CpuTime> SchedulerService::getCpuTimes() {
+    return scheduler.getCpuTimes();
+}
+
 }
\ No newline at end of file
@@ -21,6 +21,8 @@
 #include <cstdint>
 
 #include "kernel/process/Scheduler.h"
+#include "kernel/memory/BlockCache.h"
+#include "kernel/process/SamplingProfiler.h"
 #include "Service.h"
 
 namespace Device {
@@ -65,10 +67,18 @@ public:
 
     void startScheduler();
 
+    [[noreturn]] void startApplicationProcessor();
+
     void ready(Thread &thread);
 
     void yield();
 
+    void idle();
+
+    void tick();
+
+    void setPriority(Thread &thread, uint8_t priority);
+
     void cleanup(Thread *thread);
 
     void cleanup(Process *process);
@@ -79,22 +89,43 @@ public:
 
     void block();
 
+    /**
+     * Block the current thread, until it is unblocked or the timeout has passed.
+     * This allows waiting for an event (e.g. on a socket or pipe) without polling.
+     *
+     * @return true, if the thread has been unblocked, false if the timeout has passed
+     */
+    bool block(const Util::Time::Timestamp &timeout);
+
     void unblock(Thread &thread);
 
     void sleep(const Util::Time::Timestamp &time);
 
     void kill(Thread &thread);
 
-    void killWithoutLock(Thread &thread);
-
     void exitCurrentThread();
 
     [[nodiscard]] Thread& getCurrentThread();
 
-    [[nodiscard]] Thread* getThread(uint32_t id);
+    /**
+     * Look up a thread and take a reference on it, which must be released with removeReference() (see Scheduler::acquireThread()).
+     */
+    [[nodiscard]] Thread* acquireThread(uint32_t id);
 
     [[nodiscard]] uint8_t* getDefaultFpuContext();
 
+    [[nodiscard]] BlockCache& getKernelStackCache();
+
+    [[nodiscard]] BlockCache& getFpuContextCache();
+
+    [[nodiscard]] SamplingProfiler& getProfiler();
+
+    [[nodiscard]] bool isRunning(const Thread &thread);
+
+    [[nodiscard]] bool isFpuContextLoaded(const Thread &thread, uint8_t cpuId) const;
+
+    [[nodiscard]] Util::Array<Scheduler::CpuTime> getCpuTimes();
+
     static const constexpr uint8_t SERVICE_ID = 4;
 
 private:
@@ -104,6 +135,14 @@ private:
     Device::Fpu *fpu = nullptr;
     uint8_t *defaultFpuContext = nullptr;
 
+    // Recycle the resources of terminated threads, so that short-lived threads do not churn the kernel heap
+    BlockCache kernelStackCache = BlockCache(Thread::DEFAULT_STACK_SIZE, 16, RESOURCE_CACHE_CAPACITY);
+    BlockCache fpuContextCache = BlockCache(512, 16, RESOURCE_CACHE_CAPACITY);
+
+    SamplingProfiler profiler;
+
+    static const constexpr uint32_t RESOURCE_CACHE_CAPACITY = 32;
+
     static Logger log;
 };
 
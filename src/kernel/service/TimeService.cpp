@@ -22,9 +22,15 @@
 #include "kernel/system/SystemCall.h"
 #include "kernel/system/System.h"
 #include "device/time/DateProvider.h"
-#include "device/time/TimeProvider.h"
+#include "device/time/ClockSource.h"
 #include "kernel/service/SchedulerService.h"
 #include "lib/util/base/System.h"
+#include "lib/util/base/Address.h"
+#include "lib/util/hardware/CpuId.h"
+#include "kernel/service/MemoryService.h"
+#include "kernel/paging/Paging.h"
+#include "device/cpu/Cpu.h"
+#include "lib/util/math/Math.h"
 
 namespace Device {
 class Rtc;
@@ -32,7 +38,18 @@ class Rtc;
 
 namespace Kernel {
 
-TimeService::TimeService(Device::TimeProvider *timeProvider, Device::DateProvider *dateProvider) : timeProvider(timeProvider), dateProvider(dateProvider) {
+TimeService::TimeService(Device::ClockSource *clockSource, Device::DateProvider *dateProvider) : clockSource(clockSource), dateProvider(dateProvider),
+        timestampCounterAvailable(Util::Hardware::CpuId::isAvailable() && (Util::Hardware::CpuId::getCpuFeatureBits() & Util::Hardware::CpuId::TSC) != 0) {
+    // The time page is shared by all user address spaces and thus never freed
+    auto &memoryService = System::getService<MemoryService>();
+    timePage = static_cast<Util::Time::TimePage*>(memoryService.allocateKernelMemory(Paging::PAGESIZE, Paging::PAGESIZE));
+    Util::Address<uint32_t>(timePage).setRange(0, Paging::PAGESIZE);
+    timePagePhysicalAddress = reinterpret_cast<uint32_t>(memoryService.getPhysicalAddress(timePage));
+
+    if (clockSource != nullptr) {
+        clockSources.add(clockSource);
+    }
+
     SystemCall::registerSystemCall(Util::System::GET_SYSTEM_TIME, [](uint32_t paramCount, va_list arguments) -> bool {
         if (paramCount < 1) {
             return false;
@@ -71,16 +88,39 @@ TimeService::TimeService(Device::TimeProvider *timeProvider, Device::DateProvide
 }
 
 TimeService::~TimeService() {
-    delete timeProvider;
+    for (auto *source : clockSources) {
+        delete source;
+    }
+
     delete dateProvider;
 }
 
 Util::Time::Timestamp TimeService::getSystemTime() const {
-    if (timeProvider != nullptr) {
-        return timeProvider->getTime();
+    if (clockSource != nullptr) {
+        return clockSource->getTime();
+    }
+
+    Util::Exception::throwException(Util::Exception::ILLEGAL_STATE, "TimeService: No clock source available!");
+}
+
+bool TimeService::registerClockSource(Device::ClockSource *newClockSource) {
+    clockSources.add(newClockSource);
+    if (clockSource != nullptr && newClockSource->getRating() <= clockSource->getRating()) {
+        return false;
+    }
+
+    // The previous clock source keeps running (e.g. the PIT still drives the timer interrupt)
+    newClockSource->start(clockSource == nullptr ? Util::Time::Timestamp() : clockSource->getTime());
+    clockSource = newClockSource;
+    return true;
+}
+
+Device::ClockSource& TimeService::getClockSource() const {
+    if (clockSource == nullptr) {
+        Util::Exception::throwException(Util::Exception::ILLEGAL_STATE, "TimeService: No clock source available!");
     }
 
-    Util::Exception::throwException(Util::Exception::ILLEGAL_STATE, "TimeService: No time provider available!");
+    return *clockSource;
 }
 
 Util::Time::Date TimeService::getCurrentDate() const {
@@ -100,13 +140,89 @@ void TimeService::setCurrentDate(const Util::Time::Date &date) {
 }
 
 void TimeService::busyWait(const Util::Time::Timestamp &time) const {
-    auto end = getSystemTime().toMilliseconds() + time.toMilliseconds();
+    auto end = getSystemTime();
+    end.addSeconds(time.toSeconds());
+    end.addNanoseconds(time.getFraction());
 
-    while (getSystemTime().toMilliseconds() < end) {
+    while (getSystemTime() < end) {
         System::getService<SchedulerService>().yield();
     }
 }
 
+void TimeService::updateTimePage(uint32_t tickInterval) {
+    // Without a time stamp counter, the time can not be extrapolated -> User space keeps using the system call
+    if (!timestampCounterAvailable || !timePageLock.tryAcquire()) {
+        return;
+    }
+
+    // Publish the time of the current clock source, so that user space and kernel agree, even if the PIT is not used
+    auto time = getSystemTime();
+    auto cycles = Device::Cpu::readTimestampCounter();
+    if (!timePage->calibrated) {
+        calibrateTimestampCounter(time, cycles);
+    }
+
+    timePage->sequence++;
+    asm volatile ("" ::: "memory");
+
+    timePage->seconds = time.toSeconds();
+    timePage->fraction = time.getFraction();
+    timePage->cycles = cycles;
+    timePage->tickInterval = tickInterval;
+
+    asm volatile ("" ::: "memory");
+    timePage->sequence++;
+
+    timePageLock.release();
+}
+
+void TimeService::stopPeriodicTimePageUpdates() {
+    periodicTimePageUpdates = false;
+}
+
+bool TimeService::hasPeriodicTimePageUpdates() const {
+    return periodicTimePageUpdates;
+}
+
+void TimeService::calibrateTimestampCounter(const Util::Time::Timestamp &time, uint64_t cycles) {
+    // Without the periodic timer, the page may not have been updated for a long time -> Start again, so that the cycles fit into 32 bits
+    auto elapsedSeconds = time.toSeconds() - calibrationStartTime.toSeconds();
+    uint32_t elapsedTime = elapsedSeconds > 1 ? UINT32_MAX : elapsedSeconds * 1000000000 + time.getFraction() - calibrationStartTime.getFraction();
+    if (calibrationStartCycles == 0 || elapsedTime > 2 * CALIBRATION_INTERVAL) {
+        calibrationStartTime = time;
+        calibrationStartCycles = cycles;
+        return;
+    }
+
+    if (elapsedTime < CALIBRATION_INTERVAL) {
+        return;
+    }
+
+    auto elapsedCycles = static_cast<uint32_t>(cycles - calibrationStartCycles);
+    if (elapsedCycles == 0) {
+        // The time stamp counter does not run
+        timestampCounterAvailable = false;
+        return;
+    }
+
+    uint32_t remainder;
+    auto nanosecondsPerCycle = Util::Math::divide(static_cast<uint64_t>(elapsedTime) << 32, elapsedCycles, remainder);
+
+    timePage->sequence++;
+    asm volatile ("" ::: "memory");
+
+    timePage->nanosecondsPerCycle = static_cast<uint32_t>(nanosecondsPerCycle >> 32);
+    timePage->nanosecondsPerCycleFraction = static_cast<uint32_t>(nanosecondsPerCycle);
+    timePage->calibrated = true;
+
+    asm volatile ("" ::: "memory");
+    timePage->sequence++;
+}
+
+uint32_t TimeService::getTimePagePhysicalAddress() const {
+    return timePagePhysicalAddress;
+}
+
 Device::Rtc *TimeService::getRtc() {
     return reinterpret_cast<Device::Rtc *>(dateProvider);
 }
@@ -21,12 +21,15 @@
 #include <cstdint>
 
 #include "Service.h"
+#include "lib/util/collection/ArrayList.h"
 #include "lib/util/time/Date.h"
 #include "lib/util/time/Timestamp.h"
+#include "lib/util/time/TimePage.h"
+#include "lib/util/async/Spinlock.h"
 
 namespace Device {
+class ClockSource;
 class DateProvider;
-class TimeProvider;
 class Rtc;
 }  // namespace Device
 
@@ -38,7 +41,7 @@ public:
     /**
      * Constructor.
      */
-    TimeService(Device::TimeProvider *timeProvider, Device::DateProvider *dateProvider);
+    TimeService(Device::ClockSource *clockSource, Device::DateProvider *dateProvider);
 
     /**
      * Copy Constructor.
@@ -63,14 +66,56 @@ public:
 
     void busyWait(const Util::Time::Timestamp &time) const;
 
+    /**
+     * Use another clock source for the system time, if it has a higher rating than the current one.
+     * The new clock source continues at the current system time. Clock sources are owned by the time service.
+     *
+     * @return true, if the clock source is used from now on
+     */
+    bool registerClockSource(Device::ClockSource *clockSource);
+
+    [[nodiscard]] Device::ClockSource& getClockSource() const;
+
+    /**
+     * Publish the current system time on the time page, which is mapped into every user address space.
+     * Called by the periodic timer, or by the scheduler in tickless mode. If another CPU is updating the page, nothing is done.
+     *
+     * @param tickInterval The maximum time in nanoseconds until the next update, while user threads are running
+     */
+    void updateTimePage(uint32_t tickInterval);
+
+    /**
+     * Called in tickless mode, when the PIT has been stopped.
+     * From now on, the scheduler publishes the time, whenever it arms a CPU's timer for a running thread.
+     */
+    void stopPeriodicTimePageUpdates();
+
+    [[nodiscard]] bool hasPeriodicTimePageUpdates() const;
+
+    [[nodiscard]] uint32_t getTimePagePhysicalAddress() const;
+
     static const constexpr uint8_t SERVICE_ID = 6;
 
     Device::Rtc* getRtc();
 
 private:
 
-    Device::TimeProvider *timeProvider;
+    void calibrateTimestampCounter(const Util::Time::Timestamp &time, uint64_t cycles);
+
+    Device::ClockSource *clockSource;
     Device::DateProvider *dateProvider;
+    Util::ArrayList<Device::ClockSource*> clockSources;
+
+    Util::Time::TimePage *timePage;
+    uint32_t timePagePhysicalAddress;
+    bool timestampCounterAvailable;
+    bool periodicTimePageUpdates = true;
+    Util::Async::Spinlock timePageLock = Util::Async::Spinlock("time-page");
+
+    Util::Time::Timestamp calibrationStartTime{};
+    uint64_t calibrationStartCycles = 0;
+
+    static const constexpr uint32_t CALIBRATION_INTERVAL = 100000000; // 100 ms
 };
 
 }
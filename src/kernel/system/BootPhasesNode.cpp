@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "BootPhasesNode.h"
+
+#include "kernel/system/System.h"
+
+namespace Kernel {
+
+BootPhasesNode::BootPhasesNode(const Util::String &name) : StringNode(name) {}
+
+Util::String BootPhasesNode::getString() {
+    Util::String result;
+    for (uint32_t i = 0; i < System::getBootPhaseCount(); i++) {
+        const auto &phase = System::getBootPhase(i);
+        result += Util::String(phase.name) + ": cycles=";
+        result += phase.endCycles == 0 ? "running" : Util::String::toDecimalString(phase.endCycles - phase.startCycles);
+
+        if (phase.startTime > 0 && phase.endCycles != 0) {
+            result += Util::String::format(", start=%u us, duration=%u us", phase.startTime, phase.endTime - phase.startTime);
+        }
+
+        result += "\n";
+    }
+
+    return result;
+}
+
+}
@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_BOOTPHASESNODE_H
+#define HHUOS_BOOTPHASESNODE_H
+
+#include "filesystem/memory/StringNode.h"
+#include "lib/util/base/String.h"
+
+namespace Kernel {
+
+/**
+ * Lists the initialization phases recorded by Kernel::System in the order they have been started.
+ * Phases running in parallel overlap. Durations in microseconds are only known for phases,
+ * that started after the time service has been registered.
+ */
+class BootPhasesNode : public Filesystem::Memory::StringNode {
+
+public:
+    /**
+     * Constructor.
+     */
+    explicit BootPhasesNode(const Util::String &name);
+
+    /**
+     * Copy Constructor.
+     */
+    BootPhasesNode(const BootPhasesNode &copy) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    BootPhasesNode& operator=(const BootPhasesNode &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~BootPhasesNode() override = default;
+
+    /**
+     * Overriding function from StringNode.
+     */
+    Util::String getString() override;
+};
+
+}
+
+#endif
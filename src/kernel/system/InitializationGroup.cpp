@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "InitializationGroup.h"
+
+#include "kernel/process/Thread.h"
+#include "kernel/service/ProcessService.h"
+#include "kernel/service/SchedulerService.h"
+#include "kernel/system/System.h"
+#include "lib/util/async/Atomic.h"
+#include "lib/util/async/FunctionPointerRunnable.h"
+#include "lib/util/async/Thread.h"
+#include "lib/util/time/Timestamp.h"
+
+namespace Kernel {
+
+InitializationGroup::~InitializationGroup() {
+    join();
+}
+
+void InitializationGroup::start(const char *name, Util::Async::Runnable *runnable) {
+    auto &processService = System::getService<ProcessService>();
+    auto &schedulerService = System::getService<SchedulerService>();
+    auto &thread = Thread::createKernelThread(name, processService.getKernelProcess(), new Task(name, runnable, finishedTasks));
+
+    startedTasks++;
+    schedulerService.ready(thread);
+}
+
+void InitializationGroup::start(const char *name, void (*function)()) {
+    start(name, new Util::Async::FunctionPointerRunnable(function));
+}
+
+void InitializationGroup::join() {
+    // The threads are not joined directly, since a task may already have exited and been cleaned up.
+    // Polling a counter also ensures, that no task touches the group anymore, once it may be destroyed.
+    auto finished = Util::Async::Atomic<uint32_t>(finishedTasks);
+    while (finished.get() < startedTasks) {
+        Util::Async::Thread::sleep(Util::Time::Timestamp::ofMilliseconds(1));
+    }
+}
+
+InitializationGroup::Task::Task(const char *name, Util::Async::Runnable *runnable, uint32_t &finishedTasks) :
+        name(name), runnable(runnable), finishedTasks(finishedTasks) {}
+
+InitializationGroup::Task::~Task() {
+    delete runnable;
+}
+
+void InitializationGroup::Task::run() {
+    auto phase = System::startBootPhase(name);
+    runnable->run();
+    System::finishBootPhase(phase);
+
+    Util::Async::Atomic<uint32_t>(finishedTasks).inc();
+}
+
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_INITIALIZATIONGROUP_H
+#define HHUOS_INITIALIZATIONGROUP_H
+
+#include <cstdint>
+
+#include "lib/util/async/Runnable.h"
+
+namespace Kernel {
+
+/**
+ * Runs independent initialization tasks (e.g. device probes, that mostly wait for hardware) in parallel kernel threads.
+ * Each task is recorded as a boot phase. The scheduler must already be running.
+ */
+class InitializationGroup {
+
+public:
+    /**
+     * Default Constructor.
+     */
+    InitializationGroup() = default;
+
+    /**
+     * Copy Constructor.
+     */
+    InitializationGroup(const InitializationGroup &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    InitializationGroup &operator=(const InitializationGroup &other) = delete;
+
+    /**
+     * Destructor.
+     * Waits for all tasks, that have not been joined yet.
+     */
+    ~InitializationGroup();
+
+    /**
+     * Start a task in a new kernel thread. The group takes ownership of the runnable.
+     *
+     * @param name The name of the task's boot phase and thread (must stay valid)
+     */
+    void start(const char *name, Util::Async::Runnable *runnable);
+
+    void start(const char *name, void (*function)());
+
+    /**
+     * Wait for all started tasks to finish.
+     */
+    void join();
+
+private:
+
+    class Task : public Util::Async::Runnable {
+
+    public:
+
+        Task(const char *name, Util::Async::Runnable *runnable, uint32_t &finishedTasks);
+
+        Task(const Task &other) = delete;
+
+        Task &operator=(const Task &other) = delete;
+
+        ~Task() override;
+
+        void run() override;
+
+    private:
+
+        const char *name;
+        Util::Async::Runnable *runnable;
+        uint32_t &finishedTasks;
+    };
+
+    uint32_t startedTasks = 0;
+    uint32_t finishedTasks = 0;
+};
+
+}
+
+#endif
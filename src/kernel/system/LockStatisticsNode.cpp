@@ -0,0 +1,41 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "LockStatisticsNode.h"
+
+#include "lib/util/async/LockProfiler.h"
+
+namespace Kernel {
+
+LockStatisticsNode::LockStatisticsNode(const Util::String &name) : StringNode(name) {}
+
+Util::String LockStatisticsNode::getString() {
+    auto *statistics = new Util::Async::LockStatistics[Util::Async::LockProfiler::MAX_LOCK_NAMES];
+    auto count = Util::Async::LockProfiler::getStatistics(statistics, Util::Async::LockProfiler::MAX_LOCK_NAMES);
+
+    Util::String result;
+    for (uint32_t i = 0; i < count; i++) {
+        const auto &entry = statistics[i];
+        result += Util::String::format("%s: acquisitions=%u, contended=%u, hold_cycles=", entry.name, entry.acquisitions, entry.contendedSpins)
+                + Util::String::toDecimalString(entry.holdCycles) + ", max_hold_cycles=" + Util::String::toDecimalString(entry.maxHoldCycles) + "\n";
+    }
+
+    delete[] statistics;
+    return result;
+}
+
+}
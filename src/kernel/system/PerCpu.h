@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_PERCPU_H
+#define HHUOS_PERCPU_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Kernel {
+class MemoryService;
+class SchedulerService;
+class Thread;
+class TimeService;
+class VirtualAddressSpace;
+struct TaskStateSegment;
+
+/**
+ * Data, that exists once per CPU and is frequently accessed by the kernel.
+ * Each CPU's GDT contains a segment, which starts at the CPU's own block.
+ * Its selector is loaded into %gs, whenever the CPU is running in kernel mode.
+ */
+struct PerCpuData {
+    PerCpuData *self;                         // Linear address of this block
+    uint32_t cpuId;                           // Local APIC id (0, if no APIC is used)
+    int32_t cliCount;                         // See Device::Cpu::disableInterrupts()
+    Thread *currentThread;
+    VirtualAddressSpace *currentAddressSpace;
+    TaskStateSegment *taskStateSegment;
+    uint32_t contextSwitches;                 // Incremented by the scheduler on every thread switch
+    MemoryService *memoryService;             // Services used on hot paths (see System::registerService())
+    SchedulerService *schedulerService;
+    TimeService *timeService;
+
+    static const constexpr uint16_t SEGMENT_SELECTOR = 0x30;
+};
+
+/**
+ * Accessor for a single field of the calling CPU's data block.
+ * Reading or writing a field is a single %gs-relative instruction.
+ * Note that a thread may be migrated to another CPU, as soon as interrupts are enabled.
+ */
+template<typename T>
+class PerCpu {
+
+public:
+    /**
+     * Constructor.
+     *
+     * @param offset The field's offset inside PerCpuData
+     */
+    explicit constexpr PerCpu(uint32_t offset) : offset(offset) {}
+
+    /**
+     * Copy Constructor.
+     */
+    PerCpu(const PerCpu &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    PerCpu &operator=(const PerCpu &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~PerCpu() = default;
+
+    [[nodiscard]] T get() const {
+        T value;
+        asm volatile ("mov %%gs:(%1), %0" : "=r"(value) : "r"(offset) : "memory");
+        return value;
+    }
+
+    void set(T value) const {
+        asm volatile ("mov %0, %%gs:(%1)" : : "r"(value), "r"(offset) : "memory");
+    }
+
+private:
+
+    static_assert(sizeof(T) == sizeof(uint32_t), "PerCpu: Only 32-bit fields are supported!");
+
+    const uint32_t offset;
+};
+
+namespace CpuLocal {
+
+inline constexpr PerCpu<uint32_t> cpuId(offsetof(PerCpuData, cpuId));
+inline constexpr PerCpu<int32_t> cliCount(offsetof(PerCpuData, cliCount));
+inline constexpr PerCpu<Thread*> currentThread(offsetof(PerCpuData, currentThread));
+inline constexpr PerCpu<VirtualAddressSpace*> currentAddressSpace(offsetof(PerCpuData, currentAddressSpace));
+inline constexpr PerCpu<TaskStateSegment*> taskStateSegment(offsetof(PerCpuData, taskStateSegment));
+inline constexpr PerCpu<uint32_t> contextSwitches(offsetof(PerCpuData, contextSwitches));
+inline constexpr PerCpu<MemoryService*> memoryService(offsetof(PerCpuData, memoryService));
+inline constexpr PerCpu<SchedulerService*> schedulerService(offsetof(PerCpuData, schedulerService));
+inline constexpr PerCpu<TimeService*> timeService(offsetof(PerCpuData, timeService));
+
+/**
+ * Get the calling CPU's data block as a regular reference (e.g. to register it, so that other CPUs can access it).
+ */
+inline PerCpuData& getData() {
+    return *PerCpu<PerCpuData*>(offsetof(PerCpuData, self)).get();
+}
+
+}
+
+}
+
+#endif
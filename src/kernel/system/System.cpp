@@ -20,6 +20,9 @@
 #include "device/cpu/Cpu.h"
 #include "device/time/Rtc.h"
 #include "device/time/Pit.h"
+#include "device/time/ApicTimer.h"
+#include "device/time/Hpet.h"
+#include "device/time/TimestampCounter.h"
 #include "kernel/paging/MemoryLayout.h"
 #include "kernel/service/TimeService.h"
 #include "kernel/memory/PagingAreaManagerRefillRunnable.h"
@@ -45,7 +48,9 @@
 #include "kernel/service/SchedulerService.h"
 #include "kernel/system/SystemCall.h"
 #include "kernel/system/TaskStateSegment.h"
+#include "kernel/system/PerCpu.h"
 #include "lib/util/async/Spinlock.h"
+#include "lib/util/async/Atomic.h"
 #include "lib/util/collection/Array.h"
 #include "lib/util/base/FreeListMemoryManager.h"
 #include "lib/util/base/HeapMemoryManager.h"
@@ -62,6 +67,10 @@ Service* System::serviceMap[256]{};
 Util::HeapMemoryManager *System::kernelHeapMemoryManager{};
 InterruptHandler *System::pagefaultHandler{};
 TaskStateSegment System::taskStateSegment{};
+PerCpuData System::bootstrapProcessorData{&System::bootstrapProcessorData, 0, 1, nullptr, nullptr, &System::taskStateSegment};
+PerCpuData *System::perCpuData[256]{&System::bootstrapProcessorData};
+System::BootPhase System::bootPhases[MAX_BOOT_PHASES]{};
+uint32_t System::bootPhaseCount = 0;
 SystemCall System::systemCall{};
 Logger System::log = Logger::get("System");
 
@@ -70,6 +79,7 @@ Logger System::log = Logger::get("System");
  * everything to get the system run.
  */
 void System::initializeSystem() {
+    auto phase = startBootPhase("memory");
     Multiboot::initialize();
     Device::Acpi::initialize();
     Device::SmBios::initialize();
@@ -100,7 +110,9 @@ void System::initializeSystem() {
     registerService(MemoryService::SERVICE_ID, memoryService);
     log.info("Welcome to hhuOS!");
     log.info("Memory management has been initialized");
+    finishBootPhase(phase);
 
+    phase = startBootPhase("interrupts");
     auto *interruptService = new InterruptService();
     registerService(InterruptService::SERVICE_ID, interruptService);
     memoryService->plugin();
@@ -120,6 +132,7 @@ void System::initializeSystem() {
     } else {
         log.info("APIC not available -> Falling back to PIC");
     }
+    finishBootPhase(phase);
 
     // Create scheduler service and register kernel process
     log.info("Initializing scheduler");
@@ -141,8 +154,11 @@ void System::initializeSystem() {
     }
 
     // Setup time and date devices
-    log.info("Initializing PIT");
-    auto *pit = new Device::Pit(1, 10);
+    phase = startBootPhase("time");
+    // In tickless mode, the APIC timers are programmed by the scheduler and the PIT is only needed to keep the system time, until a clock source is chosen
+    auto tickless = interruptService->usesApic() && Device::ApicTimer::isTicklessModeEnabled();
+    log.info("Initializing PIT%s", tickless ? " (Tickless mode)" : "");
+    auto *pit = new Device::Pit(tickless ? Device::Pit::TICKLESS_INTERVAL : 1, 10);
     pit->plugin();
 
     Device::Rtc *rtc = nullptr;
@@ -158,7 +174,36 @@ void System::initializeSystem() {
         log.warn("RTC not available");
     }
 
-    registerService(TimeService::SERVICE_ID, new Kernel::TimeService(pit, rtc));
+    auto *timeService = new Kernel::TimeService(pit, rtc);
+    registerService(TimeService::SERVICE_ID, timeService);
+
+    // The PIT only serves as clock source, if neither the HPET nor an invariant time stamp counter is available
+    if (Device::Hpet::isAvailable()) {
+        log.info("Initializing HPET");
+        timeService->registerClockSource(new Device::Hpet());
+    }
+
+    if (Device::TimestampCounter::isAvailable()) {
+        log.info("Calibrating invariant time stamp counter against [%s]", timeService->getClockSource().getName());
+        auto *timestampCounter = new Device::TimestampCounter();
+        timestampCounter->calibrate(timeService->getClockSource());
+        timeService->registerClockSource(timestampCounter);
+    }
+
+    log.info("Using [%s] as clock source", timeService->getClockSource().getName());
+
+    // In tickless mode, the PIT has only been running to keep the system time until now
+    if (tickless) {
+        if (timeService->getClockSource().requiresPeriodicReads()) {
+            // Limitation: Without an invariant time stamp counter or a 64-bit HPET, the PIT still wakes up a CPU every 25 ms
+            log.warn("Clock source [%s] must be read periodically -> Keeping the PIT running", timeService->getClockSource().getName());
+        } else {
+            log.info("Stopping PIT (Tickless mode)");
+            pit->stop();
+            timeService->stopPeriodicTimePageUpdates();
+        }
+    }
+    finishBootPhase(phase);
 
     // Create thread to refill block pool of paging area manager
     auto &refillThread = Kernel::Thread::createKernelThread("Paging-Area-Pool-Refiller", processService->getKernelProcess(), new PagingAreaManagerRefillRunnable(*pagingAreaManager));
@@ -173,6 +218,7 @@ void System::initializeSystem() {
     // Enable system calls
     log.info("Enabling system calls");
     systemCall.plugin();
+    SystemCall::initializeFastSystemCalls();
 
     // Protect kernel code
     if (!Multiboot::hasKernelOption("debug_port")) {
@@ -203,9 +249,21 @@ void System::registerService(uint32_t serviceId, Service *kernelService) {
     }
 
     serviceMap[serviceId] = kernelService;
+    for (auto *data : perCpuData) {
+        if (data != nullptr) {
+            cacheServices(*data);
+        }
+    }
+
     serviceLock.release();
 }
 
+void System::cacheServices(PerCpuData &data) {
+    data.memoryService = static_cast<MemoryService*>(serviceMap[MemoryService::SERVICE_ID]);
+    data.schedulerService = static_cast<SchedulerService*>(serviceMap[SchedulerService::SERVICE_ID]);
+    data.timeService = static_cast<TimeService*>(serviceMap[TimeService::SERVICE_ID]);
+}
+
 bool System::isServiceRegistered(uint32_t serviceId) {
     return serviceMap[serviceId] != nullptr;
 }
@@ -230,8 +288,8 @@ void System::panic(const InterruptFrame &frame) {
  * @param physicalGdtDescriptor Pointer to the descriptor of GDT; this descriptor should contain the physical address of GDT
  */
 void System::initializeGlobalDescriptorTables(uint16_t *systemGdt, uint16_t *biosGdt, uint16_t *systemGdtDescriptor, uint16_t *biosGdtDescriptor, uint16_t *physicalGdtDescriptor) {
-    // Set first 6 GDT entries to 0
-    Util::Address<uint32_t>(systemGdt).setRange(0, 48);
+    // Set first 7 GDT entries to 0
+    Util::Address<uint32_t>(systemGdt).setRange(0, 56);
 
     // Set first 4 bios GDT entries to 0
     Util::Address<uint32_t>(biosGdt).setRange(0, 32);
@@ -249,14 +307,16 @@ void System::initializeGlobalDescriptorTables(uint16_t *systemGdt, uint16_t *bio
     System::createGlobalDescriptorTableEntry(systemGdt, 4, 0, 0xFFFFFFFF, 0xF2, 0x0C);
     // tss segment
     System::createGlobalDescriptorTableEntry(systemGdt, 5, reinterpret_cast<uint32_t>(&System::taskStateSegment), sizeof(Kernel::TaskStateSegment), 0x89, 0x4);
+    // per-cpu data segment (loaded into gs by the kernel)
+    System::createGlobalDescriptorTableEntry(systemGdt, 6, reinterpret_cast<uint32_t>(&System::bootstrapProcessorData), sizeof(Kernel::PerCpuData) - 1, 0x92, 0x4);
 
     // set up descriptor for GDT
-    *((uint16_t *) systemGdtDescriptor) = 6 * 8;
+    *((uint16_t *) systemGdtDescriptor) = 7 * 8;
     // the normal descriptor should contain the virtual address of GDT
     *((uint32_t *) (systemGdtDescriptor + 1)) = (uint32_t) systemGdt + Kernel::MemoryLayout::KERNEL_START;
 
     // set up descriptor for GDT with phys. address - needed for bootstrapping
-    *((uint16_t *) physicalGdtDescriptor) = 6 * 8;
+    *((uint16_t *) physicalGdtDescriptor) = 7 * 8;
     // this descriptor should contain the physical address of GDT
     *((uint32_t *) (physicalGdtDescriptor + 1)) = (uint32_t) systemGdt;
 
@@ -342,7 +402,68 @@ Util::HeapMemoryManager& System::initializeKernelHeap() {
 }
 
 TaskStateSegment &System::getTaskStateSegment() {
-    return taskStateSegment;
+    return *CpuLocal::taskStateSegment.get();
+}
+
+void System::registerPerCpuData(uint8_t cpuId, PerCpuData &data) {
+    // The bootstrap processor is registered as CPU 0, until its local APIC id is known
+    if (perCpuData[data.cpuId] == &data) {
+        perCpuData[data.cpuId] = nullptr;
+    }
+
+    data.cpuId = cpuId;
+    perCpuData[cpuId] = &data;
+
+    serviceLock.acquire();
+    cacheServices(data);
+    serviceLock.release();
+}
+
+PerCpuData* System::getPerCpuData(uint8_t cpuId) {
+    return perCpuData[cpuId];
+}
+
+uint32_t System::startBootPhase(const char *name) {
+    auto index = Util::Async::Atomic<uint32_t>(bootPhaseCount).fetchAndInc();
+    if (index >= MAX_BOOT_PHASES) {
+        return MAX_BOOT_PHASES;
+    }
+
+    auto &phase = bootPhases[index];
+    phase.name = name;
+    phase.startTime = getBootTime();
+    phase.startCycles = Device::Cpu::readTimestampCounter();
+
+    return index;
+}
+
+void System::finishBootPhase(uint32_t phase) {
+    if (phase >= MAX_BOOT_PHASES) {
+        return;
+    }
+
+    bootPhases[phase].endCycles = Device::Cpu::readTimestampCounter();
+    bootPhases[phase].endTime = getBootTime();
+}
+
+uint32_t System::getBootPhaseCount() {
+    return bootPhaseCount > MAX_BOOT_PHASES ? MAX_BOOT_PHASES : bootPhaseCount;
+}
+
+const System::BootPhase& System::getBootPhase(uint32_t index) {
+    if (index >= getBootPhaseCount()) {
+        Util::Exception::throwException(Util::Exception::OUT_OF_BOUNDS, "System: Boot phase index out of bounds!");
+    }
+
+    return bootPhases[index];
+}
+
+uint32_t System::getBootTime() {
+    if (!initialized || !isServiceRegistered(TimeService::SERVICE_ID)) {
+        return 0;
+    }
+
+    return getService<TimeService>().getSystemTime().toMicroseconds();
 }
 
 void System::handleEarlyInterrupt(const InterruptFrame &frame) {
@@ -37,6 +37,7 @@ class Service;
 class SystemCall;
 struct InterruptFrame;
 struct TaskStateSegment;
+struct PerCpuData;
 
 /**
  * SystemManagement
@@ -52,6 +53,14 @@ class System {
 
 public:
 
+    struct BootPhase {
+        const char *name;
+        uint64_t startCycles;
+        uint64_t endCycles;
+        uint32_t startTime; // System time in microseconds (0, if the time service has not been available yet)
+        uint32_t endTime;
+    };
+
     /**
      * Default Constructor.
      * Deleted, as this class has only static members.
@@ -141,10 +150,46 @@ public:
      */
     static bool isInitialized();
 
+    /**
+     * Get the task state segment of the calling CPU.
+     */
     static TaskStateSegment& getTaskStateSegment();
 
+    /**
+     * Make a CPU's data block accessible to the other CPUs.
+     *
+     * @param cpuId The processor's local APIC id (written to the block)
+     * @param data The data block, referenced by the processor's GDT
+     */
+    static void registerPerCpuData(uint8_t cpuId, PerCpuData &data);
+
+    /**
+     * Get the data block of any CPU.
+     *
+     * @return The data block or nullptr, if the CPU has not been set up
+     */
+    static PerCpuData* getPerCpuData(uint8_t cpuId);
+
+    /**
+     * Record the start of an initialization phase. Phases may overlap, if they are run in parallel.
+     *
+     * @param name The phase's name (must stay valid)
+     * @return The phase's index, which is needed to finish it
+     */
+    static uint32_t startBootPhase(const char *name);
+
+    static void finishBootPhase(uint32_t phase);
+
+    [[nodiscard]] static uint32_t getBootPhaseCount();
+
+    [[nodiscard]] static const BootPhase& getBootPhase(uint32_t index);
+
+    static const constexpr uint32_t MAX_BOOT_PHASES = 32;
+
 private:
 
+    static uint32_t getBootTime();
+
     /**
      * Calculate the amount of usable, installed physical memory using information provided by the bootloader.
      *
@@ -154,12 +199,21 @@ private:
 
     static Util::HeapMemoryManager& initializeKernelHeap();
 
+    /**
+     * Store pointers to the services, that are used on hot paths, in a CPU's data block (see CpuLocal).
+     */
+    static void cacheServices(PerCpuData &data);
+
     static bool initialized;
 
     static Service* serviceMap[256];
     static Util::Async::Spinlock serviceLock;
 
     static TaskStateSegment taskStateSegment;
+    static PerCpuData bootstrapProcessorData;
+    static PerCpuData *perCpuData[256];
+    static BootPhase bootPhases[MAX_BOOT_PHASES];
+    static uint32_t bootPhaseCount;
     static Util::HeapMemoryManager *kernelHeapMemoryManager;
     static InterruptHandler *pagefaultHandler;
     static SystemCall systemCall;
@@ -18,13 +18,28 @@
 #include "kernel/service/InterruptService.h"
 #include "lib/util/base/Exception.h"
 #include "SystemCall.h"
+#include "kernel/log/Trace.h"
 #include "System.h"
 #include "kernel/process/ThreadState.h"
+#include "kernel/process/Thread.h"
+#include "kernel/process/Process.h"
+#include "kernel/process/SystemCallTrace.h"
+#include "device/cpu/Cpu.h"
+#include "kernel/system/PerCpu.h"
+#include "kernel/paging/MemoryLayout.h"
+#include "kernel/paging/Paging.h"
+#include "kernel/service/MemoryService.h"
 #include "kernel/interrupt/InterruptVector.h"
+#include "kernel/system/TaskStateSegment.h"
+#include "device/cpu/ModelSpecificRegister.h"
+#include "lib/util/hardware/CpuId.h"
+#include "asm_interface.h"
 
 namespace Kernel {
 
 bool(*SystemCall::systemCalls[256])(uint32_t paramCount, va_list params){};
+SystemCall::UserBuffer SystemCall::userBuffers[256]{};
+bool SystemCall::fastSystemCallsEnabled = false;
 
 void SystemCall::registerSystemCall(Util::System::Code code, bool(*func)(uint32_t, va_list)) {
     if (systemCalls[code] != nullptr) {
@@ -34,6 +49,14 @@ void SystemCall::registerSystemCall(Util::System::Code code, bool(*func)(uint32_
     systemCalls[code] = func;
 }
 
+void SystemCall::registerUserBuffer(Util::System::Code code, uint32_t paramCount, uint8_t addressSlot, uint8_t lengthSlot) {
+    if (paramCount == 0) {
+        Util::Exception::throwException(Util::Exception::INVALID_ARGUMENT, "SystemCall: Invalid parameter count");
+    }
+
+    userBuffers[code] = { paramCount, addressSlot, lengthSlot };
+}
+
 void SystemCall::plugin() {
     Kernel::System::getService<Kernel::InterruptService>().assignInterrupt(Kernel::InterruptVector::SYSTEM_CALL, *this);
 }
@@ -44,7 +67,97 @@ void SystemCall::trigger(const Kernel::InterruptFrame &frame) {
     auto params = reinterpret_cast<va_list>(frame.ebx);
     auto &result = *reinterpret_cast<bool*>(frame.ecx);
 
-    result = systemCalls[code](paramCount, params);
+    result = invoke(code, paramCount, params);
+}
+
+void SystemCall::initializeFastSystemCalls() {
+    if (!Util::Hardware::CpuId::isFastSystemCallSupported()) {
+        return;
+    }
+
+    // SYSENTER loads the current thread's kernel stack pointer directly, so that an NMI arriving at the first
+    // instruction of the entry code already runs on a valid stack (see setKernelStack())
+    fastSystemCallsEnabled = true;
+    Device::ModelSpecificRegister(SYSENTER_CS).writeQuadWord(0x08);
+    Device::ModelSpecificRegister(SYSENTER_ESP).writeQuadWord(System::getTaskStateSegment().esp0);
+    Device::ModelSpecificRegister(SYSENTER_EIP).writeQuadWord(reinterpret_cast<uint32_t>(&system_call_entry));
+}
+
+void SystemCall::setKernelStack(uint32_t stack) {
+    if (fastSystemCallsEnabled) {
+        Device::ModelSpecificRegister(SYSENTER_ESP).writeQuadWord(stack);
+    }
+}
+
+void SystemCall::handleFastSystemCall(Kernel::InterruptFrame &frame) {
+    uint16_t code = frame.eax & 0x000000ff;
+    uint16_t paramCount = (frame.eax >> 8) & 0x000000ff;
+
+    // The caller decides by the same rule, whether the arguments are passed in registers or in its argument list.
+    // The user stack holds the return address, followed by a pointer to the argument list.
+    uint32_t arguments[Util::System::FAST_CALL_REGISTER_SLOTS] = { frame.ebx, frame.ecx, frame.edx, frame.esi, frame.edi };
+    auto params = reinterpret_cast<va_list>(arguments);
+    if (!Util::System::passesArgumentsInRegisters(static_cast<Util::System::Code>(code), paramCount)) {
+        // The entry code has already checked the user stack pointer, but not the slot behind the return address
+        if (frame.uesp >= MemoryLayout::KERNEL_START - 2 * sizeof(uint32_t)) {
+            frame.eax = false;
+            return;
+        }
+
+        params = reinterpret_cast<va_list>(reinterpret_cast<uint32_t*>(frame.uesp)[1]);
+    }
+
+    frame.eax = invoke(code, paramCount, params);
+}
+
+bool SystemCall::invoke(uint8_t code, uint32_t paramCount, va_list params) {
+    auto &thread = *CpuLocal::currentThread.get();
+    thread.countSystemCall();
+    loadUserBuffers(code, paramCount, params);
+
+    auto *trace = thread.getParent().getSystemCallTrace();
+    if (trace == nullptr) {
+        Trace::tracepoint(Trace::SYSTEM_CALL_ENTER, code);
+        auto result = systemCalls[code](paramCount, params);
+        Trace::tracepoint(Trace::SYSTEM_CALL_EXIT, code, result);
+
+        return result;
+    }
+
+    // Arguments are copied before the call, since the function consumes the argument list.
+    // Each parameter occupies at least one slot, so reading paramCount slots stays inside the caller's argument list.
+    Util::Async::SystemCallRecord record{thread.getId(), code, false, static_cast<uint16_t>(paramCount), {}, 0};
+    for (uint32_t i = 0; i < paramCount && i < Util::Async::SystemCallRecord::MAX_ARGUMENTS; i++) {
+        record.arguments[i] = reinterpret_cast<const uint32_t*>(params)[i];
+    }
+
+    Trace::tracepoint(Trace::SYSTEM_CALL_ENTER, code);
+    auto startCycles = Device::Cpu::readTimestampCounter();
+    auto result = systemCalls[code](paramCount, params);
+    record.cycles = Device::Cpu::readTimestampCounter() - startCycles;
+    Trace::tracepoint(Trace::SYSTEM_CALL_EXIT, code, result);
+
+    record.result = result;
+    trace->record(record);
+    return result;
+}
+
+void SystemCall::loadUserBuffers(uint8_t code, uint32_t paramCount, va_list params) {
+    auto &memoryService = System::getService<MemoryService>();
+    const auto *slots = reinterpret_cast<const uint32_t*>(params);
+
+    // Each parameter occupies at least one slot, so reading paramCount slots stays inside the caller's argument list.
+    // Arguments, that are no pointers into file backed regions, are skipped by the memory service.
+    // An object passed by pointer (e.g. a string in rodata) may cross a page boundary, so the following page is loaded as well.
+    for (uint32_t i = 0; i < paramCount; i++) {
+        memoryService.loadFileBackedPages(reinterpret_cast<const void*>(slots[i]), Paging::PAGESIZE);
+    }
+
+    const auto &buffer = userBuffers[code];
+    if (buffer.paramCount > 0 && paramCount >= buffer.paramCount) {
+        auto length = slots[buffer.lengthSlot] | static_cast<uint64_t>(slots[buffer.lengthSlot + 1]) << 32;
+        memoryService.loadFileBackedPages(reinterpret_cast<const void*>(slots[buffer.addressSlot]), length);
+    }
 }
 
 }
\ No newline at end of file
@@ -52,13 +52,67 @@ public:
 
     static void registerSystemCall(Util::System::Code code, bool(*func)(uint32_t paramCount, va_list params));
 
+    /**
+     * Let invoke() load the file backed pages of a user buffer, before the system call is executed (see MemoryService::loadFileBackedPages()).
+     * The buffer's address is passed in the argument slot 'addressSlot' and its 64-bit length in the two slots starting at 'lengthSlot'.
+     * Only calls with at least 'paramCount' parameters are considered, so that both slots are part of the caller's argument list.
+     */
+    static void registerUserBuffer(Util::System::Code code, uint32_t paramCount, uint8_t addressSlot, uint8_t lengthSlot);
+
     void plugin() override;
 
     void trigger(const Kernel::InterruptFrame &frame) override;
 
+    /**
+     * Set up the SYSENTER model specific registers of the calling CPU, if SYSENTER is supported.
+     * Must be called once on each CPU, before it runs user threads.
+     */
+    static void initializeFastSystemCalls();
+
+    /**
+     * Let SYSENTER switch to the given kernel stack on the calling CPU.
+     * Called together with setting esp0 in the TSS, so that both always point to the current thread's kernel stack.
+     * Writing the model specific register is skipped, if SYSENTER is not supported.
+     */
+    static void setKernelStack(uint32_t stack);
+
+    /**
+     * Handle a system call, that has been issued via SYSENTER.
+     * Code and parameter count are passed in eax, the argument slots in ebx, ecx, edx, esi and edi.
+     * System calls, that may need more slots (see Util::System::passesArgumentsInRegisters()), read the caller's argument list instead.
+     * The result is returned in eax.
+     */
+    static void handleFastSystemCall(Kernel::InterruptFrame &frame);
+
 private:
 
+    /**
+     * Call the function registered for a system call code and update the thread's statistics, tracepoints
+     * and the system call trace of the current process, if it is traced.
+     */
+    static bool invoke(uint8_t code, uint32_t paramCount, va_list params);
+
+    /**
+     * Load the file backed pages, that the arguments of a system call point to, and the registered user buffer of the system call.
+     * System call functions may then hand the arguments to filesystems and drivers, without page faults reading from the filesystem
+     * while their locks are held.
+     */
+    static void loadUserBuffers(uint8_t code, uint32_t paramCount, va_list params);
+
+    struct UserBuffer {
+        uint32_t paramCount;
+        uint8_t addressSlot;
+        uint8_t lengthSlot;
+    };
+
+    static const constexpr uint32_t SYSENTER_CS = 0x174;
+    static const constexpr uint32_t SYSENTER_ESP = 0x175;
+    static const constexpr uint32_t SYSENTER_EIP = 0x176;
+
     static bool(*systemCalls[256])(uint32_t paramCount, va_list params);
+    static UserBuffer userBuffers[256];
+
+    static bool fastSystemCallsEnabled;
 
 };
 
@@ -30,6 +30,7 @@
 #include "lib/util/collection/Array.h"
 #include "lib/util/base/String.h"
 #include "lib/util/network/Socket.h"
+#include "lib/util/io/ring/IoRing.h"
 
 namespace Util {
 namespace Network {
@@ -37,6 +38,7 @@ class Datagram;
 }  // namespace Network
 
 namespace Async {
+class Lock;
 class Runnable;
 }  // namespace Async
 }  // namespace Util
@@ -68,15 +70,25 @@ int32_t createSocket(Util::Network::Socket::Type socketType);
 bool sendDatagram(int32_t fileDescriptor, const Util::Network::Datagram &datagram);
 bool receiveDatagram(int32_t fileDescriptor, Util::Network::Datagram &datagram);
 
-Util::Async::Process executeBinary(const Util::Io::File &binaryFile, const Util::Io::File &inputFile, const Util::Io::File &outputFile, const Util::Io::File &errorFile, const Util::String &command, const Util::Array<Util::String> &arguments);
+bool createIoRing(Util::Io::IoRing::Rings &rings);
+uint32_t enterIoRing(Util::Io::IoRing::Rings &rings, uint32_t minCompletions);
+void destroyIoRing(Util::Io::IoRing::Rings &rings);
+
+Util::Async::Process executeBinary(const Util::Io::File &binaryFile, const Util::Io::File &inputFile, const Util::Io::File &outputFile, const Util::Io::File &errorFile, const Util::String &command, const Util::Array<Util::String> &arguments, bool traceSystemCalls);
+uint32_t readSystemCallTrace(uint32_t processId, Util::Async::SystemCallRecord *buffer, uint32_t count, uint32_t &droppedRecords, bool &finished);
 Util::Async::Process getCurrentProcess();
 Util::Async::Thread createThread(const Util::String &name, Util::Async::Runnable *runnable);
 Util::Async::Thread getCurrentThread();
 void joinThread(uint32_t id);
+bool setThreadPriority(uint32_t id, uint8_t priority);
 void joinProcess(uint32_t id);
 void killProcess(uint32_t id);
 void sleep(const Util::Time::Timestamp &time);
 void yield();
+void* createWaitQueue();
+void deleteWaitQueue(void *queue);
+void waitOnQueue(void *queue, Util::Async::Lock &lock);
+void notifyQueue(void *queue, bool all);
 
 Util::Time::Timestamp getSystemTime();
 Util::Time::Date getCurrentDate();
@@ -28,13 +28,16 @@
 #include "kernel/service/ProcessService.h"
 #include "filesystem/core/Node.h"
 #include "kernel/process/Thread.h"
+#include "kernel/process/WaitQueue.h"
 #include "kernel/service/SchedulerService.h"
+#include "kernel/system/PerCpu.h"
 #include "kernel/service/NetworkService.h"
 #include "kernel/network/Socket.h"
 #include "lib/util/base/Address.h"
 #include "lib/util/network/Datagram.h"
 #include "lib/util/async/Process.h"
 #include "lib/util/async/Thread.h"
+#include "lib/util/async/Lock.h"
 #include "lib/util/base/Exception.h"
 #include "lib/util/base/String.h"
 #include "lib/util/collection/Array.h"
@@ -177,11 +180,27 @@ bool receiveDatagram(int32_t fileDescriptor, Util::Network::Datagram &datagram)
     return true;
 }
 
-Util::Async::Process executeBinary(const Util::Io::File &binaryFile, const Util::Io::File &inputFile, const Util::Io::File &outputFile, const Util::Io::File &errorFile, const Util::String &command, const Util::Array<Util::String> &arguments) {
-    auto &process = Kernel::System::getService<Kernel::ProcessService>().loadBinary(binaryFile, inputFile, outputFile, errorFile, command, arguments);
+bool createIoRing(Util::Io::IoRing::Rings &rings) {
+    return Kernel::System::getService<Kernel::ProcessService>().createIoRing(rings);
+}
+
+uint32_t enterIoRing(Util::Io::IoRing::Rings &rings, uint32_t minCompletions) {
+    return Kernel::System::getService<Kernel::ProcessService>().enterIoRing(rings, minCompletions);
+}
+
+void destroyIoRing(Util::Io::IoRing::Rings &rings) {
+    Kernel::System::getService<Kernel::ProcessService>().destroyIoRing(rings);
+}
+
+Util::Async::Process executeBinary(const Util::Io::File &binaryFile, const Util::Io::File &inputFile, const Util::Io::File &outputFile, const Util::Io::File &errorFile, const Util::String &command, const Util::Array<Util::String> &arguments, bool traceSystemCalls) {
+    auto &process = Kernel::System::getService<Kernel::ProcessService>().loadBinary(binaryFile, inputFile, outputFile, errorFile, command, arguments, traceSystemCalls);
     return Util::Async::Process(process.getId());
 }
 
+uint32_t readSystemCallTrace(uint32_t processId, Util::Async::SystemCallRecord *buffer, uint32_t count, uint32_t &droppedRecords, bool &finished) {
+    return Kernel::System::getService<Kernel::ProcessService>().readSystemCallTrace(processId, buffer, count, droppedRecords, finished);
+}
+
 Util::Async::Process getCurrentProcess() {
     auto &process = Kernel::System::getService<Kernel::ProcessService>().getCurrentProcess();
     return Util::Async::Process(process.getId());
@@ -198,24 +217,43 @@ Util::Async::Thread getCurrentThread() {
 }
 
 void joinThread(uint32_t id) {
-    auto *thread = Kernel::System::getService<Kernel::SchedulerService>().getThread(id);
+    auto *thread = Kernel::System::getService<Kernel::SchedulerService>().acquireThread(id);
     if (thread != nullptr) {
         thread->join();
+        thread->removeReference();
     }
 }
 
+bool setThreadPriority(uint32_t id, uint8_t priority) {
+    auto &schedulerService = Kernel::System::getService<Kernel::SchedulerService>();
+    if (priority > Util::Async::Thread::MAXIMUM) {
+        return false;
+    }
+
+    auto *thread = schedulerService.acquireThread(id);
+    if (thread == nullptr) {
+        return false;
+    }
+
+    schedulerService.setPriority(*thread, priority);
+    thread->removeReference();
+    return true;
+}
+
 void joinProcess(uint32_t id) {
-    auto *process = Kernel::System::getService<Kernel::ProcessService>().getProcess(id);
+    auto *process = Kernel::System::getService<Kernel::ProcessService>().acquireProcess(id);
     if (process != nullptr) {
         process->join();
+        process->removeReference();
     }
 }
 
 void killProcess(uint32_t id) {
     auto &processService = Kernel::System::getService<Kernel::ProcessService>();
-    auto *process = processService.getProcess(id);
+    auto *process = processService.acquireProcess(id);
     if (process != nullptr) {
         processService.killProcess(*process);
+        process->removeReference();
     }
 }
 
@@ -228,7 +266,35 @@ void sleep(const Util::Time::Timestamp &time) {
 }
 
 void yield() {
-    Kernel::System::getService<Kernel::SchedulerService>().yield();
+    Kernel::CpuLocal::schedulerService.get()->yield();
+}
+
+void* createWaitQueue() {
+    return new Kernel::WaitQueue();
+}
+
+void deleteWaitQueue(void *queue) {
+    delete reinterpret_cast<Kernel::WaitQueue*>(queue);
+}
+
+void waitOnQueue(void *queue, Util::Async::Lock &lock) {
+    if (!scheduler_initialized) {
+        // There is no other thread yet, that could fulfill the condition
+        lock.release();
+        lock.acquire();
+        return;
+    }
+
+    reinterpret_cast<Kernel::WaitQueue*>(queue)->wait(lock);
+}
+
+void notifyQueue(void *queue, bool all) {
+    auto *waitQueue = reinterpret_cast<Kernel::WaitQueue*>(queue);
+    if (all) {
+        waitQueue->notifyAll();
+    } else {
+        waitQueue->notify();
+    }
 }
 
 Util::Time::Timestamp getSystemTime() {
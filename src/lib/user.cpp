@@ -25,6 +25,7 @@
 #include "lib/util/io/stream/PrintStream.h"
 #include "lib/util/async/Process.h"
 #include "lib/util/async/Thread.h"
+#include "lib/util/async/Lock.h"
 #include "lib/util/base/Exception.h"
 #include "lib/util/base/String.h"
 #include "lib/util/collection/Array.h"
@@ -33,6 +34,7 @@
 #include "lib/util/network/Socket.h"
 #include "lib/util/time/Date.h"
 #include "lib/util/time/Timestamp.h"
+#include "lib/util/time/TimePage.h"
 
 namespace Util {
 namespace Network {
@@ -166,12 +168,32 @@ bool receiveDatagram(int32_t fileDescriptor, Util::Network::Datagram &datagram){
     return Util::System::call(Util::System::RECEIVE_DATAGRAM, 2, fileDescriptor, &datagram);
 }
 
-Util::Async::Process executeBinary(const Util::Io::File &binaryFile, const Util::Io::File &inputFile, const Util::Io::File &outputFile, const Util::Io::File &errorFile, const Util::String &command, const Util::Array<Util::String> &arguments) {
+bool createIoRing(Util::Io::IoRing::Rings &rings) {
+    return Util::System::call(Util::System::CREATE_IO_RING, 1, &rings);
+}
+
+uint32_t enterIoRing(Util::Io::IoRing::Rings &rings, uint32_t minCompletions) {
+    uint32_t availableCompletions = 0;
+    Util::System::call(Util::System::ENTER_IO_RING, 3, &rings, minCompletions, &availableCompletions);
+    return availableCompletions;
+}
+
+void destroyIoRing(Util::Io::IoRing::Rings &rings) {
+    Util::System::call(Util::System::DESTROY_IO_RING, 1, &rings);
+}
+
+Util::Async::Process executeBinary(const Util::Io::File &binaryFile, const Util::Io::File &inputFile, const Util::Io::File &outputFile, const Util::Io::File &errorFile, const Util::String &command, const Util::Array<Util::String> &arguments, bool traceSystemCalls) {
     uint32_t processId;
-    Util::System::call(Util::System::EXECUTE_BINARY, 7, &binaryFile, &inputFile, &outputFile, &errorFile, &command, &arguments, &processId);
+    Util::System::call(Util::System::EXECUTE_BINARY, 8, &binaryFile, &inputFile, &outputFile, &errorFile, &command, &arguments, &processId, traceSystemCalls);
     return Util::Async::Process(processId);
 }
 
+uint32_t readSystemCallTrace(uint32_t processId, Util::Async::SystemCallRecord *buffer, uint32_t count, uint32_t &droppedRecords, bool &finished) {
+    uint32_t read = 0;
+    Util::System::call(Util::System::READ_SYSTEM_CALL_TRACE, 6, processId, buffer, count, &droppedRecords, &finished, &read);
+    return read;
+}
+
 Util::Async::Process getCurrentProcess() {
     uint32_t processId;
     Util::System::call(Util::System::GET_CURRENT_PROCESS, 1, &processId);
@@ -192,7 +214,7 @@ Util::Async::Thread createThread(const Util::String &name, Util::Async::Runnable
 
 Util::Async::Thread getCurrentThread() {
     uint32_t threadId;
-    Util::System::call(Util::System::GET_CURRENT_PROCESS, 1, &threadId);
+    Util::System::call(Util::System::GET_CURRENT_THREAD, 1, &threadId);
     return Util::Async::Thread(threadId);
 }
 
@@ -200,6 +222,10 @@ void joinThread(uint32_t id) {
     Util::System::call(Util::System::JOIN_THREAD, 1, id);
 }
 
+bool setThreadPriority(uint32_t id, uint8_t priority) {
+    return Util::System::call(Util::System::SET_THREAD_PRIORITY, 2, id, priority);
+}
+
 void joinProcess(uint32_t id) {
     Util::System::call(Util::System::JOIN_PROCESS, 1, id);
 }
@@ -216,7 +242,58 @@ void yield() {
     Util::System::call(Util::System::YIELD, 0);
 }
 
+void* createWaitQueue() {
+    // Threads cannot be parked from user space yet -> Waiting falls back to yielding
+    return nullptr;
+}
+
+void deleteWaitQueue(void *queue) {}
+
+void waitOnQueue(void *queue, Util::Async::Lock &lock) {
+    lock.release();
+    yield();
+    lock.acquire();
+}
+
+void notifyQueue(void *queue, bool all) {}
+
 Util::Time::Timestamp getSystemTime() {
+    // The kernel publishes the time of the last tick on the time page -> Extrapolate it with the time stamp counter
+    const auto &timePage = *reinterpret_cast<const volatile Util::Time::TimePage*>(Util::USER_SPACE_TIME_PAGE_ADDRESS);
+    while (timePage.calibrated) {
+        auto sequence = timePage.sequence;
+        asm volatile ("" ::: "memory");
+
+        uint32_t seconds = timePage.seconds;
+        uint32_t fraction = timePage.fraction;
+        uint64_t lastCycles = timePage.cycles;
+        uint32_t tickInterval = timePage.tickInterval;
+        uint32_t nanosecondsPerCycle = timePage.nanosecondsPerCycle;
+        uint32_t nanosecondsPerCycleFraction = timePage.nanosecondsPerCycleFraction;
+
+        uint32_t low;
+        uint32_t high;
+        asm volatile ("rdtsc" : "=a"(low), "=d"(high));
+        auto cycles = (static_cast<uint64_t>(high) << 32) | low;
+
+        asm volatile ("" ::: "memory");
+        if ((sequence & 1) != 0 || sequence != timePage.sequence) {
+            continue;
+        }
+
+        // The counters of different CPUs may differ slightly -> Never go back behind the last tick and never reach the next one
+        uint32_t elapsedTime = 0;
+        if (cycles > lastCycles) {
+            auto elapsedCycles = cycles - lastCycles;
+            auto nanoseconds = elapsedCycles > UINT32_MAX ? tickInterval : elapsedCycles * nanosecondsPerCycle + ((elapsedCycles * nanosecondsPerCycleFraction) >> 32);
+            elapsedTime = nanoseconds < tickInterval ? static_cast<uint32_t>(nanoseconds) : tickInterval - 1;
+        }
+
+        auto systemTime = Util::Time::Timestamp(seconds, fraction);
+        systemTime.addNanoseconds(elapsedTime);
+        return systemTime;
+    }
+
     Util::Time::Timestamp systemTime;
     Util::System::call(Util::System::GET_SYSTEM_TIME, 1, &systemTime);
     return systemTime;
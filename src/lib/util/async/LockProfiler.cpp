@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "LockProfiler.h"
+
+#include "lib/util/async/Atomic.h"
+
+namespace Util::Async {
+
+LockProfiler::Entry LockProfiler::table[MAX_LOCK_NAMES];
+
+uint32_t LockProfiler::registerLock(const char *name) {
+    if (name == nullptr) {
+        name = "unnamed";
+    }
+
+    // Entries are claimed in order and never freed -> The first unused entry ends the search
+    for (uint32_t i = 0; i < MAX_LOCK_NAMES; i++) {
+        auto entryName = Atomic<uint32_t>(table[i].name);
+        if (entryName.get() == 0 && entryName.compareAndSet(0, reinterpret_cast<uint32_t>(name))) {
+            return i;
+        }
+
+        // The entry is used (maybe it has just been claimed by another lock with the same name)
+        if (equals(reinterpret_cast<const char*>(entryName.get()), name)) {
+            return i;
+        }
+    }
+
+    return INVALID_INDEX;
+}
+
+void LockProfiler::countAcquisition(uint32_t index) {
+    if (index != INVALID_INDEX) {
+        Atomic<uint32_t>(table[index].acquisitions).inc();
+    }
+}
+
+void LockProfiler::countContention(uint32_t index) {
+    if (index != INVALID_INDEX) {
+        Atomic<uint32_t>(table[index].contendedSpins).inc();
+    }
+}
+
+void LockProfiler::addHoldTime(uint32_t index, uint64_t cycles) {
+    if (index == INVALID_INDEX) {
+        return;
+    }
+
+    // Add the lower half and carry its overflow into the upper half
+    auto &entry = table[index];
+    auto cyclesLow = static_cast<uint32_t>(cycles);
+    auto carry = Atomic<uint32_t>(entry.holdCyclesLow).fetchAndAdd(cyclesLow) > UINT32_MAX - cyclesLow ? 1 : 0;
+    auto cyclesHigh = static_cast<uint32_t>(cycles >> 32) + carry;
+    if (cyclesHigh > 0) {
+        Atomic<uint32_t>(entry.holdCyclesHigh).add(cyclesHigh);
+    }
+
+    auto heldCycles = cycles > UINT32_MAX ? UINT32_MAX : cyclesLow;
+    auto maxHoldCycles = Atomic<uint32_t>(entry.maxHoldCycles);
+    for (auto current = maxHoldCycles.get(); heldCycles > current; current = maxHoldCycles.get()) {
+        if (maxHoldCycles.compareAndSet(current, heldCycles)) {
+            break;
+        }
+    }
+}
+
+uint32_t LockProfiler::getStatistics(LockStatistics *target, uint32_t maxEntries) {
+    uint32_t entries = 0;
+    while (entries < maxEntries && entries < MAX_LOCK_NAMES && table[entries].name != 0) {
+        const auto &entry = table[entries];
+        target[entries] = { reinterpret_cast<const char*>(entry.name), entry.acquisitions, entry.contendedSpins,
+                            static_cast<uint64_t>(entry.holdCyclesHigh) << 32 | entry.holdCyclesLow, entry.maxHoldCycles };
+        entries++;
+    }
+
+    return entries;
+}
+
+uint64_t LockProfiler::readTimestampCounter() {
+    uint32_t low;
+    uint32_t high;
+    asm volatile ("rdtsc" : "=a"(low), "=d"(high));
+
+    return (static_cast<uint64_t>(high) << 32) | low;
+}
+
+bool LockProfiler::equals(const char *first, const char *second) {
+    while (*first != '\0' && *first == *second) {
+        first++;
+        second++;
+    }
+
+    return *first == *second;
+}
+
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_LOCKPROFILER_H
+#define HHUOS_LOCKPROFILER_H
+
+#include <cstdint>
+
+namespace Util::Async {
+
+/**
+ * Contention statistics of all spinlocks sharing the same name.
+ */
+struct LockStatistics {
+    const char *name = nullptr;
+    uint32_t acquisitions = 0;
+    uint32_t contendedSpins = 0; // Failed attempts to acquire the lock
+    uint64_t holdCycles = 0; // Time stamp counter cycles, the lock has been held for
+    uint64_t maxHoldCycles = 0;
+};
+
+/**
+ * Collects the statistics of named spinlocks in builds with HHUOS_LOCK_PROFILING enabled.
+ * The table is statically allocated, so that locks may register themselves before the heap is available.
+ * Locks without a name are grouped as "unnamed".
+ * All updates are lock-free, since locks may be acquired and released in interrupt handlers at any time.
+ * The maximum hold time saturates at 2^32 cycles.
+ */
+class LockProfiler {
+
+public:
+    /**
+     * Default Constructor.
+     * Deleted, as this class has only static members.
+     */
+    LockProfiler() = delete;
+
+    /**
+     * Copy Constructor.
+     */
+    LockProfiler(const LockProfiler &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    LockProfiler &operator=(const LockProfiler &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~LockProfiler() = delete;
+
+    /**
+     * Get the index of the statistics entry for the given lock name, creating it if necessary.
+     *
+     * @return The index, or INVALID_INDEX if the table is full
+     */
+    static uint32_t registerLock(const char *name);
+
+    static void countAcquisition(uint32_t index);
+
+    static void countContention(uint32_t index);
+
+    static void addHoldTime(uint32_t index, uint64_t cycles);
+
+    /**
+     * Copy the statistics of all registered lock names.
+     * The values are not a consistent snapshot, since locks are acquired and released while copying.
+     *
+     * @return The number of copied entries
+     */
+    static uint32_t getStatistics(LockStatistics *target, uint32_t maxEntries);
+
+    static uint64_t readTimestampCounter();
+
+    static const constexpr uint32_t MAX_LOCK_NAMES = 64;
+    static const constexpr uint32_t INVALID_INDEX = 0xffffffff;
+
+private:
+
+    /**
+     * Entries are only updated with 32-bit atomic operations, since 64-bit values can not be updated atomically on i386.
+     */
+    struct Entry {
+        uint32_t name; // Address of the name, 0 if the entry is unused
+        uint32_t acquisitions;
+        uint32_t contendedSpins;
+        uint32_t holdCyclesLow;
+        uint32_t holdCyclesHigh;
+        uint32_t maxHoldCycles;
+    };
+
+    static bool equals(const char *first, const char *second);
+
+    static Entry table[MAX_LOCK_NAMES];
+};
+
+}
+
+#endif
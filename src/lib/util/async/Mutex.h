@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+#ifndef HHUOS_MUTEX_H
+#define HHUOS_MUTEX_H
+
+#include "Lock.h"
+#include "Spinlock.h"
+#include "WaitQueue.h"
+
+namespace Util::Async {
+
+/**
+ * A lock for long critical sections (e.g. device I/O).
+ * Instead of spinning, threads that find the mutex locked are put to sleep, until the holder releases it.
+ * Must not be used in interrupt handlers. Exception handlers (e.g. page faults) and system calls run on behalf of the
+ * interrupted thread and may block, as long as they do not hold any spinlocks.
+ */
+class Mutex : public Lock {
+
+public:
+    /**
+     * Default Constructor.
+     */
+    Mutex() = default;
+
+    /**
+     * Copy Constructor.
+     */
+    Mutex(const Mutex &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    Mutex &operator=(const Mutex &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~Mutex() override = default;
+
+    void acquire() override;
+
+    bool tryAcquire() override;
+
+    void release() override;
+
+    bool isLocked() override;
+
+private:
+
+    Spinlock stateLock;
+    WaitQueue waitQueue;
+    bool locked = false;
+};
+
+}
+
+#endif
@@ -32,8 +32,8 @@ namespace Util::Async {
 
 Process::Process(uint32_t id) : id(id) {}
 
-Process Process::execute(const Io::File &binaryFile, const Io::File &inpuputFile, const Io::File &outputFile, const Io::File &errorFile, const Util::String &command, const Util::Array<Util::String> &arguments) {
-    return ::executeBinary(binaryFile, inpuputFile, outputFile, errorFile, command, arguments);
+Process Process::execute(const Io::File &binaryFile, const Io::File &inpuputFile, const Io::File &outputFile, const Io::File &errorFile, const Util::String &command, const Util::Array<Util::String> &arguments, bool traceSystemCalls) {
+    return ::executeBinary(binaryFile, inpuputFile, outputFile, errorFile, command, arguments, traceSystemCalls);
 }
 
 Process Process::getCurrentProcess() {
@@ -60,4 +60,8 @@ void Process::kill() const {
     ::killProcess(id);
 }
 
+uint32_t Process::readSystemCallTrace(SystemCallRecord *buffer, uint32_t count, uint32_t &droppedRecords, bool &finished) const {
+    return ::readSystemCallTrace(id, buffer, count, droppedRecords, finished);
+}
+
 }
\ No newline at end of file
@@ -33,6 +33,20 @@ class File;
 
 namespace Util::Async {
 
+/**
+ * A system call, recorded by the kernel for a process, whose system calls are traced (see Process::execute()).
+ */
+struct SystemCallRecord {
+    uint32_t threadId;
+    uint8_t code;           // Util::System::Code
+    uint8_t result;
+    uint16_t paramCount;
+    uint32_t arguments[4];  // The first argument slots (a 64-bit argument occupies two slots)
+    uint64_t cycles;        // Elapsed timestamp counter cycles, including the time spent blocked
+
+    static const constexpr uint32_t MAX_ARGUMENTS = sizeof(arguments) / sizeof(arguments[0]);
+};
+
 class Process {
 
 public:
@@ -56,7 +70,12 @@ public:
      */
     ~Process() = default;
 
-    static Process execute(const Io::File &binaryFile, const Io::File &inputFile, const Io::File &outputFile, const Io::File &errorFile, const Util::String &command, const Util::Array<Util::String> &arguments);
+    /**
+     * Start a new process running the given binary.
+     * If traceSystemCalls is set, the kernel records all system calls of the new process,
+     * which can then be read by the calling process via readSystemCallTrace().
+     */
+    static Process execute(const Io::File &binaryFile, const Io::File &inputFile, const Io::File &outputFile, const Io::File &errorFile, const Util::String &command, const Util::Array<Util::String> &arguments, bool traceSystemCalls = false);
 
     static Process getCurrentProcess();
 
@@ -70,6 +89,19 @@ public:
 
     void kill() const;
 
+    /**
+     * Read the system calls, which have been recorded since the last call.
+     * Only the process, that has started this process with traceSystemCalls set, can read its records.
+     * Records are dropped, if the kernel's buffer is full, so the trace should be read regularly.
+     *
+     * @param buffer The buffer to fill
+     * @param count The maximum number of records to read
+     * @param droppedRecords Set to the number of records, that have been dropped since the last call
+     * @param finished Set to true, once the process has terminated and all its records have been read
+     * @return The number of records, written to the buffer
+     */
+    uint32_t readSystemCallTrace(SystemCallRecord *buffer, uint32_t count, uint32_t &droppedRecords, bool &finished) const;
+
 private:
 
     uint32_t id;
@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "ReadWriteLock.h"
+
+#include "Thread.h"
+
+namespace Util::Async {
+
+ReadWriteLock::ReadWriteLock() : stateWrapper(state), waitingWritersWrapper(waitingWriters) {}
+
+void ReadWriteLock::acquireRead() {
+    while (!tryAcquireRead()) {
+        Thread::yield();
+    }
+}
+
+bool ReadWriteLock::tryAcquireRead() {
+    auto threadId = Thread::getCurrentThread().getId();
+    auto *reader = findReader(threadId);
+    if (reader != nullptr) {
+        // Nested acquisition -> Waiting writers must not be preferred, since they wait for this thread
+        reader->depth++;
+        return true;
+    }
+
+    if (waitingWritersWrapper.get() > 0) {
+        return false;
+    }
+
+    reader = claimReader(threadId);
+    if (reader == nullptr) {
+        return false;
+    }
+
+    auto readingThreads = stateWrapper.get();
+    if (readingThreads == WRITER || !stateWrapper.compareAndSet(readingThreads, readingThreads + 1)) {
+        Atomic<uint32_t>(reader->threadId).set(FREE);
+        return false;
+    }
+
+    reader->depth = 1;
+    return true;
+}
+
+void ReadWriteLock::releaseRead() {
+    auto *reader = findReader(Thread::getCurrentThread().getId());
+    if (reader == nullptr || --reader->depth > 0) {
+        return;
+    }
+
+    Atomic<uint32_t>(reader->threadId).set(FREE);
+    stateWrapper.dec();
+}
+
+void ReadWriteLock::acquireWrite() {
+    waitingWritersWrapper.inc();
+    while (!stateWrapper.compareAndSet(0, WRITER)) {
+        Thread::yield();
+    }
+
+    waitingWritersWrapper.dec();
+}
+
+bool ReadWriteLock::tryAcquireWrite() {
+    return stateWrapper.compareAndSet(0, WRITER);
+}
+
+void ReadWriteLock::releaseWrite() {
+    stateWrapper.set(0);
+}
+
+bool ReadWriteLock::isWriteLocked() const {
+    return stateWrapper.get() == WRITER;
+}
+
+ReadWriteLock::Reader* ReadWriteLock::findReader(uint32_t threadId) {
+    // Only the thread itself writes its id into a slot, so it can not be claimed or freed concurrently
+    for (auto &reader : readers) {
+        if (Atomic<uint32_t>(reader.threadId).get() == threadId) {
+            return &reader;
+        }
+    }
+
+    return nullptr;
+}
+
+ReadWriteLock::Reader* ReadWriteLock::claimReader(uint32_t threadId) {
+    for (auto &reader : readers) {
+        if (Atomic<uint32_t>(reader.threadId).compareAndSet(FREE, threadId)) {
+            return &reader;
+        }
+    }
+
+    return nullptr;
+}
+
+uint32_t ReadWriteLock::getReaderCount() const {
+    auto readers = stateWrapper.get();
+    return readers == WRITER ? 0 : readers;
+}
+
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_READWRITELOCK_H
+#define HHUOS_READWRITELOCK_H
+
+#include <cstdint>
+
+#include "lib/util/async/Atomic.h"
+
+namespace Util::Async {
+
+/**
+ * A spinning reader-writer lock for read-mostly data structures.
+ * Any number of readers may hold the lock at the same time, while a writer holds it exclusively.
+ * Waiting writers are preferred over new readers, so that a steady stream of lookups can not starve updates.
+ * A thread holding the read lock may acquire it again, even if a writer is waiting. To recognize these threads,
+ * readers are tracked in a fixed number of slots, so at most MAX_READERS threads can hold the read lock at the same time.
+ * The write lock is not reentrant and must not be acquired by a thread holding the read lock.
+ */
+class ReadWriteLock {
+
+public:
+    /**
+     * Default Constructor.
+     */
+    ReadWriteLock();
+
+    /**
+     * Copy Constructor.
+     */
+    ReadWriteLock(const ReadWriteLock &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    ReadWriteLock &operator=(const ReadWriteLock &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~ReadWriteLock() = default;
+
+    void acquireRead();
+
+    bool tryAcquireRead();
+
+    void releaseRead();
+
+    void acquireWrite();
+
+    bool tryAcquireWrite();
+
+    void releaseWrite();
+
+    [[nodiscard]] bool isWriteLocked() const;
+
+    [[nodiscard]] uint32_t getReaderCount() const;
+
+    template<typename T>
+    T releaseReadAndReturn(T returnValue) {
+        releaseRead();
+        return returnValue;
+    }
+
+    template<typename T>
+    T releaseWriteAndReturn(T returnValue) {
+        releaseWrite();
+        return returnValue;
+    }
+
+    static const constexpr uint32_t MAX_READERS = 16;
+
+private:
+
+    struct Reader {
+        uint32_t threadId = FREE;
+        uint32_t depth = 0; // Only accessed by the thread holding the slot
+    };
+
+    Reader* findReader(uint32_t threadId);
+
+    Reader* claimReader(uint32_t threadId);
+
+    uint32_t state = 0; // Number of reading threads or WRITER
+    uint32_t waitingWriters = 0;
+    Atomic<uint32_t> stateWrapper;
+    Atomic<uint32_t> waitingWritersWrapper;
+    Reader readers[MAX_READERS]{};
+
+    static const constexpr uint32_t WRITER = UINT32_MAX;
+    static const constexpr uint32_t FREE = UINT32_MAX;
+};
+
+}
+
+#endif
@@ -20,8 +20,14 @@
 #include "Thread.h"
 #include "lib/util/async/Atomic.h"
 
+#ifdef HHUOS_LOCK_PROFILING
+#include "lib/util/async/LockProfiler.h"
+#endif
+
 namespace Util::Async {
 
+ReentrantSpinlock::ReentrantSpinlock(const char *name) : Spinlock(name) {}
+
 bool ReentrantSpinlock::tryAcquire() {
     auto currentThread = Thread::getCurrentThread();
     auto success = lockVarWrapper.compareAndSet(SPINLOCK_UNLOCK, currentThread.getId()) || lockVarWrapper.compareAndSet(currentThread.getId(), currentThread.getId());
@@ -29,6 +35,16 @@ bool ReentrantSpinlock::tryAcquire() {
         depth++;
     }
 
+#ifdef HHUOS_LOCK_PROFILING
+    // Only the outermost acquisition and release are taken into account
+    if (!success) {
+        LockProfiler::countContention(profilerIndex);
+    } else if (depth == 1) {
+        LockProfiler::countAcquisition(profilerIndex);
+        acquireTime = LockProfiler::readTimestampCounter();
+    }
+#endif
+
     return success;
 }
 
@@ -39,6 +55,9 @@ void ReentrantSpinlock::release() {
     }
 
     if (depth == 0) {
+#ifdef HHUOS_LOCK_PROFILING
+        LockProfiler::addHoldTime(profilerIndex, LockProfiler::readTimestampCounter() - acquireTime);
+#endif
         lockVarWrapper.compareAndSet(currentThread.getId(), SPINLOCK_UNLOCK);
     }
 }
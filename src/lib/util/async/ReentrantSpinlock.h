@@ -32,6 +32,11 @@ public:
      */
     ReentrantSpinlock() = default;
 
+    /**
+     * Constructor for a lock, whose contention is reported under the given name (see Spinlock).
+     */
+    explicit ReentrantSpinlock(const char *name);
+
     /**
      * Copy Constructor.
      */
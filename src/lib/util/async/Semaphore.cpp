@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+#include "Semaphore.h"
+
+namespace Util::Async {
+
+Semaphore::Semaphore(uint32_t permits) : permits(permits) {}
+
+void Semaphore::acquire() {
+    stateLock.acquire();
+    while (permits == 0) {
+        waitQueue.wait(stateLock);
+    }
+
+    permits--;
+    stateLock.release();
+}
+
+bool Semaphore::tryAcquire() {
+    stateLock.acquire();
+    if (permits == 0) {
+        stateLock.release();
+        return false;
+    }
+
+    permits--;
+    stateLock.release();
+    return true;
+}
+
+void Semaphore::release() {
+    stateLock.acquire();
+    permits++;
+    waitQueue.notify();
+    stateLock.release();
+}
+
+uint32_t Semaphore::getAvailablePermits() const {
+    return permits;
+}
+
+}
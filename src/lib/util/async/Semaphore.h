@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+#ifndef HHUOS_SEMAPHORE_H
+#define HHUOS_SEMAPHORE_H
+
+#include <cstdint>
+
+#include "Spinlock.h"
+#include "WaitQueue.h"
+
+namespace Util::Async {
+
+/**
+ * A counting semaphore. Threads, that try to acquire a permit while none is available, are put to sleep,
+ * until another thread releases one.
+ */
+class Semaphore {
+
+public:
+    /**
+     * Constructor.
+     */
+    explicit Semaphore(uint32_t permits);
+
+    /**
+     * Copy Constructor.
+     */
+    Semaphore(const Semaphore &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    Semaphore &operator=(const Semaphore &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~Semaphore() = default;
+
+    void acquire();
+
+    bool tryAcquire();
+
+    void release();
+
+    [[nodiscard]] uint32_t getAvailablePermits() const;
+
+private:
+
+    Spinlock stateLock;
+    WaitQueue waitQueue;
+    uint32_t permits;
+};
+
+}
+
+#endif
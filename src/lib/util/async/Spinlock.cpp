@@ -18,9 +18,19 @@
 #include "Thread.h"
 #include "Spinlock.h"
 
+#ifdef HHUOS_LOCK_PROFILING
+#include "lib/util/async/LockProfiler.h"
+#endif
+
 namespace Util::Async {
 
-Spinlock::Spinlock() : lockVarWrapper(lockVar) {}
+Spinlock::Spinlock() : Spinlock(nullptr) {}
+
+#ifdef HHUOS_LOCK_PROFILING
+Spinlock::Spinlock(const char *name) : lockVarWrapper(lockVar), profilerIndex(LockProfiler::registerLock(name)) {}
+#else
+Spinlock::Spinlock(const char*) : lockVarWrapper(lockVar) {}
+#endif
 
 void Spinlock::acquire() {
     while (!tryAcquire()) {
@@ -29,10 +39,24 @@ void Spinlock::acquire() {
 }
 
 bool Spinlock::tryAcquire() {
+#ifdef HHUOS_LOCK_PROFILING
+    if (!lockVarWrapper.compareAndSet(SPINLOCK_UNLOCK, SPINLOCK_LOCK)) {
+        LockProfiler::countContention(profilerIndex);
+        return false;
+    }
+
+    LockProfiler::countAcquisition(profilerIndex);
+    acquireTime = LockProfiler::readTimestampCounter();
+    return true;
+#else
     return lockVarWrapper.compareAndSet(SPINLOCK_UNLOCK, SPINLOCK_LOCK);
+#endif
 }
 
 void Spinlock::release() {
+#ifdef HHUOS_LOCK_PROFILING
+    LockProfiler::addHoldTime(profilerIndex, LockProfiler::readTimestampCounter() - acquireTime);
+#endif
     lockVarWrapper.set(SPINLOCK_UNLOCK);
 }
 
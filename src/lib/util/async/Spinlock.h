@@ -37,6 +37,12 @@ public:
 
     Spinlock();
 
+    /**
+     * Constructor for a lock, whose contention is reported under the given name,
+     * if the kernel is built with HHUOS_LOCK_PROFILING. The name must be a string literal.
+     */
+    explicit Spinlock(const char *name);
+
     Spinlock(const Spinlock &other) = delete;
 
     Spinlock &operator=(const Spinlock &other) = delete;
@@ -56,6 +62,11 @@ protected:
     uint32_t lockVar = SPINLOCK_UNLOCK;
     Atomic<uint32_t> lockVarWrapper;
 
+#ifdef HHUOS_LOCK_PROFILING
+    uint32_t profilerIndex;
+    uint64_t acquireTime = 0;
+#endif
+
     static const constexpr uint32_t SPINLOCK_UNLOCK = UINT32_MAX;
     static const constexpr uint32_t SPINLOCK_LOCK = 0x01;
 };
@@ -55,4 +55,8 @@ void Thread::join() const {
     ::joinThread(id);
 }
 
+bool Thread::setPriority(uint8_t priority) const {
+    return ::setThreadPriority(id, priority);
+}
+
 }
\ No newline at end of file
@@ -36,6 +36,18 @@ namespace Util::Async {
 class Thread {
 
 public:
+    /**
+     * Scheduling priorities. A higher value is preferred by the scheduler and receives a longer time slice.
+     * Any value between IDLE and MAXIMUM is valid, the names only mark common levels.
+     */
+    enum Priority : uint8_t {
+        IDLE = 0,
+        LOW = 8,
+        NORMAL = 16,
+        HIGH = 24,
+        MAXIMUM = 31
+    };
+
     /**
      * Constructor.
      */
@@ -68,6 +80,15 @@ public:
 
     void join() const;
 
+    /**
+     * Change the scheduling priority of this thread.
+     *
+     * Only threads of the calling process can be changed.
+     *
+     * @return false, if the thread does not exist, belongs to another process or the priority is invalid
+     */
+    bool setPriority(uint8_t priority) const;
+
 private:
 
     uint32_t id;
@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "TicketLock.h"
+
+#include "Thread.h"
+#include "lib/util/async/LockProfiler.h"
+
+namespace Util::Async {
+
+TicketLock::TicketLock() : TicketLock(nullptr) {}
+
+#ifdef HHUOS_LOCK_PROFILING
+TicketLock::TicketLock(const char *name) : nextTicketWrapper(nextTicket), currentTicketWrapper(currentTicket), profilerIndex(LockProfiler::registerLock(name)) {}
+#else
+TicketLock::TicketLock(const char*) : nextTicketWrapper(nextTicket), currentTicketWrapper(currentTicket) {}
+#endif
+
+void TicketLock::acquire() {
+    auto ticket = nextTicketWrapper.fetchAndInc();
+    while (currentTicketWrapper.get() != ticket) {
+#ifdef HHUOS_LOCK_PROFILING
+        LockProfiler::countContention(profilerIndex);
+#endif
+        Thread::yield();
+    }
+
+#ifdef HHUOS_LOCK_PROFILING
+    LockProfiler::countAcquisition(profilerIndex);
+    acquireTime = LockProfiler::readTimestampCounter();
+#endif
+}
+
+bool TicketLock::tryAcquire() {
+    // Only draw a ticket, if it would be served immediately
+    auto ticket = currentTicketWrapper.get();
+#ifdef HHUOS_LOCK_PROFILING
+    if (!nextTicketWrapper.compareAndSet(ticket, ticket + 1)) {
+        LockProfiler::countContention(profilerIndex);
+        return false;
+    }
+
+    LockProfiler::countAcquisition(profilerIndex);
+    acquireTime = LockProfiler::readTimestampCounter();
+    return true;
+#else
+    return nextTicketWrapper.compareAndSet(ticket, ticket + 1);
+#endif
+}
+
+void TicketLock::release() {
+#ifdef HHUOS_LOCK_PROFILING
+    LockProfiler::addHoldTime(profilerIndex, LockProfiler::readTimestampCounter() - acquireTime);
+#endif
+    currentTicketWrapper.inc();
+}
+
+bool TicketLock::isLocked() {
+    return currentTicketWrapper.get() != nextTicketWrapper.get();
+}
+
+}
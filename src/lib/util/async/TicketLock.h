@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_TICKETLOCK_H
+#define HHUOS_TICKETLOCK_H
+
+#include <cstdint>
+
+#include "lib/util/async/Atomic.h"
+#include "Lock.h"
+
+namespace Util::Async {
+
+/**
+ * A fair spinlock, that grants the lock in the order of acquisition attempts.
+ * Every acquirer draws a ticket and waits until the ticket is served, so no thread can starve
+ * while others repeatedly win the race for the lock (as it may happen with the test&set based Spinlock).
+ */
+class TicketLock : public Lock {
+
+public:
+    /**
+     * Default Constructor.
+     */
+    TicketLock();
+
+    /**
+     * Constructor for a named lock. The name is used to group contention statistics (see LockProfiler).
+     */
+    explicit TicketLock(const char *name);
+
+    /**
+     * Copy Constructor.
+     */
+    TicketLock(const TicketLock &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    TicketLock &operator=(const TicketLock &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~TicketLock() override = default;
+
+    void acquire() override;
+
+    bool tryAcquire() override;
+
+    void release() override;
+
+    bool isLocked() override;
+
+private:
+
+    uint32_t nextTicket = 0;
+    uint32_t currentTicket = 0;
+    Atomic<uint32_t> nextTicketWrapper;
+    Atomic<uint32_t> currentTicketWrapper;
+
+#ifdef HHUOS_LOCK_PROFILING
+    uint32_t profilerIndex;
+    uint64_t acquireTime = 0;
+#endif
+};
+
+}
+
+#endif
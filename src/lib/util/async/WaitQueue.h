@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+#ifndef HHUOS_UTIL_WAITQUEUE_H
+#define HHUOS_UTIL_WAITQUEUE_H
+
+namespace Util::Async {
+class Lock;
+
+/**
+ * Lets threads wait for a condition, that is protected by a lock, without spinning on yield().
+ * In kernel space, waiting threads are blocked by the scheduler until they are notified.
+ * In user space, threads cannot be parked yet, so waiting falls back to releasing the lock and yielding.
+ * The underlying queue is only created by the first wait, so wait queues may be used in static objects.
+ * Waiting and notifying must happen under the same lock.
+ */
+class WaitQueue {
+
+public:
+    /**
+     * Default Constructor.
+     */
+    WaitQueue() = default;
+
+    /**
+     * Copy Constructor.
+     */
+    WaitQueue(const WaitQueue &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    WaitQueue &operator=(const WaitQueue &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~WaitQueue();
+
+    /**
+     * Wait until notified. The lock must be held by the caller.
+     * It is released while waiting and acquired again before returning.
+     */
+    void wait(Lock &lock);
+
+    void notify();
+
+    void notifyAll();
+
+private:
+
+    void *queue = nullptr;
+};
+
+}
+
+#endif
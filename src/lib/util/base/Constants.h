@@ -27,6 +27,7 @@ namespace Util {
 static const constexpr uint32_t PAGESIZE = 0x1000;
 static const constexpr uint32_t USER_SPACE_MEMORY_MANAGER_ADDRESS = 0x1000;
 static const constexpr uint32_t USER_SPACE_STACK_INSTANCE_ADDRESS = USER_SPACE_MEMORY_MANAGER_ADDRESS + sizeof(FreeListMemoryManager);
+static const constexpr uint32_t USER_SPACE_TIME_PAGE_ADDRESS = 0x2000;
 
 }
 
@@ -156,7 +156,7 @@ private:
     uint8_t *startAddress{};
     uint8_t *endAddress{};
 
-    Util::Async::Spinlock lock;
+    Util::Async::Spinlock lock = Util::Async::Spinlock("heap");
     FreeListHeader *firstChunk = nullptr;
     uint32_t unusedMemory = 0;
     bool unmapFreedMemory = true;
@@ -26,6 +26,7 @@
 #include "lib/util/base/Exception.h"
 #include "lib/util/base/String.h"
 #include "lib/util/collection/Array.h"
+#include "lib/util/math/Math.h"
 
 namespace Util {
 
@@ -473,6 +474,19 @@ String String::vformat(const char *format, va_list args) {
     return stream.getContent();
 }
 
+String String::toDecimalString(uint64_t value) {
+    char digits[21]{};
+    auto index = sizeof(digits) - 1;
+
+    do {
+        uint32_t remainder;
+        value = Math::divide(value, 10, remainder);
+        digits[--index] = static_cast<char>('0' + remainder);
+    } while (value > 0);
+
+    return String(digits + index);
+}
+
 int32_t String::parseInt(const char *string) {
     int32_t length;
     for (length = 0; string[length] != '\0'; length ++) {}
@@ -77,6 +77,12 @@ public:
 
     [[nodiscard]] static String vformat(const char *format, va_list args);
 
+    /**
+     * Convert an unsigned 64-bit integer to its decimal representation.
+     * Unlike format(), this works without 64-bit division, which is not available in the kernel.
+     */
+    [[nodiscard]] static String toDecimalString(uint64_t value);
+
     [[nodiscard]] static bool isAlpha(char c);
 
     [[nodiscard]] static bool isNumeric(char c);
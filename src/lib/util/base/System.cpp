@@ -22,6 +22,7 @@
 #include "lib/util/io/stream/FileInputStream.h"
 #include "lib/util/io/stream/FileOutputStream.h"
 #include "lib/util/io/stream/PrintStream.h"
+#include "lib/util/hardware/CpuId.h"
 
 namespace Util {
 
@@ -48,6 +49,12 @@ bool System::call(System::Code code, uint32_t paramCount...) {
 }
 
 void System::call(Code code, bool &result, uint32_t paramCount, va_list args) {
+    static bool fastSystemCallSupported = Hardware::CpuId::isFastSystemCallSupported();
+    if (fastSystemCallSupported) {
+        result = callFast(code, paramCount, args);
+        return;
+    }
+
     auto eaxValue = static_cast<uint32_t>(code | (paramCount << 8));
     auto ebxValue = reinterpret_cast<uint32_t>(args);
     auto ecxValue = reinterpret_cast<uint32_t>(&result);
@@ -72,4 +79,45 @@ void System::call(Code code, bool &result, uint32_t paramCount, va_list args) {
             : "eax", "ebx", "ecx");
 }
 
+bool System::callFast(Code code, uint32_t paramCount, va_list args) {
+    // Register layout: eax, ebx, ecx, edx, esi, edi, argument list
+    uint32_t registers[FAST_CALL_REGISTER_SLOTS + 2]{};
+    registers[0] = static_cast<uint32_t>(code | (paramCount << 8));
+    registers[FAST_CALL_REGISTER_SLOTS + 1] = reinterpret_cast<uint32_t>(args);
+
+    if (passesArgumentsInRegisters(code, paramCount)) {
+        va_list registerArgs;
+        va_copy(registerArgs, args);
+        for (uint32_t i = 0; i < paramCount; i++) {
+            registers[i + 1] = va_arg(registerArgs, uint32_t);
+        }
+        va_end(registerArgs);
+    }
+
+    // The kernel expects the return address on top of the user stack (pointed to by ebp), followed by the argument list
+    auto value = reinterpret_cast<uint32_t>(registers);
+    asm volatile (
+            "push %%ebp;"
+            "push 24(%%eax);"
+            "push $1f;"
+            "mov %%esp, %%ebp;"
+
+            "mov 4(%%eax), %%ebx;"
+            "mov 8(%%eax), %%ecx;"
+            "mov 12(%%eax), %%edx;"
+            "mov 16(%%eax), %%esi;"
+            "mov 20(%%eax), %%edi;"
+            "mov (%%eax), %%eax;"
+            "sysenter;"
+
+            "1:"
+            "add $8, %%esp;"
+            "pop %%ebp;"
+            : "+a"(value)
+            :
+            : "ebx", "ecx", "edx", "esi", "edi", "memory", "cc");
+
+    return value != 0;
+}
+
 }
\ No newline at end of file
@@ -70,7 +70,12 @@ public:
         GET_SYSTEM_TIME,
         SET_DATE,
         GET_CURRENT_DATE,
-        SHUTDOWN
+        SHUTDOWN,
+        CREATE_IO_RING,
+        ENTER_IO_RING,
+        DESTROY_IO_RING,
+        READ_SYSTEM_CALL_TRACE,
+        SET_THREAD_PRIORITY
     };
 
     /**
@@ -96,6 +101,21 @@ public:
 
     static bool call(Code code, uint32_t paramCount...);
 
+    /**
+     * Check, if the arguments of a fast system call (via SYSENTER) are passed in registers.
+     * Each register holds one 32-bit argument, so up to five arguments are passed this way.
+     * System calls with 64-bit arguments (READ_FILE and WRITE_FILE) always use the caller's argument list instead.
+     * Caller and kernel both decide by this function, so they always agree on where the arguments are.
+     */
+    static constexpr bool passesArgumentsInRegisters(Code code, uint32_t paramCount) {
+        return paramCount <= FAST_CALL_REGISTER_SLOTS && code != READ_FILE && code != WRITE_FILE;
+    }
+
+    /**
+     * Number of arguments, that are passed in registers (ebx, ecx, edx, esi and edi) by a fast system call.
+     */
+    static const constexpr uint32_t FAST_CALL_REGISTER_SLOTS = 5;
+
     static Io::InputStream &in;
     static Io::PrintStream out;
     static Io::PrintStream error;
@@ -106,6 +126,8 @@ private:
 
     static void call(Code code, bool &result, uint32_t paramCount, va_list args);
 
+    static bool callFast(Code code, uint32_t paramCount, va_list args);
+
     static Io::FileInputStream inStream;
     static Io::BufferedInputStream bufferedInStream;
 
@@ -40,6 +40,13 @@ public:
 
     [[nodiscard]] T* pop();
 
+    /**
+     * Remove an element from the pool, without throwing an exception, if the pool is empty.
+     *
+     * @return The element, or nullptr if the pool is empty
+     */
+    [[nodiscard]] T* tryPop();
+
     [[nodiscard]] uint32_t getCapacity();
 
     [[nodiscard]] uint32_t getFillingDegree();
@@ -72,9 +79,19 @@ bool Pool<T>::push(T *element) {
 
 template<typename T>
 T* Pool<T>::pop() {
+    T *element = tryPop();
+    if (element == nullptr) {
+        Util::Exception::throwException(Util::Exception::ILLEGAL_STATE, "Pool: Out of objects!");
+    }
+
+    return element;
+}
+
+template<typename T>
+T* Pool<T>::tryPop() {
     uint32_t index = writtenMap.findAndUnset();
     if (index == Async::AtomicBitmap::INVALID_INDEX) {
-        Util::Exception::throwException(Util::Exception::ILLEGAL_STATE, "Pool: Out of objects!");
+        return nullptr;
     }
 
     T *element = array[index];
@@ -59,6 +59,7 @@ void Engine::run() {
     const auto delta = 1.0 / targetFrameRate;
     const auto deltaMilliseconds = static_cast<uint32_t>(delta * 1000);
 
+    Async::Thread::getCurrentThread().setPriority(Async::Thread::HIGH);
     Graphic::Ansi::prepareGraphicalApplication(true);
     initializeNextScene();
 
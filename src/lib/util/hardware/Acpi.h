@@ -130,6 +130,15 @@ public:
         uint32_t flags;
     } __attribute__ ((packed));
 
+    struct Hpet {
+        SdtHeader header;
+        uint32_t eventTimerBlockId;
+        GenericAddressStructure address;
+        uint8_t hpetNumber;
+        uint16_t minimumTick;
+        uint8_t pageProtection;
+    } __attribute__ ((packed));
+
     // Only ACPI 1.0, later versions have more stuff that needs to be accounted for
     enum ApicStructureType : uint8_t {
         PROCESSOR_LOCAL_APIC = 0x0,
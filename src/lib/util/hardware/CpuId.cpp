@@ -62,9 +62,9 @@ uint64_t CpuId::getCpuFeatureBits() {
             "cpuid;"
             "mov %%edx,%0;"
             "mov %%ecx,%1;"
-            : "=r"(edx), "=r"(ecx)
+            : "=d"(edx), "=c"(ecx)
             :
-            : "%ecx", "%edx"
+            : "%eax", "%ebx"
             );
 
     return static_cast<uint64_t>(ecx) << 32 | edx;
@@ -98,9 +98,9 @@ CpuId::CpuInfo CpuId::getCpuInfo() {
     "mov $1,%%eax;"
     "cpuid;"
     "mov %%eax,%0;"
-    : "=r"(eax)
+    : "=a"(eax)
     :
-    : "%eax"
+    : "%ebx", "%ecx", "%edx"
     );
 
     uint8_t extendedModel = (eax & EXTENDED_MODEL_BITMASK) >> 16;
@@ -113,6 +113,45 @@ CpuId::CpuInfo CpuId::getCpuInfo() {
     return { family, model, stepping, static_cast<CpuType>(type) };
 }
 
+bool CpuId::isFastSystemCallSupported() {
+    if (!isAvailable() || (getCpuFeatureBits() & SEP) == 0) {
+        return false;
+    }
+
+    auto info = getCpuInfo();
+    return !(info.family == 6 && info.model < 3 && info.stepping < 3);
+}
+
+bool CpuId::isInvariantTimestampCounterSupported() {
+    if (!isAvailable() || (getCpuFeatureBits() & TSC) == 0) {
+        return false;
+    }
+
+    uint32_t maxExtendedLeaf;
+    asm volatile(
+            "mov $0x80000000,%%eax;"
+            "cpuid;"
+            : "=a"(maxExtendedLeaf)
+            :
+            : "%ebx", "%ecx", "%edx"
+            );
+
+    if (maxExtendedLeaf < 0x80000007) {
+        return false;
+    }
+
+    uint32_t edx;
+    asm volatile(
+            "mov $0x80000007,%%eax;"
+            "cpuid;"
+            : "=d"(edx)
+            :
+            : "%eax", "%ebx", "%ecx"
+            );
+
+    return (edx & (1 << 8)) != 0;
+}
+
 const char* CpuId::getFeatureAsString(CpuId::CpuFeature feature) {
     switch (feature) {
         case FPU:
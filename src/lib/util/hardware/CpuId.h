@@ -140,6 +140,17 @@ public:
 
     [[nodiscard]] static const char* getFeatureAsString(CpuFeature);
 
+    /**
+     * Check if SYSENTER/SYSEXIT can be used. Some early Pentium Pro processors report SEP, without supporting it.
+     */
+    [[nodiscard]] static bool isFastSystemCallSupported();
+
+    /**
+     * Check if the time stamp counter runs at a constant rate in all power states (extended leaf 0x80000007).
+     * Only then, it is suitable for measuring time.
+     */
+    [[nodiscard]] static bool isInvariantTimestampCounterSupported();
+
     static const constexpr uint32_t STEPPING_BITMASK = 0x0000000f;
     static const constexpr uint32_t MODEL_BITMASK = 0x000000f0;
     static const constexpr uint32_t FAMILY_BITMASK = 0x00000f00;
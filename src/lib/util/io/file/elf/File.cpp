@@ -107,4 +107,29 @@ void File::loadProgram() {
     }
 }
 
-}
\ No newline at end of file
+const char* File::getSymbolName(uint32_t address, uint32_t &symbolAddress) const {
+    for (uint32_t i = 0; i < fileHeader.sectionHeaderEntries; i++) {
+        const auto &sectionHeader = sectionHeaders[i];
+        if (sectionHeader.type != SectionHeaderType::SYMTAB) {
+            continue;
+        }
+
+        const auto *symbols = reinterpret_cast<SymbolEntry*>(buffer + sectionHeader.offset);
+        const auto *names = reinterpret_cast<char*>(buffer + sectionHeaders[sectionHeader.link].offset);
+        for (uint32_t j = 0; j < sectionHeader.size / sizeof(SymbolEntry); j++) {
+            const auto &symbol = symbols[j];
+            if (symbol.getSymbolType() != SymbolType::FUNC) {
+                continue;
+            }
+
+            if (address == symbol.value || (address > symbol.value && address < symbol.value + symbol.size)) {
+                symbolAddress = symbol.value;
+                return names + symbol.nameOffset;
+            }
+        }
+    }
+
+    return nullptr;
+}
+
+}
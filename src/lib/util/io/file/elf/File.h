@@ -60,6 +60,12 @@ enum class ProgramHeaderType : uint32_t {
     PHDR = 0x06,
 };
 
+enum ProgramHeaderFlag : uint32_t {
+    EXECUTE = 0x01,
+    WRITE = 0x02,
+    READ = 0x04
+};
+
 enum class MachineType : uint16_t {
     X86 = 0x03
 };
@@ -226,6 +232,15 @@ public:
 
     void loadProgram();
 
+    /**
+     * Search the symbol table for the function, that contains a given address.
+     *
+     * @param address The address
+     * @param symbolAddress Is set to the function's start address
+     * @return The function's name, or nullptr if the address does not belong to a known function
+     */
+    [[nodiscard]] const char* getSymbolName(uint32_t address, uint32_t &symbolAddress) const;
+
     [[nodiscard]] int32_t (*getEntryPoint() const)(int, char**) {
         return reinterpret_cast<int (*)(int, char**)>(fileHeader.entry);
     }
@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "IoRing.h"
+
+#include "lib/interface.h"
+#include "lib/util/async/Atomic.h"
+
+namespace Util::Io {
+
+IoRing::IoRing(uint32_t capacity) {
+    uint32_t powerOfTwo = 1;
+    while (powerOfTwo < capacity) {
+        powerOfTwo <<= 1;
+    }
+
+    rings.capacity = powerOfTwo;
+    rings.submissions = new Submission[powerOfTwo];
+    rings.completions = new Completion[powerOfTwo];
+    valid = ::createIoRing(rings);
+}
+
+IoRing::~IoRing() {
+    if (valid) {
+        ::destroyIoRing(rings);
+    }
+
+    delete[] rings.submissions;
+    delete[] rings.completions;
+}
+
+bool IoRing::isValid() const {
+    return valid;
+}
+
+bool IoRing::submitRead(int32_t fileDescriptor, uint8_t *targetBuffer, uint64_t offset, uint32_t length, uint32_t userData) {
+    return submit({ READ_FILE, fileDescriptor, targetBuffer, length, offset, userData });
+}
+
+bool IoRing::submitWrite(int32_t fileDescriptor, const uint8_t *sourceBuffer, uint64_t offset, uint32_t length, uint32_t userData) {
+    return submit({ WRITE_FILE, fileDescriptor, const_cast<uint8_t*>(sourceBuffer), length, offset, userData });
+}
+
+bool IoRing::submitSend(int32_t fileDescriptor, const Network::Datagram &datagram, uint32_t userData) {
+    return submit({ SEND_DATAGRAM, fileDescriptor, const_cast<Network::Datagram*>(&datagram), 0, 0, userData });
+}
+
+bool IoRing::submitReceive(int32_t fileDescriptor, Network::Datagram &datagram, uint32_t userData) {
+    return submit({ RECEIVE_DATAGRAM, fileDescriptor, &datagram, 0, 0, userData });
+}
+
+uint32_t IoRing::enter(uint32_t minCompletions) {
+    if (!valid) {
+        return 0;
+    }
+
+    return ::enterIoRing(rings, minCompletions);
+}
+
+bool IoRing::getCompletion(Completion &completion) {
+    auto head = rings.completionHead;
+    if (head == Async::Atomic<uint32_t>(rings.completionTail).get()) {
+        return false;
+    }
+
+    completion = rings.completions[head & (rings.capacity - 1)];
+    // Publish the free slot only after the entry has been copied
+    Async::Atomic<uint32_t>(rings.completionHead).set(head + 1);
+    return true;
+}
+
+uint32_t IoRing::getFreeSubmissionSlots() const {
+    auto head = Async::Atomic<uint32_t>(const_cast<uint32_t&>(rings.submissionHead)).get();
+    return rings.capacity - (rings.submissionTail - head);
+}
+
+bool IoRing::submit(const Submission &submission) {
+    if (!valid || getFreeSubmissionSlots() == 0) {
+        return false;
+    }
+
+    auto tail = rings.submissionTail;
+    rings.submissions[tail & (rings.capacity - 1)] = submission;
+    // The kernel must not see the new tail, before the entry has been written completely
+    Async::Atomic<uint32_t>(rings.submissionTail).set(tail + 1);
+    return true;
+}
+
+}
@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_UTIL_IORING_H
+#define HHUOS_UTIL_IORING_H
+
+#include <cstdint>
+
+namespace Util {
+namespace Network {
+class Datagram;
+}  // namespace Network
+}  // namespace Util
+
+namespace Util::Io {
+
+/**
+ * Submits file and network operations to the kernel in batches, without blocking for each of them.
+ * Submissions and completions are exchanged via two rings in the process's memory, which are shared with the kernel.
+ * The kernel processes submissions on worker threads of the calling process and posts one completion for each of them.
+ * A single system call (enter()) passes new submissions to the kernel and optionally waits for completions.
+ * Operations may complete in any order, so each submission carries a user defined value, that is returned with its completion.
+ */
+class IoRing {
+
+public:
+
+    enum Operation : uint32_t {
+        READ_FILE,
+        WRITE_FILE,
+        SEND_DATAGRAM,
+        RECEIVE_DATAGRAM
+    };
+
+    struct Submission {
+        Operation operation;
+        int32_t fileDescriptor;
+        void *buffer; // Data of file operations, Util::Network::Datagram of datagram operations
+        uint32_t length;
+        uint64_t offset;
+        uint32_t userData;
+    };
+
+    struct Completion {
+        uint32_t userData;
+        int32_t result; // Number of transferred bytes or -1, if the operation has failed
+    };
+
+    /**
+     * Ring indices and entries, shared with the kernel.
+     * Indices run freely and are masked with (capacity - 1), so the capacity must be a power of two.
+     * User space only writes submissionTail and completionHead, the kernel only writes submissionHead and completionTail.
+     */
+    struct Rings {
+        uint32_t capacity;
+        uint32_t submissionHead;
+        uint32_t submissionTail;
+        uint32_t completionHead;
+        uint32_t completionTail;
+        Submission *submissions;
+        Completion *completions;
+    };
+
+    /**
+     * Constructor.
+     * The capacity is rounded up to the next power of two.
+     */
+    explicit IoRing(uint32_t capacity = DEFAULT_CAPACITY);
+
+    /**
+     * Copy Constructor.
+     */
+    IoRing(const IoRing &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    IoRing &operator=(const IoRing &other) = delete;
+
+    /**
+     * Destructor.
+     * Waits for all operations, that the kernel has already started, to complete.
+     */
+    ~IoRing();
+
+    [[nodiscard]] bool isValid() const;
+
+    bool submitRead(int32_t fileDescriptor, uint8_t *targetBuffer, uint64_t offset, uint32_t length, uint32_t userData);
+
+    bool submitWrite(int32_t fileDescriptor, const uint8_t *sourceBuffer, uint64_t offset, uint32_t length, uint32_t userData);
+
+    bool submitSend(int32_t fileDescriptor, const Network::Datagram &datagram, uint32_t userData);
+
+    bool submitReceive(int32_t fileDescriptor, Network::Datagram &datagram, uint32_t userData);
+
+    /**
+     * Pass all pending submissions to the kernel and wait, until at least the given number of completions is available.
+     * Returns early, if there are not enough operations left to satisfy the request.
+     *
+     * @return The number of available completions
+     */
+    uint32_t enter(uint32_t minCompletions = 0);
+
+    /**
+     * Take the oldest available completion.
+     *
+     * @return false, if no completion is available
+     */
+    bool getCompletion(Completion &completion);
+
+    [[nodiscard]] uint32_t getFreeSubmissionSlots() const;
+
+    static const constexpr uint32_t DEFAULT_CAPACITY = 64;
+
+private:
+
+    bool submit(const Submission &submission);
+
+    Rings rings{};
+    bool valid;
+};
+
+}
+
+#endif
@@ -19,7 +19,6 @@
 #include "lib/util/base/Exception.h"
 #include "PipedOutputStream.h"
 #include "PipedInputStream.h"
-#include "lib/util/async/Thread.h"
 
 namespace Util::Io {
 
@@ -60,9 +59,7 @@ int32_t PipedInputStream::read(uint8_t *targetBuffer, uint32_t offset, uint32_t
     // Block while buffer is empty
     lock.acquire();
     while (inPosition < 0) {
-        lock.release();
-        Async::Thread::yield();
-        lock.acquire();
+        readQueue.wait(lock);
     }
 
     uint32_t remaining = length;
@@ -99,6 +96,7 @@ int32_t PipedInputStream::read(uint8_t *targetBuffer, uint32_t offset, uint32_t
 
         // Check if we have copied the requested amount of bytes or if the internal buffer is empty
         if (remaining == 0 || inPosition == -1) {
+            writeQueue.notifyAll();
             lock.release();
             return ret;
         }
@@ -117,9 +115,7 @@ void PipedInputStream::write(const uint8_t *sourceBuffer, uint32_t offset, uint3
     while (remaining > 0) {
         // Block while buffer is full
         while (inPosition == outPosition) {
-            lock.release();
-            Async::Thread::yield();
-            lock.acquire();
+            writeQueue.wait(lock);
         }
 
         if (inPosition < 0) { // Buffer is empty
@@ -147,6 +143,9 @@ void PipedInputStream::write(const uint8_t *sourceBuffer, uint32_t offset, uint3
         if (inPosition == bufferSize) {
             inPosition = 0;
         }
+
+        // Wake up readers now, since this write might block on a full buffer before it is complete
+        readQueue.notifyAll();
     }
 
     lock.release();
@@ -168,4 +167,8 @@ uint32_t PipedInputStream::available() {
     return ret;
 }
 
+uint32_t PipedInputStream::getBufferSize() const {
+    return bufferSize;
+}
+
 }
\ No newline at end of file
@@ -22,6 +22,7 @@
 
 #include "InputStream.h"
 #include "lib/util/async/Spinlock.h"
+#include "lib/util/async/WaitQueue.h"
 
 namespace Util::Io {
 
@@ -49,6 +50,8 @@ public:
 
     uint32_t available();
 
+    [[nodiscard]] uint32_t getBufferSize() const;
+
 private:
 
     virtual void write(uint8_t c);
@@ -58,6 +61,8 @@ private:
     PipedOutputStream *source = nullptr;
 
     Util::Async::Spinlock lock;
+    Util::Async::WaitQueue readQueue;
+    Util::Async::WaitQueue writeQueue;
 
     uint8_t *buffer;
     int32_t bufferSize;
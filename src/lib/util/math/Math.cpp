@@ -282,4 +282,21 @@ bool equals(double first, double second, double epsilon) {
     return absolute(first - second)  < epsilon;
 }
 
+uint64_t divide(uint64_t dividend, uint32_t divisor, uint32_t &remainder) {
+    // The div instruction divides a 64-bit integer by a 32-bit integer, but the quotient must fit into 32 bits.
+    // Dividing the upper half first guarantees this for the second step.
+    auto high = static_cast<uint32_t>(dividend >> 32);
+    auto low = static_cast<uint32_t>(dividend);
+    uint32_t quotientHigh = high / divisor;
+    uint32_t quotientLow;
+
+    asm volatile (
+            "divl %4"
+            : "=a"(quotientLow), "=d"(remainder)
+            : "a"(low), "d"(high % divisor), "rm"(divisor)
+            );
+
+    return static_cast<uint64_t>(quotientHigh) << 32 | quotientLow;
+}
+
 }
\ No newline at end of file
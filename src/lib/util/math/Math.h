@@ -91,6 +91,13 @@ namespace Util::Math {
 
     bool equals(double first, double second, double epsilon);
 
+    /**
+     * Divide a 64-bit integer by a 32-bit integer.
+     * The compiler would call __udivdi3 from libgcc for this, which is not available in the kernel.
+     * All code, that may run in the kernel, must use this function instead of dividing 64-bit integers directly.
+     */
+    uint64_t divide(uint64_t dividend, uint32_t divisor, uint32_t &remainder);
+
     static const constexpr double PI = 3.14159265358979323846;
 }
 
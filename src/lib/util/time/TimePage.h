@@ -0,0 +1,47 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_TIMEPAGE_H
+#define HHUOS_TIMEPAGE_H
+
+#include <cstdint>
+
+namespace Util::Time {
+
+/**
+ * Layout of the time page, which the kernel maps read-only into every user address space
+ * (at Util::USER_SPACE_TIME_PAGE_ADDRESS) and updates on every timer tick.
+ * User space reads the system time at the last tick and extrapolates it with the time stamp counter,
+ * so that querying the system time does not need a system call.
+ *
+ * The kernel increments the sequence number before and after each update, so it is odd, while the page is being written.
+ * Readers must retry, if the sequence number is odd or has changed while reading.
+ */
+struct TimePage {
+    uint32_t sequence;
+    uint32_t calibrated; // Set, once the conversion from cycles to nanoseconds is known
+    uint32_t seconds; // System time at the last tick
+    uint32_t fraction;
+    uint64_t cycles; // Time stamp counter at the last tick
+    uint32_t tickInterval; // Maximum nanoseconds until the next update (extrapolated time is always less than this)
+    uint32_t nanosecondsPerCycle; // Integer part of the conversion factor
+    uint32_t nanosecondsPerCycleFraction; // Fractional part of the conversion factor (in 1/2^32 nanoseconds)
+};
+
+}
+
+#endif
@@ -44,7 +44,7 @@ void Timestamp::addNanoseconds(uint32_t value) {
 }
 
 void Timestamp::addSeconds(uint32_t value) {
-    this->seconds += seconds;
+    seconds += value;
 }
 
 bool Timestamp::operator>(const Timestamp &other) const {
@@ -111,6 +111,10 @@ uint32_t Timestamp::toYears() const {
     return seconds / 31536000;
 }
 
+uint32_t Timestamp::getFraction() const {
+    return fraction;
+}
+
 Timestamp Timestamp::ofMilliseconds(uint32_t milliseconds) {
     auto seconds = milliseconds / 1000;
     auto fraction = (milliseconds % 1000) * 1000000;
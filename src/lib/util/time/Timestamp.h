@@ -91,6 +91,8 @@ public:
 
     [[nodiscard]] uint32_t toYears() const;
 
+    [[nodiscard]] uint32_t getFraction() const;
+
 private:
 
     uint32_t seconds = 0;